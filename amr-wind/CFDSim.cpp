@@ -2,6 +2,7 @@
 #include "amr-wind/transport_models/TransportModel.H"
 #include "amr-wind/turbulence/TurbulenceModel.H"
 #include "amr-wind/utilities/IOManager.H"
+#include "amr-wind/utilities/DerivedQuantity.H"
 #include "amr-wind/utilities/PostProcessing.H"
 #include "amr-wind/overset/OversetManager.H"
 #include "amr-wind/core/ExtSolver.H"
@@ -15,6 +16,7 @@ CFDSim::CFDSim(amrex::AmrCore& mesh)
     : m_mesh(mesh)
     , m_repo(m_mesh)
     , m_pde_mgr(*this)
+    , m_derived_cache(new DerivedQtyCache(m_repo, m_time))
     , m_io_mgr(new IOManager(*this))
     , m_post_mgr(new PostProcessManager(*this))
     , m_ext_solver_mgr(new ExtSolverMgr)
@@ -82,6 +84,7 @@ void CFDSim::activate_mesh_map()
     if (m_mesh_mapping) {
         m_mesh_map = MeshMap::create(mesh_map_name);
         m_mesh_map->declare_mapping_fields(*this, m_pde_mgr.num_ghost_state());
+        m_repo.set_mesh_map(m_mesh_map.get());
     }
 }
 
@@ -2,6 +2,7 @@
 
 #include "amr-wind/core/Field.H"
 #include "amr-wind/core/FieldRepo.H"
+#include "amr-wind/core/MeshMap.H"
 #include "amr-wind/core/FieldFillPatchOps.H"
 #include "amr-wind/core/FieldBCOps.H"
 #include "amr-wind/core/SimTime.H"
@@ -400,6 +401,25 @@ void Field::to_uniform_space() noexcept
         return;
     }
 
+    const auto* mesh_map = m_repo.mesh_map();
+    if ((mesh_map != nullptr) && mesh_map->is_separable()) {
+        // scale velocity using the 1-D mapping arrays -> U^bar = U * J/fac
+        for (int lev = 0; lev < m_repo.num_active_levels(); ++lev) {
+            const auto map = mesh_map->separable_view(lev, m_info->m_floc);
+            const auto& field = operator()(lev).arrays();
+            amrex::ParallelFor(
+                operator()(lev), num_grow(), operator()(lev).nComp(),
+                [=] AMREX_GPU_DEVICE(
+                    int nbx, int i, int j, int k, int n) noexcept {
+                    field[nbx](i, j, k, n) *=
+                        map.det_j(i, j, k) / map(i, j, k, n);
+                });
+        }
+        amrex::Gpu::streamSynchronize();
+        m_mesh_mapped = true;
+        return;
+    }
+
     const auto& mesh_fac = m_repo.get_mesh_mapping_field(m_info->m_floc);
     const auto& mesh_detJ = m_repo.get_mesh_mapping_det_j(m_info->m_floc);
 
@@ -430,6 +450,25 @@ void Field::to_stretched_space() noexcept
         return;
     }
 
+    const auto* mesh_map = m_repo.mesh_map();
+    if ((mesh_map != nullptr) && mesh_map->is_separable()) {
+        // scale field back using the 1-D mapping arrays -> U = U^bar * fac/J
+        for (int lev = 0; lev < m_repo.num_active_levels(); ++lev) {
+            const auto map = mesh_map->separable_view(lev, m_info->m_floc);
+            const auto& field = operator()(lev).arrays();
+            amrex::ParallelFor(
+                operator()(lev), num_grow(), operator()(lev).nComp(),
+                [=] AMREX_GPU_DEVICE(
+                    int nbx, int i, int j, int k, int n) noexcept {
+                    field[nbx](i, j, k, n) *=
+                        map(i, j, k, n) / map.det_j(i, j, k);
+                });
+        }
+        amrex::Gpu::streamSynchronize();
+        m_mesh_mapped = false;
+        return;
+    }
+
     const auto& mesh_fac = m_repo.get_mesh_mapping_field(m_info->m_floc);
     const auto& mesh_detJ = m_repo.get_mesh_mapping_det_j(m_info->m_floc);
 
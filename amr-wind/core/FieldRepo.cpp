@@ -7,6 +7,7 @@ namespace amr_wind {
 LevelDataHolder::LevelDataHolder()
     : m_factory(new amrex::FArrayBoxFactory())
     , m_int_fact(new amrex::DefaultFabFactory<amrex::IArrayBox>())
+    , m_float_fact(new amrex::DefaultFabFactory<amrex::BaseFab<float>>())
 {}
 
 void FieldRepo::make_new_level_from_scratch(
@@ -22,6 +23,8 @@ void FieldRepo::make_new_level_from_scratch(
         ba, dm, *m_leveldata[lev], *(m_leveldata[lev]->m_factory));
     allocate_field_data(
         ba, dm, *m_leveldata[lev], *(m_leveldata[lev]->m_int_fact));
+    allocate_field_data(
+        ba, dm, *m_leveldata[lev], *(m_leveldata[lev]->m_float_fact));
 
     m_is_initialized = true;
 }
@@ -37,6 +40,7 @@ void FieldRepo::make_new_level_from_coarse(
 
     allocate_field_data(ba, dm, *ldata, *(ldata->m_factory));
     allocate_field_data(ba, dm, *ldata, *(ldata->m_int_fact));
+    allocate_field_data(ba, dm, *ldata, *(ldata->m_float_fact));
 
     for (auto& field : m_field_vec) {
         if (!field->fillpatch_on_regrid()) {
@@ -61,6 +65,7 @@ void FieldRepo::remake_level(
 
     allocate_field_data(ba, dm, *ldata, *(ldata->m_factory));
     allocate_field_data(ba, dm, *ldata, *(ldata->m_int_fact));
+    allocate_field_data(ba, dm, *ldata, *(ldata->m_float_fact));
 
     for (auto& field : m_field_vec) {
         if (!field->fillpatch_on_regrid()) {
@@ -299,6 +304,66 @@ bool FieldRepo::int_field_exists(
     return (found != m_int_fid_map.end());
 }
 
+FloatField& FieldRepo::declare_float_field(
+    const std::string& name,
+    const int ncomp,
+    const int ngrow,
+    const FieldLoc floc)
+{
+    BL_PROFILE("amr-wind::FieldRepo::declare_float_field");
+
+    // If the field is already registered check and return the fields
+    {
+        auto found = m_float_fid_map.find(name);
+        if (found != m_float_fid_map.end()) {
+            auto& field = *m_float_field_vec[found->second];
+
+            if ((ncomp != field.num_comp()) ||
+                (floc != field.field_location())) {
+                amrex::Abort(
+                    "Attempt to reregister field with inconsistent "
+                    "parameters: " +
+                    name);
+            }
+            return field;
+        }
+    }
+
+    if (!field_impl::is_valid_field_name(name) || field_exists(name) ||
+        int_field_exists(name)) {
+        amrex::Abort("Attempt to use reserved field name: " + name);
+    }
+
+    const int fid = static_cast<int>(m_float_field_vec.size());
+    std::unique_ptr<FloatField> field(
+        new FloatField(*this, name, fid, ncomp, ngrow, floc));
+
+    if (m_is_initialized) {
+        allocate_field_data(*field);
+    }
+
+    m_float_field_vec.emplace_back(std::move(field));
+    m_float_fid_map[name] = fid;
+
+    return *m_float_field_vec.back();
+}
+
+FloatField& FieldRepo::get_float_field(const std::string& name) const
+{
+    BL_PROFILE("amr-wind::FieldRepo::get_float_field");
+    const auto found = m_float_fid_map.find(name);
+    if (found == m_float_fid_map.end()) {
+        amrex::Abort("Cannot find field: " + name);
+        exit(1); // To appease the compiler
+    }
+    return *m_float_field_vec[found->second];
+}
+
+bool FieldRepo::float_field_exists(const std::string& name) const
+{
+    return (m_float_fid_map.find(name) != m_float_fid_map.end());
+}
+
 std::unique_ptr<ScratchField> FieldRepo::create_scratch_field(
     const std::string& name,
     const int ncomp,
@@ -493,6 +558,49 @@ void FieldRepo::allocate_field_data(const IntField& field)
     }
 }
 
+void FieldRepo::allocate_field_data(
+    const amrex::BoxArray& ba,
+    const amrex::DistributionMapping& dm,
+    LevelDataHolder& level_data,
+    const amrex::FabFactory<amrex::BaseFab<float>>& factory)
+{
+    auto& fab_vec = level_data.m_float_fabs;
+
+    for (auto& field : m_float_field_vec) {
+        auto ba1 =
+            amrex::convert(ba, field_impl::index_type(field->field_location()));
+
+        fab_vec.emplace_back(
+            ba1, dm, field->num_comp(), field->num_grow(), amrex::MFInfo(),
+            factory);
+
+        fab_vec.back().setVal(0.0F);
+    }
+}
+
+void FieldRepo::allocate_field_data(
+    int lev, const FloatField& field, LevelDataHolder& level_data)
+{
+    auto& fab_vec = level_data.m_float_fabs;
+    AMREX_ASSERT(fab_vec.size() == field.id());
+
+    const auto ba = amrex::convert(
+        m_mesh.boxArray(lev), field_impl::index_type(field.field_location()));
+
+    fab_vec.emplace_back(
+        ba, m_mesh.DistributionMap(lev), field.num_comp(), field.num_grow(),
+        amrex::MFInfo(), *level_data.m_float_fact);
+
+    fab_vec.back().setVal(0.0F);
+}
+
+void FieldRepo::allocate_field_data(const FloatField& field)
+{
+    for (int lev = 0; lev <= m_mesh.finestLevel(); ++lev) {
+        allocate_field_data(lev, field, *m_leveldata[lev]);
+    }
+}
+
 Field& FieldRepo::create_state(Field& infield, const FieldState fstate)
 {
     BL_PROFILE("amr-wind::FieldRepo::create_state");
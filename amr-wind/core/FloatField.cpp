@@ -0,0 +1,113 @@
+#include <utility>
+
+#include "amr-wind/core/FloatField.H"
+#include "amr-wind/core/FieldRepo.H"
+
+namespace amr_wind {
+
+FloatField::FloatField(
+    FieldRepo& repo,
+    std::string name,
+    const unsigned fid,
+    const int ncomp,
+    const int ngrow,
+    const FieldLoc floc)
+    : m_repo(repo)
+    , m_name(std::move(name))
+    , m_id(fid)
+    , m_ncomp(ncomp)
+    , m_ngrow(ngrow)
+    , m_floc(floc)
+{}
+
+FloatMultiFab& FloatField::operator()(int lev) noexcept
+{
+    AMREX_ASSERT(lev < m_repo.num_active_levels());
+    return m_repo.get_float_fab(m_id, lev);
+}
+
+const FloatMultiFab& FloatField::operator()(int lev) const noexcept
+{
+    AMREX_ASSERT(lev < m_repo.num_active_levels());
+    return m_repo.get_float_fab(m_id, lev);
+}
+
+amrex::Vector<FloatMultiFab*> FloatField::vec_ptrs() noexcept
+{
+    const int nlevels = m_repo.num_active_levels();
+    amrex::Vector<FloatMultiFab*> ret;
+    ret.reserve(nlevels);
+    for (int lev = 0; lev < nlevels; ++lev) {
+        ret.push_back(&m_repo.get_float_fab(m_id, lev));
+    }
+    return ret;
+}
+
+amrex::Vector<const FloatMultiFab*> FloatField::vec_const_ptrs() const noexcept
+{
+    const int nlevels = m_repo.num_active_levels();
+    amrex::Vector<const FloatMultiFab*> ret;
+    ret.reserve(nlevels);
+    for (int lev = 0; lev < nlevels; ++lev) {
+        ret.push_back(
+            static_cast<const FloatMultiFab*>(
+                &m_repo.get_float_fab(m_id, lev)));
+    }
+    return ret;
+}
+
+void FloatField::setVal(amrex::Real value) noexcept
+{
+    BL_PROFILE("amr-wind::FloatField::setVal 1");
+    for (int lev = 0; lev < m_repo.num_active_levels(); ++lev) {
+        operator()(lev).setVal(static_cast<float>(value));
+    }
+}
+
+void FloatField::setVal(
+    amrex::Real value, int start_comp, int num_comp, int nghost) noexcept
+{
+    BL_PROFILE("amr-wind::FloatField::setVal 2");
+    for (int lev = 0; lev < m_repo.num_active_levels(); ++lev) {
+        operator()(lev).setVal(
+            static_cast<float>(value), start_comp, num_comp, nghost);
+    }
+}
+
+void FloatField::copy_to(
+    int lev, amrex::MultiFab& dst, int dcomp, int nghost) const
+{
+    BL_PROFILE("amr-wind::FloatField::copy_to");
+    const auto& src = operator()(lev);
+    AMREX_ASSERT(dst.boxArray() == src.boxArray());
+    AMREX_ASSERT(dst.DistributionMap() == src.DistributionMap());
+    const auto& sarrs = src.const_arrays();
+    const auto& darrs = dst.arrays();
+    amrex::ParallelFor(
+        dst, amrex::IntVect(nghost), m_ncomp,
+        [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k, int n) noexcept {
+            darrs[nbx](i, j, k, dcomp + n) =
+                static_cast<amrex::Real>(sarrs[nbx](i, j, k, n));
+        });
+    amrex::Gpu::streamSynchronize();
+}
+
+void FloatField::copy_from(
+    int lev, const amrex::MultiFab& src, int scomp, int nghost)
+{
+    BL_PROFILE("amr-wind::FloatField::copy_from");
+    auto& dst = operator()(lev);
+    AMREX_ASSERT(dst.boxArray() == src.boxArray());
+    AMREX_ASSERT(dst.DistributionMap() == src.DistributionMap());
+    const auto& sarrs = src.const_arrays();
+    const auto& darrs = dst.arrays();
+    amrex::ParallelFor(
+        dst, amrex::IntVect(nghost), m_ncomp,
+        [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k, int n) noexcept {
+            darrs[nbx](i, j, k, n) =
+                static_cast<float>(sarrs[nbx](i, j, k, scomp + n));
+        });
+    amrex::Gpu::streamSynchronize();
+}
+
+} // namespace amr_wind
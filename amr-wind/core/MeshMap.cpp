@@ -1,3 +1,5 @@
+#include <utility>
+
 #include "amr-wind/core/MeshMap.H"
 #include "amr-wind/CFDSim.H"
 
@@ -5,12 +7,18 @@ namespace amr_wind {
 
 void MeshMap::declare_mapping_fields(const CFDSim& sim, int nghost)
 {
+    m_nghost = nghost;
+
+    // The cell and face fields are declared for separable maps as well, since
+    // they are read as MultiFabs by the diffusion operators
+    // (incflo_diffusion.cpp, icns_diffusion.H, DiffusionOps.cpp), the nodal
+    // projection and the icns advection.
+    // TODO: Compose these from separable_view() in those consumers and only
+    // declare the 3-D fields for general maps
 
-    // declare nodal, cell-centered, and face-centered mesh mapping array
+    // declare cell-centered and face-centered mesh mapping array
     m_mesh_scale_fac_cc = &(sim.repo().declare_cc_field(
         "mesh_scaling_factor_cc", AMREX_SPACEDIM, nghost, 1));
-    m_mesh_scale_fac_nd = &(sim.repo().declare_nd_field(
-        "mesh_scaling_factor_nd", AMREX_SPACEDIM, nghost, 1));
     m_mesh_scale_fac_xf = &(sim.repo().declare_xf_field(
         "mesh_scaling_factor_xf", AMREX_SPACEDIM, nghost, 1));
     m_mesh_scale_fac_yf = &(sim.repo().declare_yf_field(
@@ -18,11 +26,9 @@ void MeshMap::declare_mapping_fields(const CFDSim& sim, int nghost)
     m_mesh_scale_fac_zf = &(sim.repo().declare_zf_field(
         "mesh_scaling_factor_zf", AMREX_SPACEDIM, nghost, 1));
 
-    // declare nodal, cell-centered, and face-centered mesh mapping detJ array
+    // declare cell-centered and face-centered mesh mapping detJ array
     m_mesh_scale_detJ_cc =
         &(sim.repo().declare_cc_field("mesh_scaling_detJ_cc", 1, nghost, 1));
-    m_mesh_scale_detJ_nd =
-        &(sim.repo().declare_nd_field("mesh_scaling_detJ_nd", 1, nghost, 1));
     m_mesh_scale_detJ_xf =
         &(sim.repo().declare_xf_field("mesh_scaling_detJ_xf", 1, nghost, 1));
     m_mesh_scale_detJ_yf =
@@ -30,6 +36,15 @@ void MeshMap::declare_mapping_fields(const CFDSim& sim, int nghost)
     m_mesh_scale_detJ_zf =
         &(sim.repo().declare_zf_field("mesh_scaling_detJ_zf", 1, nghost, 1));
 
+    // nodal scaling is only used to transform nodal fields, which separable
+    // maps handle directly from the 1-D arrays
+    if (!is_separable()) {
+        m_mesh_scale_fac_nd = &(sim.repo().declare_nd_field(
+            "mesh_scaling_factor_nd", AMREX_SPACEDIM, nghost, 1));
+        m_mesh_scale_detJ_nd = &(
+            sim.repo().declare_nd_field("mesh_scaling_detJ_nd", 1, nghost, 1));
+    }
+
     // declare nodal and cell-centered non-uniform mesh
     m_non_uniform_coord_cc = &(sim.repo().declare_cc_field(
         "non_uniform_coord_cc", AMREX_SPACEDIM, nghost, 1));
@@ -39,4 +54,102 @@ void MeshMap::declare_mapping_fields(const CFDSim& sim, int nghost)
     // TODO: Create BCNoOP fill patch operators for mesh scaling fields ?
 }
 
+void MeshMap::allocate_separable_arrays(int lev, const amrex::Geometry& geom)
+{
+    if (lev >= static_cast<int>(m_offset_1d.size())) {
+        m_fac_cc_1d.resize(lev + 1);
+        m_fac_nd_1d.resize(lev + 1);
+        m_coord_cc_1d.resize(lev + 1);
+        m_coord_nd_1d.resize(lev + 1);
+        m_offset_1d.resize(lev + 1);
+    }
+
+    const auto& domain = geom.Domain();
+    m_offset_1d[lev] = domain.smallEnd() - amrex::IntVect(m_nghost);
+    for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+        const int ncells = domain.length(dir) + 2 * m_nghost;
+        m_fac_cc_1d[lev][dir].resize(ncells);
+        m_fac_nd_1d[lev][dir].resize(ncells + 1);
+        m_coord_cc_1d[lev][dir].resize(ncells);
+        m_coord_nd_1d[lev][dir].resize(ncells + 1);
+    }
+}
+
+SeparableMapView MeshMap::separable_view(int lev, FieldLoc floc) const
+{
+    AMREX_ALWAYS_ASSERT(is_separable());
+    AMREX_ASSERT(lev < static_cast<int>(m_offset_1d.size()));
+
+    SeparableMapView view;
+    for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+        const bool nodal =
+            (floc == FieldLoc::NODE) ||
+            ((floc == FieldLoc::XFACE) && (dir == 0)) ||
+            ((floc == FieldLoc::YFACE) && (dir == 1)) ||
+            ((floc == FieldLoc::ZFACE) && (dir == 2));
+        view.fac[dir] = nodal ? m_fac_nd_1d[lev][dir].data()
+                              : m_fac_cc_1d[lev][dir].data();
+        view.offset[dir] = m_offset_1d[lev][dir];
+        view.lo[dir] = m_offset_1d[lev][dir] + m_nghost;
+        view.hi[dir] = view.lo[dir] +
+                       static_cast<int>(m_fac_cc_1d[lev][dir].size()) -
+                       2 * m_nghost - (nodal ? 0 : 1);
+    }
+    return view;
+}
+
+void MeshMap::materialize_separable_fields(
+    int lev, const amrex::Geometry& geom)
+{
+    const amrex::Array<std::pair<Field*, Field*>, 5> fac_fields{
+        {{m_mesh_scale_fac_cc, m_mesh_scale_detJ_cc},
+         {m_mesh_scale_fac_nd, m_mesh_scale_detJ_nd},
+         {m_mesh_scale_fac_xf, m_mesh_scale_detJ_xf},
+         {m_mesh_scale_fac_yf, m_mesh_scale_detJ_yf},
+         {m_mesh_scale_fac_zf, m_mesh_scale_detJ_zf}}};
+
+    for (const auto& [fac_fld, detj_fld] : fac_fields) {
+        if (fac_fld == nullptr) {
+            continue;
+        }
+        const auto view = separable_view(lev, fac_fld->field_location());
+        const auto& fac_arrs = (*fac_fld)(lev).arrays();
+        const auto& detj_arrs = (*detj_fld)(lev).arrays();
+        amrex::ParallelFor(
+            (*fac_fld)(lev), fac_fld->num_grow(),
+            [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
+                for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+                    fac_arrs[nbx](i, j, k, n) = view(i, j, k, n);
+                }
+                detj_arrs[nbx](i, j, k) = view.det_j(i, j, k);
+            });
+    }
+
+    // Non-uniform coordinates revert to the uniform ones outside the domain
+    const auto& dx = geom.CellSizeArray();
+    const auto& prob_lo = geom.ProbLoArray();
+    auto fill_coords = [&](Field& coord_fld, const auto& coord_1d) {
+        const auto view = separable_view(lev, coord_fld.field_location());
+        const amrex::Real shift =
+            (coord_fld.field_location() == FieldLoc::NODE) ? 0.0 : 0.5;
+        const amrex::GpuArray<const amrex::Real*, AMREX_SPACEDIM> coord{
+            coord_1d[0].data(), coord_1d[1].data(), coord_1d[2].data()};
+        const auto& coord_arrs = coord_fld(lev).arrays();
+        amrex::ParallelFor(
+            coord_fld(lev), coord_fld.num_grow(),
+            [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
+                const bool in_domain = view.in_domain(i, j, k);
+                const amrex::IntVect iv{i, j, k};
+                for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+                    coord_arrs[nbx](i, j, k, n) =
+                        in_domain ? coord[n][iv[n] - view.offset[n]]
+                                  : prob_lo[n] + (iv[n] + shift) * dx[n];
+                }
+            });
+    };
+    fill_coords(*m_non_uniform_coord_cc, m_coord_cc_1d[lev]);
+    fill_coords(*m_non_uniform_coord_nd, m_coord_nd_1d[lev]);
+    amrex::Gpu::streamSynchronize();
+}
+
 } // namespace amr_wind
@@ -1,5 +1,6 @@
 #include "amr-wind/equation_systems/PDEBase.H"
 #include "amr-wind/equation_systems/SchemeTraits.H"
+#include "amr-wind/equation_systems/ScalarAdvectionGroup.H"
 #include "amr-wind/CFDSim.H"
 #include "amr-wind/core/FieldRepo.H"
 #include "amr-wind/equation_systems/PDEHelpers.H"
@@ -26,6 +27,7 @@ PDEMgr::PDEMgr(CFDSim& sim) : m_sim(sim)
     amrex::ParmParse pp("incflo");
     pp.query("use_godunov", m_use_godunov);
     pp.query("constant_density", m_constant_density);
+    pp.query("group_scalar_advection", m_group_scalar_advection);
 
     bool is_anelastic = false;
     {
@@ -46,6 +48,8 @@ PDEMgr::PDEMgr(CFDSim& sim) : m_sim(sim)
         m_use_godunov ? fvm::Godunov::scheme_name() : fvm::MOL::scheme_name();
 }
 
+PDEMgr::~PDEMgr() = default;
+
 PDEBase& PDEMgr::register_icns()
 {
     const std::string name = "ICNS-" + m_scheme;
@@ -211,6 +215,67 @@ void PDEMgr::density_check()
     }
 }
 
+void PDEMgr::init_advection_groups()
+{
+    auto& eqns = scalar_eqns();
+    const int neqns = static_cast<int>(eqns.size());
+    m_adv_groups.clear();
+    m_adv_grouped.assign(neqns, 0);
+    if (!m_use_godunov || !m_group_scalar_advection) {
+        return;
+    }
+
+    amrex::Vector<std::unique_ptr<ScalarAdvectionGroup>> groups;
+    amrex::Vector<amrex::Vector<int>> members;
+    for (int i = 0; i < neqns; ++i) {
+        bool added = false;
+        for (int ig = 0; (ig < static_cast<int>(groups.size())) && !added;
+             ++ig) {
+            if (eqns[i]->add_to_advection_group(*groups[ig])) {
+                members[ig].push_back(i);
+                added = true;
+            }
+        }
+        if (!added) {
+            auto group = std::make_unique<ScalarAdvectionGroup>(m_sim.repo());
+            if (eqns[i]->add_to_advection_group(*group)) {
+                groups.push_back(std::move(group));
+                members.push_back({i});
+            }
+        }
+    }
+
+    // An equation alone in its group is advected on its own, which avoids
+    // copying its state into the combined arrays
+    for (int ig = 0; ig < static_cast<int>(groups.size()); ++ig) {
+        if (groups[ig]->num_equations() < 2) {
+            continue;
+        }
+        amrex::Print() << "Advecting scalars together:";
+        for (const int i : members[ig]) {
+            m_adv_grouped[i] = 1;
+            amrex::Print() << " " << eqns[i]->fields().field.base_name();
+        }
+        amrex::Print() << std::endl;
+        m_adv_groups.push_back(std::move(groups[ig]));
+    }
+}
+
+void PDEMgr::compute_scalar_advection(const FieldState fstate)
+{
+    auto& eqns = scalar_eqns();
+    for (int i = 0; i < static_cast<int>(eqns.size()); ++i) {
+        if ((i >= static_cast<int>(m_adv_grouped.size())) ||
+            (m_adv_grouped[i] == 0)) {
+            eqns[i]->compute_advection_term(fstate);
+        }
+    }
+
+    for (auto& group : m_adv_groups) {
+        (*group)(fstate, m_sim.time().delta_t());
+    }
+}
+
 void PDEMgr::fillpatch_state_fields(
     const amrex::Real time, const FieldState fstate)
 {
@@ -0,0 +1,206 @@
+#include "amr-wind/equation_systems/ScalarAdvectionGroup.H"
+#include "amr-wind/equation_systems/PDEFields.H"
+#include "amr-wind/equation_systems/SchemeTraits.H"
+#include "amr-wind/core/FieldRepo.H"
+#include "amr-wind/utilities/PerfMonitor.H"
+
+#include "AMReX_MultiFabUtil.H"
+#include "hydro_utils.H"
+
+namespace amr_wind::pde {
+
+ScalarAdvectionGroup::ScalarAdvectionGroup(FieldRepo& repo)
+    : m_repo(repo)
+    , m_density(repo.get_field("density"))
+    , m_u_mac(repo.get_field("u_mac"))
+    , m_v_mac(repo.get_field("v_mac"))
+    , m_w_mac(repo.get_field("w_mac"))
+{}
+
+bool ScalarAdvectionGroup::add(
+    PDEFields& fields, const bool multiply_rho, const GodunovSettings& settings)
+{
+    if (m_fields.empty()) {
+        m_settings = settings;
+    } else if (!(settings == m_settings)) {
+        return false;
+    }
+
+    const int ncomp = fields.field.num_comp();
+    m_fields.push_back(&fields);
+    m_multiply_rho.push_back(multiply_rho ? 1 : 0);
+    m_offsets.push_back(m_ncomp);
+    m_ncomp += ncomp;
+
+    const auto& bcrec = fields.field.bcrec();
+    m_bcrec.insert(m_bcrec.end(), bcrec.begin(), bcrec.end());
+    m_bcrec_d.resize(m_bcrec.size());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, m_bcrec.begin(), m_bcrec.end(),
+        m_bcrec_d.begin());
+    m_iconserv.resize(m_ncomp, 1);
+    return true;
+}
+
+void ScalarAdvectionGroup::operator()(
+    const FieldState fstate, const amrex::Real dt)
+{
+    AMR_WIND_PROFILE("amr-wind::ScalarAdvectionGroup");
+
+    const int ncomp = m_ncomp;
+    const int neqns = num_equations();
+    const auto& geom = m_repo.mesh().Geom();
+
+    auto flux_x =
+        m_repo.create_scratch_field(ncomp, 0, amr_wind::FieldLoc::XFACE);
+    auto flux_y =
+        m_repo.create_scratch_field(ncomp, 0, amr_wind::FieldLoc::YFACE);
+    auto flux_z =
+        m_repo.create_scratch_field(ncomp, 0, amr_wind::FieldLoc::ZFACE);
+    auto face_x =
+        m_repo.create_scratch_field(ncomp, 0, amr_wind::FieldLoc::XFACE);
+    auto face_y =
+        m_repo.create_scratch_field(ncomp, 0, amr_wind::FieldLoc::YFACE);
+    auto face_z =
+        m_repo.create_scratch_field(ncomp, 0, amr_wind::FieldLoc::ZFACE);
+
+    const auto& den = m_density.state(fstate);
+    const auto& den_nph = m_density.state(amr_wind::FieldState::NPH);
+
+    const auto godunov_scheme = m_settings.scheme;
+    const bool godunov_use_ppm =
+        ((godunov_scheme != godunov::scheme::PLM) &&
+         (godunov_scheme != godunov::scheme::BDS));
+    int limiter_type;
+    if (godunov_scheme == godunov::scheme::PPM_NOLIM) {
+        limiter_type = PPM::NoLimiter;
+    } else if (godunov_scheme == godunov::scheme::WENOZ) {
+        limiter_type = PPM::WENOZ;
+    } else if (godunov_scheme == godunov::scheme::WENO_JS) {
+        limiter_type = PPM::WENO_JS;
+    } else {
+        limiter_type = PPM::default_limiter;
+    }
+
+    // if state is NPH, then n and n+1 are known, and only spatial
+    // extrapolation is performed
+    const amrex::Real dt_extrap = (fstate == FieldState::NPH) ? 0.0 : dt;
+    const bool is_velocity = false;
+    const bool known_edge_state = false;
+    const bool fluxes_are_area_weighted = false;
+
+    for (int lev = 0; lev < m_repo.num_active_levels(); ++lev) {
+        amrex::MFItInfo mfi_info;
+        if (amrex::Gpu::notInLaunchRegion()) {
+            mfi_info.EnableTiling(amrex::IntVect(1024, 1024, 1024))
+                .SetDynamic(true);
+        }
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+        for (amrex::MFIter mfi(den(lev), mfi_info); mfi.isValid(); ++mfi) {
+            const auto& bx = mfi.tilebox();
+            const auto state_box = amrex::grow(bx, fvm::Godunov::nghost_state);
+            const auto src_box = amrex::grow(bx, fvm::Godunov::nghost_src);
+            const auto& rho_arr = den(lev).const_array(mfi);
+            const auto& rho_nph_arr = den_nph(lev).const_array(mfi);
+
+            // Pack the (density weighted) states and the source terms of all
+            // equations into multi-component arrays
+            amrex::FArrayBox trac_fab(
+                state_box, ncomp, amrex::The_Async_Arena());
+            amrex::FArrayBox trac_nph_fab(
+                state_box, ncomp, amrex::The_Async_Arena());
+            amrex::FArrayBox src_fab(src_box, ncomp, amrex::The_Async_Arena());
+            const auto& trac = trac_fab.array();
+            const auto& trac_nph = trac_nph_fab.array();
+            const auto& src = src_fab.array();
+            for (int ieq = 0; ieq < neqns; ++ieq) {
+                const auto& fields = *m_fields[ieq];
+                const int offset = m_offsets[ieq];
+                const bool multiply_rho = (m_multiply_rho[ieq] != 0);
+                const auto& tra_arr =
+                    fields.field.state(fstate)(lev).const_array(mfi);
+                const auto& tra_nph_arr =
+                    fields.field.state(FieldState::NPH)(lev).const_array(mfi);
+                const auto& src_arr = fields.src_term(lev).const_array(mfi);
+                amrex::ParallelFor(
+                    state_box, fields.field.num_comp(),
+                    [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+                        const amrex::Real rho =
+                            multiply_rho ? rho_arr(i, j, k) : 1.0;
+                        const amrex::Real rho_nph =
+                            multiply_rho ? rho_nph_arr(i, j, k) : 1.0;
+                        trac(i, j, k, offset + n) = rho * tra_arr(i, j, k, n);
+                        trac_nph(i, j, k, offset + n) =
+                            rho_nph * tra_nph_arr(i, j, k, n);
+                        if (src_box.contains(i, j, k)) {
+                            src(i, j, k, offset + n) = src_arr(i, j, k, n);
+                        }
+                    });
+            }
+
+            amrex::FArrayBox tmpfab(
+                amrex::grow(bx, 1), 1, amrex::The_Async_Arena());
+            tmpfab.setVal<amrex::RunOn::Device>(0.0);
+            const auto& divu = tmpfab.array();
+
+            HydroUtils::ComputeFluxesOnBoxFromState(
+                bx, ncomp, mfi, trac, trac_nph, (*flux_x)(lev).array(mfi),
+                (*flux_y)(lev).array(mfi), (*flux_z)(lev).array(mfi),
+                (*face_x)(lev).array(mfi), (*face_y)(lev).array(mfi),
+                (*face_z)(lev).array(mfi), known_edge_state,
+                m_u_mac(lev).const_array(mfi), m_v_mac(lev).const_array(mfi),
+                m_w_mac(lev).const_array(mfi), divu, src, geom[lev],
+                dt_extrap, m_bcrec, m_bcrec_d.data(), m_iconserv.data(),
+                godunov_use_ppm, m_settings.use_forces_in_trans, is_velocity,
+                fluxes_are_area_weighted, m_settings.advection_type,
+                limiter_type, m_settings.allow_inflow_on_outflow);
+        }
+    }
+
+    amrex::Vector<amrex::Array<amrex::MultiFab*, AMREX_SPACEDIM>> fluxes(
+        m_repo.num_active_levels());
+    for (int lev = 0; lev < m_repo.num_active_levels(); ++lev) {
+        fluxes[lev][0] = &(*flux_x)(lev);
+        fluxes[lev][1] = &(*flux_y)(lev);
+        fluxes[lev][2] = &(*flux_z)(lev);
+    }
+
+    // In order to enforce conservation across coarse-fine boundaries we
+    // must be sure to average down the fluxes before we use them
+    for (int lev = m_repo.num_active_levels() - 1; lev > 0; --lev) {
+        amrex::IntVect rr =
+            geom[lev].Domain().size() / geom[lev - 1].Domain().size();
+        amrex::average_down_faces(
+            GetArrOfConstPtrs(fluxes[lev]), fluxes[lev - 1], rr,
+            geom[lev - 1]);
+    }
+
+    for (int lev = 0; lev < m_repo.num_active_levels(); ++lev) {
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+        for (amrex::MFIter mfi(den(lev), amrex::TilingIfNotGPU());
+             mfi.isValid(); ++mfi) {
+            const auto& bx = mfi.tilebox();
+            const auto& fx = (*flux_x)(lev).array(mfi);
+            const auto& fy = (*flux_y)(lev).array(mfi);
+            const auto& fz = (*flux_z)(lev).array(mfi);
+
+            for (int ieq = 0; ieq < neqns; ++ieq) {
+                auto& fields = *m_fields[ieq];
+                const int offset = m_offsets[ieq];
+                const int nc = fields.field.num_comp();
+                HydroUtils::ComputeDivergence(
+                    bx, fields.conv_term(lev).array(mfi),
+                    amrex::Array4<amrex::Real>(fx, offset, nc),
+                    amrex::Array4<amrex::Real>(fy, offset, nc),
+                    amrex::Array4<amrex::Real>(fz, offset, nc), nc, geom[lev],
+                    amrex::Real(-1.0), fluxes_are_area_weighted);
+            }
+        }
+    }
+}
+
+} // namespace amr_wind::pde
@@ -77,6 +77,55 @@ AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE void form_drag_calculations(
     Dxz += -tau_xz / dx[2];
     Dyz += -tau_yz / dx[2];
 }
+
+/** Disjoint boxes covering the cells of the active sponge layers
+ *
+ *  The layers are ordered as west, east, south and north. The boxes are
+ *  conservative, the damping vanishes in the cells of the boxes that are
+ *  outside of the sponge layers.
+ */
+amrex::Vector<amrex::Box> sponge_layer_boxes(
+    const amrex::Geometry& geom,
+    const amrex::GpuArray<amrex::Real, 4>& start,
+    const amrex::GpuArray<int, 4>& active)
+{
+    const auto& dx = geom.CellSizeArray();
+    const auto& prob_lo = geom.ProbLoArray();
+    const auto cell_index = [&](const amrex::Real x, const int dir) {
+        const amrex::Real xi = (x - prob_lo[dir]) / dx[dir] - 0.5;
+        return static_cast<int>(std::floor(amrex::max<amrex::Real>(
+            amrex::min<amrex::Real>(xi, geom.Domain().bigEnd(dir) + 1),
+            geom.Domain().smallEnd(dir) - 1)));
+    };
+
+    // Each layer is removed from the remaining region so that the layers
+    // at the corners of the domain are only visited once
+    amrex::Vector<amrex::Box> layers;
+    amrex::Box core = geom.Domain();
+    for (int n = 0; (n < 4) && core.ok(); ++n) {
+        if (active[n] == 0) {
+            continue;
+        }
+        const int dir = n / 2;
+        const int idx = cell_index(start[n], dir);
+        amrex::Box layer(core);
+        if (n % 2 == 0) {
+            layer.setBig(dir, amrex::min(idx + 1, core.bigEnd(dir)));
+        } else {
+            layer.setSmall(dir, amrex::max(idx, core.smallEnd(dir)));
+        }
+        if (!layer.ok()) {
+            continue;
+        }
+        layers.push_back(layer);
+        if (n % 2 == 0) {
+            core.setSmall(dir, layer.bigEnd(dir) + 1);
+        } else {
+            core.setBig(dir, layer.smallEnd(dir) - 1);
+        }
+    }
+    return layers;
+}
 } // namespace
 
 namespace amr_wind::pde::icns {
@@ -116,7 +165,7 @@ DragForcing::DragForcing(const CFDSim& sim)
         m_sponge_strength = 0.0;
     }
     if (phy_mgr.contains("OceanWaves") && !sim.repo().field_exists("vof")) {
-        const auto terrain_phys =
+        const auto& terrain_phys =
             m_sim.physics_manager().get<amr_wind::terraindrag::TerrainDrag>();
         const auto target_vel_name = terrain_phys.wave_velocity_field_name();
         m_target_vel = &sim.repo().get_field(target_vel_name);
@@ -128,6 +177,12 @@ DragForcing::DragForcing(const CFDSim& sim)
         // i.e., too small to be resolved with cell blanking
         pp.query("wave_model_inviscid_form_drag", m_apply_MOSD);
     }
+    if (phy_mgr.contains("TerrainDrag")) {
+        m_active_cells =
+            &m_sim.physics_manager()
+                 .get<amr_wind::terraindrag::TerrainDrag>()
+                 .active_cells();
+    }
     amrex::ParmParse pp_abl("ABL");
     pp_abl.query("wall_het_model", m_wall_het_model);
     pp_abl.query("monin_obukhov_length", m_monin_obukhov_length);
@@ -149,7 +204,7 @@ void DragForcing::operator()(
         m_velocity.state(field_impl::dof_state(fstate))(lev).const_array(mfi);
     const bool is_terrain =
         this->m_sim.repo().int_field_exists("terrain_blank");
-    if (!is_terrain) {
+    if (!is_terrain || (m_active_cells == nullptr)) {
         amrex::Abort("Need terrain blanking variable to use this source term");
     }
     auto* const m_terrain_blank =
@@ -158,7 +213,7 @@ void DragForcing::operator()(
     auto* const m_terrain_drag =
         &this->m_sim.repo().get_int_field("terrain_drag");
     const auto& drag = (*m_terrain_drag)(lev).const_array(mfi);
-    auto* const m_terrainz0 = &this->m_sim.repo().get_field("terrainz0");
+    auto* const m_terrainz0 = &this->m_sim.repo().get_float_field("terrainz0");
     const auto& terrainz0 = (*m_terrainz0)(lev).const_array(mfi);
 
     const bool is_waves = m_terrain_is_waves;
@@ -208,118 +263,157 @@ void DragForcing::operator()(
             ? MOData::calc_psi_m(
                   0.5 * dx[2] / m_monin_obukhov_length, m_beta_m, m_gamma_m)
             : 0.0;
-    amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-        const amrex::Real x = prob_lo[0] + (i + 0.5) * dx[0];
-        const amrex::Real y = prob_lo[1] + (j + 0.5) * dx[1];
-        const amrex::Real z = prob_lo[2] + (k + 0.5) * dx[2];
-        amrex::Real xstart_damping = 0;
-        amrex::Real ystart_damping = 0;
-        amrex::Real xend_damping = 0;
-        amrex::Real yend_damping = 0;
-        amrex::Real xi_end = (x - start_east) / (prob_hi[0] - start_east);
-        amrex::Real xi_start = (start_west - x) / (start_west - prob_lo[0]);
-        xi_start = sponge_west * std::max(xi_start, 0.0);
-        xi_end = sponge_east * std::max(xi_end, 0.0);
-        xstart_damping = sponge_west * sponge_strength * xi_start * xi_start;
-        xend_damping = sponge_east * sponge_strength * xi_end * xi_end;
-        amrex::Real yi_end = (y - start_north) / (prob_hi[1] - start_north);
-        amrex::Real yi_start = (start_south - y) / (start_south - prob_lo[1]);
-        yi_start = sponge_south * std::max(yi_start, 0.0);
-        yi_end = sponge_north * std::max(yi_end, 0.0);
-        ystart_damping = sponge_strength * yi_start * yi_start;
-        yend_damping = sponge_strength * yi_end * yi_end;
-        const amrex::Real ux1 = vel(i, j, k, 0);
-        const amrex::Real uy1 = vel(i, j, k, 1);
-        const amrex::Real uz1 = vel(i, j, k, 2);
-        const auto idx =
-            interp::bisection_search(device_vel_ht, device_vel_ht + vsize, z);
-        const amrex::Real spongeVelX =
-            (vsize > 0) ? interp::linear_impl(
-                              device_vel_ht, device_vel_vals, z, idx, 3, 0)
-                        : ux1;
-        const amrex::Real spongeVelY =
-            (vsize > 0) ? interp::linear_impl(
-                              device_vel_ht, device_vel_vals, z, idx, 3, 1)
-                        : uy1;
-        const amrex::Real spongeVelZ =
-            (vsize > 0) ? interp::linear_impl(
-                              device_vel_ht, device_vel_vals, z, idx, 3, 2)
-                        : uz1;
-        amrex::Real Dxz = 0.0;
-        amrex::Real Dyz = 0.0;
-        amrex::Real bc_forcing_x = 0;
-        amrex::Real bc_forcing_y = 0;
-        const amrex::Real m = std::sqrt(ux1 * ux1 + uy1 * uy1 + uz1 * uz1);
-        if (drag(i, j, k) == 1 && (!is_laminar)) {
-            // Check if close enough to interface to use current cell or below
-            int k_off = -1;
-            if (is_waves) {
-                const amrex::Real cell_length_2D =
-                    std::sqrt(dx[0] * dx[0] + dx[2] * dx[2]);
-                if (target_lvs_arr(i, j, k) + cell_length_2D >= 0) {
-                    // Current cell will be used for wave velocity
-                    k_off = 0;
+    // Sponge damping toward the plane-averaged velocity, only evaluated in
+    // the sponge layers
+    if (sponge_strength > 0.0) {
+        const auto layers = sponge_layer_boxes(
+            geom, {start_west, start_east, start_south, start_north},
+            {sponge_west, sponge_east, sponge_south, sponge_north});
+        for (const auto& layer : layers) {
+            const auto sbx = bx & layer;
+            if (sbx.isEmpty()) {
+                continue;
+            }
+            amrex::ParallelFor(
+                sbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                    const amrex::Real x = prob_lo[0] + (i + 0.5) * dx[0];
+                    const amrex::Real y = prob_lo[1] + (j + 0.5) * dx[1];
+                    const amrex::Real z = prob_lo[2] + (k + 0.5) * dx[2];
+                    amrex::Real xi_end =
+                        (x - start_east) / (prob_hi[0] - start_east);
+                    amrex::Real xi_start =
+                        (start_west - x) / (start_west - prob_lo[0]);
+                    xi_start = sponge_west * std::max(xi_start, 0.0);
+                    xi_end = sponge_east * std::max(xi_end, 0.0);
+                    const amrex::Real xstart_damping =
+                        sponge_west * sponge_strength * xi_start * xi_start;
+                    const amrex::Real xend_damping =
+                        sponge_east * sponge_strength * xi_end * xi_end;
+                    amrex::Real yi_end =
+                        (y - start_north) / (prob_hi[1] - start_north);
+                    amrex::Real yi_start =
+                        (start_south - y) / (start_south - prob_lo[1]);
+                    yi_start = sponge_south * std::max(yi_start, 0.0);
+                    yi_end = sponge_north * std::max(yi_end, 0.0);
+                    const amrex::Real ystart_damping =
+                        sponge_strength * yi_start * yi_start;
+                    const amrex::Real yend_damping =
+                        sponge_strength * yi_end * yi_end;
+                    const amrex::Real damping = xstart_damping + xend_damping +
+                                                ystart_damping + yend_damping;
+
+                    const amrex::Real ux1 = vel(i, j, k, 0);
+                    const amrex::Real uy1 = vel(i, j, k, 1);
+                    const amrex::Real uz1 = vel(i, j, k, 2);
+                    const auto idx = interp::bisection_search(
+                        device_vel_ht, device_vel_ht + vsize, z);
+                    const amrex::Real spongeVelX =
+                        (vsize > 0)
+                            ? interp::linear_impl(
+                                  device_vel_ht, device_vel_vals, z, idx, 3, 0)
+                            : ux1;
+                    const amrex::Real spongeVelY =
+                        (vsize > 0)
+                            ? interp::linear_impl(
+                                  device_vel_ht, device_vel_vals, z, idx, 3, 1)
+                            : uy1;
+                    const amrex::Real spongeVelZ =
+                        (vsize > 0)
+                            ? interp::linear_impl(
+                                  device_vel_ht, device_vel_vals, z, idx, 3, 2)
+                            : uz1;
+                    src_term(i, j, k, 0) -=
+                        damping * (ux1 - sponge_density * spongeVelX);
+                    src_term(i, j, k, 1) -=
+                        damping * (uy1 - sponge_density * spongeVelY);
+                    src_term(i, j, k, 2) -=
+                        damping * (uz1 - sponge_density * spongeVelZ);
+                });
+        }
+    }
+
+    // Immersed forcing and wall model, only evaluated in the cells within
+    // the terrain and in the drag layer above it
+    m_active_cells->ParallelFor(
+        lev, mfi, bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+            const amrex::Real ux1 = vel(i, j, k, 0);
+            const amrex::Real uy1 = vel(i, j, k, 1);
+            const amrex::Real uz1 = vel(i, j, k, 2);
+            amrex::Real Dxz = 0.0;
+            amrex::Real Dyz = 0.0;
+            amrex::Real bc_forcing_x = 0;
+            amrex::Real bc_forcing_y = 0;
+            const amrex::Real m = std::sqrt(ux1 * ux1 + uy1 * uy1 + uz1 * uz1);
+            if (drag(i, j, k) == 1 && (!is_laminar)) {
+                // Check if close enough to interface to use current cell or
+                // below
+                int k_off = -1;
+                if (is_waves) {
+                    const amrex::Real cell_length_2D =
+                        std::sqrt(dx[0] * dx[0] + dx[2] * dx[2]);
+                    if (target_lvs_arr(i, j, k) + cell_length_2D >= 0) {
+                        // Current cell will be used for wave velocity
+                        k_off = 0;
+                    }
+                    // Cell below will be used if not (default of -1)
+                }
+                // Establish wall velocity
+                // - estimate wave velocity using target velocity in cells
+                //   below
+                const amrex::Real wall_u =
+                    !is_waves ? 0.0 : target_vel_arr(i, j, k + k_off, 0);
+                const amrex::Real wall_v =
+                    !is_waves ? 0.0 : target_vel_arr(i, j, k + k_off, 1);
+                // Relative velocities for calculating shear
+                const amrex::Real ux1r = ux1 - wall_u;
+                const amrex::Real uy1r = uy1 - wall_v;
+                const amrex::Real ux2r = vel(i, j, k + 1, 0) - wall_u;
+                const amrex::Real uy2r = vel(i, j, k + 1, 1) - wall_v;
+                const amrex::Real z0 =
+                    std::max<amrex::Real>(terrainz0(i, j, k), z0_min);
+                const amrex::Real ustar = viscous_drag_calculations(
+                    Dxz, Dyz, ux1r, uy1r, ux2r, uy2r, z0, dx[2], kappa,
+                    non_neutral_neighbour);
+                if (model_form_drag) {
+                    form_drag_calculations(
+                        Dxz, Dyz, i, j, k, target_lvs_arr, dx, ux1r, uy1r);
                 }
-                // Cell below will be used if not (default of -1)
+                const amrex::Real uTarget =
+                    ustar / kappa *
+                    (std::log(0.5 * dx[2] / z0) - non_neutral_cell);
+                const amrex::Real uxTarget =
+                    uTarget * ux2r /
+                    (amr_wind::constants::EPS +
+                     std::sqrt(ux2r * ux2r + uy2r * uy2r));
+                const amrex::Real uyTarget =
+                    uTarget * uy2r /
+                    (amr_wind::constants::EPS +
+                     std::sqrt(ux2r * ux2r + uy2r * uy2r));
+                // BC forcing pushes nonrelative velocity toward target
+                // velocity
+                bc_forcing_x = -(uxTarget - ux1) / dt;
+                bc_forcing_y = -(uyTarget - uy1) / dt;
             }
-            // Establish wall velocity
-            // - estimate wave velocity using target velocity in cells below
-            const amrex::Real wall_u =
-                !is_waves ? 0.0 : target_vel_arr(i, j, k + k_off, 0);
-            const amrex::Real wall_v =
-                !is_waves ? 0.0 : target_vel_arr(i, j, k + k_off, 1);
-            // Relative velocities for calculating shear
-            const amrex::Real ux1r = ux1 - wall_u;
-            const amrex::Real uy1r = uy1 - wall_v;
-            const amrex::Real ux2r = vel(i, j, k + 1, 0) - wall_u;
-            const amrex::Real uy2r = vel(i, j, k + 1, 1) - wall_v;
-            const amrex::Real z0 = std::max(terrainz0(i, j, k), z0_min);
-            const amrex::Real ustar = viscous_drag_calculations(
-                Dxz, Dyz, ux1r, uy1r, ux2r, uy2r, z0, dx[2], kappa,
-                non_neutral_neighbour);
-            if (model_form_drag) {
-                form_drag_calculations(
-                    Dxz, Dyz, i, j, k, target_lvs_arr, dx, ux1r, uy1r);
+            // Target velocity intended for within terrain
+            amrex::Real target_u = 0.;
+            amrex::Real target_v = 0.;
+            amrex::Real target_w = 0.;
+            if (is_waves) {
+                target_u = target_vel_arr(i, j, k, 0);
+                target_v = target_vel_arr(i, j, k, 1);
+                target_w = target_vel_arr(i, j, k, 2);
             }
-            const amrex::Real uTarget =
-                ustar / kappa * (std::log(0.5 * dx[2] / z0) - non_neutral_cell);
-            const amrex::Real uxTarget = uTarget * ux2r /
-                                         (amr_wind::constants::EPS +
-                                          std::sqrt(ux2r * ux2r + uy2r * uy2r));
-            const amrex::Real uyTarget = uTarget * uy2r /
-                                         (amr_wind::constants::EPS +
-                                          std::sqrt(ux2r * ux2r + uy2r * uy2r));
-            // BC forcing pushes nonrelative velocity toward target velocity
-            bc_forcing_x = -(uxTarget - ux1) / dt;
-            bc_forcing_y = -(uyTarget - uy1) / dt;
-        }
-        // Target velocity intended for within terrain
-        amrex::Real target_u = 0.;
-        amrex::Real target_v = 0.;
-        amrex::Real target_w = 0.;
-        if (is_waves) {
-            target_u = target_vel_arr(i, j, k, 0);
-            target_v = target_vel_arr(i, j, k, 1);
-            target_w = target_vel_arr(i, j, k, 2);
-        }
 
-        const amrex::Real CdM = std::min(
-            Cd / (m + amr_wind::constants::EPS), cd_max / scale_factor);
-        src_term(i, j, k, 0) -=
-            (CdM * m * (ux1 - target_u) * blank(i, j, k) + Dxz * drag(i, j, k) +
-             bc_forcing_x * drag(i, j, k) +
-             (xstart_damping + xend_damping + ystart_damping + yend_damping) *
-                 (ux1 - sponge_density * spongeVelX));
-        src_term(i, j, k, 1) -=
-            (CdM * m * (uy1 - target_v) * blank(i, j, k) + Dyz * drag(i, j, k) +
-             bc_forcing_y * drag(i, j, k) +
-             (xstart_damping + xend_damping + ystart_damping + yend_damping) *
-                 (uy1 - sponge_density * spongeVelY));
-        src_term(i, j, k, 2) -=
-            (CdM * m * (uz1 - target_w) * blank(i, j, k) +
-             (xstart_damping + xend_damping + ystart_damping + yend_damping) *
-                 (uz1 - sponge_density * spongeVelZ));
-    });
+            const amrex::Real CdM = std::min(
+                Cd / (m + amr_wind::constants::EPS), cd_max / scale_factor);
+            src_term(i, j, k, 0) -=
+                (CdM * m * (ux1 - target_u) * blank(i, j, k) +
+                 Dxz * drag(i, j, k) + bc_forcing_x * drag(i, j, k));
+            src_term(i, j, k, 1) -=
+                (CdM * m * (uy1 - target_v) * blank(i, j, k) +
+                 Dyz * drag(i, j, k) + bc_forcing_y * drag(i, j, k));
+            src_term(i, j, k, 2) -= CdM * m * (uz1 - target_w) * blank(i, j, k);
+        });
 }
 
 } // namespace amr_wind::pde::icns
@@ -4,12 +4,19 @@
 #include "AMReX_Gpu.H"
 #include "AMReX_Random.H"
 #include "amr-wind/wind_energy/ABL.H"
+#include "amr-wind/physics/ForestDrag.H"
 
 namespace amr_wind::pde::icns {
 
 ForestForcing::ForestForcing(const CFDSim& sim)
     : m_sim(sim), m_velocity(sim.repo().get_field("velocity"))
-{}
+{
+    if (m_sim.physics_manager().contains("ForestDrag")) {
+        m_active_cells = &m_sim.physics_manager()
+                              .get<amr_wind::forestdrag::ForestDrag>()
+                              .active_cells();
+    }
+}
 
 ForestForcing::~ForestForcing() = default;
 
@@ -22,21 +29,27 @@ void ForestForcing::operator()(
 {
     const auto& vel =
         m_velocity.state(field_impl::dof_state(fstate))(lev).const_array(mfi);
-    const bool has_forest = this->m_sim.repo().field_exists("forest_drag");
-    if (!has_forest) {
+    const bool has_forest =
+        this->m_sim.repo().float_field_exists("forest_drag");
+    if (!has_forest || (m_active_cells == nullptr)) {
         amrex::Abort("Need a forest to use this source term");
     }
-    auto* const m_forest_drag = &this->m_sim.repo().get_field("forest_drag");
+    auto* const m_forest_drag =
+        &this->m_sim.repo().get_float_field("forest_drag");
+    // Single-precision drag coefficient, widened on load
     const auto& forest_drag = (*m_forest_drag)(lev).const_array(mfi);
-    amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-        const amrex::Real ux = vel(i, j, k, 0);
-        const amrex::Real uy = vel(i, j, k, 1);
-        const amrex::Real uz = vel(i, j, k, 2);
-        const amrex::Real windspeed = std::sqrt(ux * ux + uy * uy + uz * uz);
-        src_term(i, j, k, 0) -= forest_drag(i, j, k) * ux * windspeed;
-        src_term(i, j, k, 1) -= forest_drag(i, j, k) * uy * windspeed;
-        src_term(i, j, k, 2) -= forest_drag(i, j, k) * uz * windspeed;
-    });
+    // Only the cells within the canopy are visited
+    m_active_cells->ParallelFor(
+        lev, mfi, bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+            const amrex::Real ux = vel(i, j, k, 0);
+            const amrex::Real uy = vel(i, j, k, 1);
+            const amrex::Real uz = vel(i, j, k, 2);
+            const amrex::Real windspeed =
+                std::sqrt(ux * ux + uy * uy + uz * uz);
+            src_term(i, j, k, 0) -= forest_drag(i, j, k) * ux * windspeed;
+            src_term(i, j, k, 1) -= forest_drag(i, j, k) * uy * windspeed;
+            src_term(i, j, k, 2) -= forest_drag(i, j, k) * uz * windspeed;
+        });
 }
 
 } // namespace amr_wind::pde::icns
@@ -92,10 +92,11 @@ void MetMastForcing::operator()(
     const auto* u_values_d = m_u_values_d.data();
     const auto* v_values_d = m_v_values_d.data();
     const auto* w_values_d = m_w_values_d.data();
-    const bool has_terrain = this->m_sim.repo().field_exists("terrain_height");
+    const bool has_terrain =
+        this->m_sim.repo().float_field_exists("terrain_height");
     if (has_terrain) {
         auto* const m_terrain_height =
-            &this->m_sim.repo().get_field("terrain_height");
+            &this->m_sim.repo().get_float_field("terrain_height");
         const auto& terrain_height = (*m_terrain_height)(lev).const_array(mfi);
         amrex::ParallelFor(
             bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
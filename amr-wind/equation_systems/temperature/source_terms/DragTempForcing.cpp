@@ -2,6 +2,7 @@
 #include "amr-wind/equation_systems/temperature/source_terms/DragTempForcing.H"
 #include "amr-wind/utilities/IOManager.H"
 #include "amr-wind/wind_energy/MOData.H"
+#include "amr-wind/physics/TerrainDrag.H"
 
 #include "AMReX_ParmParse.H"
 #include "AMReX_Gpu.H"
@@ -31,6 +32,11 @@ DragTempForcing::DragTempForcing(const CFDSim& sim)
         amrex::ParmParse pp_incflow("incflo");
         pp_incflow.queryarr("gravity", m_gravity);
     }
+    if (m_sim.physics_manager().contains("TerrainDrag")) {
+        m_active_cells = &m_sim.physics_manager()
+                              .get<amr_wind::terraindrag::TerrainDrag>()
+                              .active_cells();
+    }
 }
 
 DragTempForcing::~DragTempForcing() = default;
@@ -49,7 +55,7 @@ void DragTempForcing::operator()(
             mfi);
     const bool is_terrain =
         this->m_sim.repo().int_field_exists("terrain_blank");
-    if (!is_terrain) {
+    if (!is_terrain || (m_active_cells == nullptr)) {
         amrex::Abort("Need terrain blanking variable to use this source term");
     }
     auto* const m_terrain_blank =
@@ -58,7 +64,7 @@ void DragTempForcing::operator()(
     auto* const m_terrain_drag =
         &this->m_sim.repo().get_int_field("terrain_drag");
     const auto& drag = (*m_terrain_drag)(lev).const_array(mfi);
-    auto* const m_terrainz0 = &this->m_sim.repo().get_field("terrainz0");
+    auto* const m_terrainz0 = &this->m_sim.repo().get_float_field("terrainz0");
     const auto& terrainz0 = (*m_terrainz0)(lev).const_array(mfi);
     const auto& geom = m_mesh.Geom(lev);
     const auto& dx = geom.CellSizeArray();
@@ -86,34 +92,37 @@ void DragTempForcing::operator()(
     const auto tiny = std::numeric_limits<amrex::Real>::epsilon();
     const amrex::Real cd_max = 10.0;
     const amrex::Real T0 = m_soil_temperature;
-    amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-        const amrex::Real z0 = std::max(terrainz0(i, j, k), z0_min);
-        const amrex::Real ux1 = vel(i, j, k, 0);
-        const amrex::Real uy1 = vel(i, j, k, 1);
-        const amrex::Real uz1 = vel(i, j, k, 2);
-        const amrex::Real theta = temperature(i, j, k, 0);
-        const amrex::Real theta2 = temperature(i, j, k + 1, 0);
-        const amrex::Real wspd = std::sqrt(ux1 * ux1 + uy1 * uy1);
-        const amrex::Real ustar =
-            wspd * kappa / (std::log(1.5 * dx[2] / z0) - psi_m);
-        //! We do not know the actual temperature so use cell above
-        const amrex::Real thetastar =
-            theta * ustar * ustar /
-            (kappa * gravity_mod * monin_obukhov_length);
-        const amrex::Real surf_temp =
-            theta2 -
-            thetastar / kappa * (std::log(1.5 * dx[2] / z0) - psi_h_neighbour);
-        const amrex::Real tTarget =
-            surf_temp +
-            thetastar / kappa * (std::log(0.5 * dx[2] / z0) - psi_h_cell);
-        const amrex::Real bc_forcing_t = -(tTarget - theta) / dt;
-        const amrex::Real m = std::sqrt(ux1 * ux1 + uy1 * uy1 + uz1 * uz1);
-        const amrex::Real Cd =
-            std::min(drag_coefficient / (m + tiny), cd_max / dx[2]);
-        src_term(i, j, k, 0) -=
-            (Cd * (theta - T0) * blank(i, j, k, 0) +
-             bc_forcing_t * drag(i, j, k));
-    });
+    // The forcing vanishes outside of the terrain and the drag layer
+    m_active_cells->ParallelFor(
+        lev, mfi, bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+            const amrex::Real z0 =
+                std::max<amrex::Real>(terrainz0(i, j, k), z0_min);
+            const amrex::Real ux1 = vel(i, j, k, 0);
+            const amrex::Real uy1 = vel(i, j, k, 1);
+            const amrex::Real uz1 = vel(i, j, k, 2);
+            const amrex::Real theta = temperature(i, j, k, 0);
+            const amrex::Real theta2 = temperature(i, j, k + 1, 0);
+            const amrex::Real wspd = std::sqrt(ux1 * ux1 + uy1 * uy1);
+            const amrex::Real ustar =
+                wspd * kappa / (std::log(1.5 * dx[2] / z0) - psi_m);
+            //! We do not know the actual temperature so use cell above
+            const amrex::Real thetastar =
+                theta * ustar * ustar /
+                (kappa * gravity_mod * monin_obukhov_length);
+            const amrex::Real surf_temp =
+                theta2 - thetastar / kappa *
+                             (std::log(1.5 * dx[2] / z0) - psi_h_neighbour);
+            const amrex::Real tTarget =
+                surf_temp +
+                thetastar / kappa * (std::log(0.5 * dx[2] / z0) - psi_h_cell);
+            const amrex::Real bc_forcing_t = -(tTarget - theta) / dt;
+            const amrex::Real m = std::sqrt(ux1 * ux1 + uy1 * uy1 + uz1 * uz1);
+            const amrex::Real Cd =
+                std::min(drag_coefficient / (m + tiny), cd_max / dx[2]);
+            src_term(i, j, k, 0) -=
+                (Cd * (theta - T0) * blank(i, j, k, 0) +
+                 bc_forcing_t * drag(i, j, k));
+        });
 }
 
 } // namespace amr_wind::pde::temperature
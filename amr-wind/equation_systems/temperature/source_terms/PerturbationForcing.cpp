@@ -43,11 +43,11 @@ void PerturbationForcing::operator()(
                                     ? (*m_terrain_blank)(lev).const_array(mfi)
                                     : amrex::Array4<int>();
         const auto* m_terrain_height =
-            has_terrain ? &this->m_sim.repo().get_field("terrain_height")
+            has_terrain ? &this->m_sim.repo().get_float_field("terrain_height")
                         : nullptr;
         const auto& height_arr = has_terrain
                                      ? (*m_terrain_height)(lev).const_array(mfi)
-                                     : amrex::Array4<double>();
+                                     : amrex::Array4<const float>();
         const auto& geom = m_mesh.Geom(lev);
         const auto& dx = geom.CellSizeArray();
         const auto& prob_lo = geom.ProbLoArray();
@@ -65,13 +65,14 @@ void TemperatureFreeAtmosphereForcing::operator()(
     const auto vsize = m_theta_heights_d.size();
     const auto* theta_heights_d = m_theta_heights_d.data();
     const auto* theta_values_d = m_theta_values_d.data();
-    const bool has_terrain = this->m_sim.repo().field_exists("terrain_height");
+    const bool has_terrain =
+        this->m_sim.repo().float_field_exists("terrain_height");
     auto* const m_terrain_height =
-        (has_terrain) ? &this->m_sim.repo().get_field("terrain_height")
+        (has_terrain) ? &this->m_sim.repo().get_float_field("terrain_height")
                       : nullptr;
     const auto& terrain_height = (has_terrain)
                                      ? (*m_terrain_height)(lev).const_array(mfi)
-                                     : amrex::Array4<double>();
+                                     : amrex::Array4<const float>();
     amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
         const amrex::Real cell_terrain_height =
             (has_terrain) ? terrain_height(i, j, k) : 0.0;
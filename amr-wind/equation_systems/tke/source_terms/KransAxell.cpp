@@ -156,8 +156,9 @@ void KransAxell::operator()(
         const auto* const m_terrain_drag =
             &this->m_sim.repo().get_int_field("terrain_drag");
         auto* const m_terrain_height =
-            &this->m_sim.repo().get_field("terrain_height");
-        auto* const m_terrainz0 = &this->m_sim.repo().get_field("terrainz0");
+            &this->m_sim.repo().get_float_field("terrain_height");
+        auto* const m_terrainz0 =
+            &this->m_sim.repo().get_float_field("terrainz0");
         const auto& blank_arr = (*m_terrain_blank)(lev).const_array(mfi);
         const auto& drag_arr = (*m_terrain_drag)(lev).const_array(mfi);
         const auto& terrain_height = (*m_terrain_height)(lev).const_array(mfi);
@@ -165,7 +166,8 @@ void KransAxell::operator()(
         amrex::ParallelFor(
             bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
                 const amrex::Real cell_z0 =
-                    drag_arr(i, j, k) * std::max(terrainz0(i, j, k), z0_min) +
+                    drag_arr(i, j, k) *
+                        std::max<amrex::Real>(terrainz0(i, j, k), z0_min) +
                     (1 - drag_arr(i, j, k)) * z0;
                 amrex::Real terrainforcing = 0;
                 amrex::Real dragforcing = 0;
@@ -6,6 +6,7 @@
 #include "amr-wind/turbulence/TurbulenceModel.H"
 #include "amr-wind/equation_systems/SchemeTraits.H"
 #include "amr-wind/utilities/IOManager.H"
+#include "amr-wind/utilities/DerivedQuantity.H"
 #include "amr-wind/utilities/PostProcessing.H"
 #include "amr-wind/overset/OversetManager.H"
 
@@ -17,6 +18,7 @@ incflo::incflo()
     : m_sim(*this)
     , m_time(m_sim.time())
     , m_repo(m_sim.repo())
+    , m_perf_monitor(m_sim)
     , m_mesh_refiner(new amr_wind::RefineCriteriaManager(m_sim))
 {
     // NOTE: Geometry on all levels has just been defined in the AmrCore
@@ -119,10 +121,14 @@ void incflo::init_amr_wind_modules()
     for (auto& eqn : scalar_eqns()) {
         eqn->initialize();
     }
+    m_sim.pde_manager().init_advection_groups();
 
     m_sim.pde_manager().fillpatch_state_fields(m_time.current_time());
     m_sim.pde_manager().density_check();
     m_sim.post_manager().post_init_actions();
+    // The initial projection and iterations update the fields at the same
+    // time index
+    m_sim.derived_cache().clear();
 }
 
 /** Initialize flow-field before performing time-integration.
@@ -160,6 +166,7 @@ void incflo::prepare_for_time_integration()
     if (m_time.write_checkpoint()) {
         m_sim.io_manager().write_checkpoint_file();
     }
+    m_sim.derived_cache().clear();
 }
 
 /** Perform all initialization actions for AMR-Wind.
@@ -176,6 +183,7 @@ void incflo::InitData()
     init_mesh();
     init_amr_wind_modules();
     prepare_for_time_integration();
+    m_perf_monitor.initialize();
 }
 
 /** Perform regrid actions at a given timestep.
@@ -184,7 +192,7 @@ void incflo::InitData()
  */
 bool incflo::regrid_and_update()
 {
-    BL_PROFILE("amr-wind::incflo::regrid_and_update");
+    AMR_WIND_PROFILE("amr-wind::incflo::regrid_and_update");
 
     if (m_time.do_regrid()) {
         amrex::Print() << "Regrid mesh ... ";
@@ -249,12 +257,15 @@ bool incflo::regrid_and_update()
  */
 void incflo::post_advance_work()
 {
-    BL_PROFILE("amr-wind::incflo::post_advance_work");
+    AMR_WIND_PROFILE("amr-wind::incflo::post_advance_work");
 
     m_sim.turbulence_model().post_advance_work();
 
-    for (auto& pp : m_sim.physics()) {
-        pp->post_advance_work();
+    const auto& physics_keys = m_sim.physics_manager().keys();
+    for (int i = 0; i < static_cast<int>(physics_keys.size()); ++i) {
+        AMR_WIND_PERF_TIMER(
+            "amr-wind::" + physics_keys[i] + "::post_advance_work");
+        m_sim.physics()[i]->post_advance_work();
     }
 
     m_sim.post_manager().post_advance_work();
@@ -273,6 +284,9 @@ void incflo::post_advance_work()
     if (m_sim.has_overset()) {
         m_sim.set_during_overset_advance(false);
     }
+
+    // Release the derived quantities shared by the outputs of this step
+    m_sim.derived_cache().clear();
 }
 
 /** Perform time-integration for user-defined time or timesteps.
@@ -323,6 +337,7 @@ void incflo::Evolve()
         amrex::Print() << "Cumulative WallClockTime in Evolve(): "
                        << std::setprecision(4) << (time3 - init_time)
                        << std::endl;
+        m_perf_monitor.end_step(time3 - time0);
 
 #ifdef AMREX_TINY_PROFILING
         if (m_time.output_profiling_info()) {
@@ -343,6 +358,7 @@ void incflo::Evolve()
         m_sim.io_manager().write_checkpoint_file();
     }
     m_sim.post_manager().final_output();
+    m_sim.post_manager().flush_output();
 }
 
 void incflo::do_advance(const int fixed_point_iteration)
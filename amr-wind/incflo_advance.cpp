@@ -13,15 +13,18 @@ using namespace amrex;
 
 void incflo::pre_advance_stage1()
 {
-    BL_PROFILE("amr-wind::incflo::pre_advance_stage1");
+    AMR_WIND_PROFILE("amr-wind::incflo::pre_advance_stage1");
     advance_time();
 }
 
 void incflo::pre_advance_stage2()
 {
-    BL_PROFILE("amr-wind::incflo::pre_advance_stage2");
-    for (auto& pp : m_sim.physics()) {
-        pp->pre_advance_work();
+    AMR_WIND_PROFILE("amr-wind::incflo::pre_advance_stage2");
+    const auto& physics_keys = m_sim.physics_manager().keys();
+    for (int i = 0; i < static_cast<int>(physics_keys.size()); ++i) {
+        AMR_WIND_PERF_TIMER(
+            "amr-wind::" + physics_keys[i] + "::pre_advance_work");
+        m_sim.physics()[i]->pre_advance_work();
     }
 
     m_sim.helics().pre_advance_work();
@@ -55,7 +58,7 @@ void incflo::prepare_time_step()
  */
 void incflo::advance(const int fixed_point_iteration)
 {
-    BL_PROFILE("amr-wind::incflo::advance");
+    AMR_WIND_PROFILE("amr-wind::incflo::advance");
     if (fixed_point_iteration == 0) {
         prepare_time_step();
     }
@@ -179,7 +182,7 @@ void incflo::advance(const int fixed_point_iteration)
 void incflo::ApplyPredictor(
     const bool incremental_projection, const int fixed_point_iteration)
 {
-    BL_PROFILE("amr-wind::incflo::ApplyPredictor");
+    AMR_WIND_PROFILE("amr-wind::incflo::ApplyPredictor");
     // We use the new time value for things computed on the "*" state
     Real new_time = m_time.new_time();
 
@@ -301,6 +304,17 @@ void incflo::ApplyPredictor(
         amr_wind::field_ops::copy(density_nph, density_old, 0, 0, 1, 1);
     }
 
+    // With constant density, the advection terms of the scalars do not depend
+    // on the updates of the other scalars and the grouped scalars are
+    // advected together
+    const bool advect_scalars_first =
+        m_sim.pde_manager().constant_density() &&
+        m_sim.pde_manager().has_advection_groups();
+    if (advect_scalars_first) {
+        m_sim.pde_manager().compute_scalar_advection(
+            amr_wind::FieldState::Old);
+    }
+
     // TODO: This sub-section has not been adjusted for mesh mapping - adjust in
     // corrector too.
     // Perform scalar update one at a time. This is to allow an
@@ -308,7 +322,9 @@ void incflo::ApplyPredictor(
     // when computing their source terms.
     for (auto& eqn : scalar_eqns()) {
         // Compute explicit advection
-        eqn->compute_advection_term(amr_wind::FieldState::Old);
+        if (!advect_scalars_first) {
+            eqn->compute_advection_term(amr_wind::FieldState::Old);
+        }
 
         // Compute (recompute for Godunov) the scalar forcing terms
         eqn->compute_source_term(amr_wind::FieldState::NPH);
@@ -328,13 +344,15 @@ void incflo::ApplyPredictor(
             // Post-processing actions after a PDE solve
         } else if (m_diff_type == DiffusionType::Explicit && m_use_godunov) {
             // explicit RK2
-            auto diff_old =
-                m_repo.create_scratch_field(1, 0, amr_wind::FieldLoc::CELL);
+            const int ncomp = field.num_comp();
+            auto diff_old = m_repo.create_scratch_field(
+                ncomp, 0, amr_wind::FieldLoc::CELL);
             auto& diff_new =
                 eqn->fields().diff_term.state(amr_wind::FieldState::New);
-            amr_wind::field_ops::copy(*diff_old, diff_new, 0, 0, 1, 0);
+            amr_wind::field_ops::copy(*diff_old, diff_new, 0, 0, ncomp, 0);
             eqn->compute_diffusion_term(amr_wind::FieldState::New);
-            amr_wind::field_ops::saxpy(diff_new, -1.0, *diff_old, 0, 0, 1, 0);
+            amr_wind::field_ops::saxpy(
+                diff_new, -1.0, *diff_old, 0, 0, ncomp, 0);
             eqn->improve_explicit_diffusion(m_time.delta_t());
         }
         eqn->post_solve_actions();
@@ -517,7 +535,7 @@ void incflo::ApplyPredictor(
  */
 void incflo::ApplyCorrector()
 {
-    BL_PROFILE("amr-wind::incflo::ApplyCorrector");
+    AMR_WIND_PROFILE("amr-wind::incflo::ApplyCorrector");
 
     // We use the new time value for things computed on the "*" state
     Real new_time = m_time.new_time();
@@ -643,7 +661,7 @@ void incflo::ApplyCorrector()
 
 void incflo::prescribe_advance()
 {
-    BL_PROFILE("amr-wind::incflo::prescribe_advance");
+    AMR_WIND_PROFILE("amr-wind::incflo::prescribe_advance");
 
     prepare_time_step();
 
@@ -652,7 +670,7 @@ void incflo::prescribe_advance()
 
 void incflo::ApplyPrescribeStep()
 {
-    BL_PROFILE("amr-wind::incflo::ApplyPrescribeStep");
+    AMR_WIND_PROFILE("amr-wind::incflo::ApplyPrescribeStep");
     // The intent of this function is to see the effect of a prescribed
     // advection velocity:
     // - No source terms or viscous terms are used for icns
@@ -713,9 +731,7 @@ void incflo::ApplyPrescribeStep()
     // if (!m_use_godunov) Compute the explicit advective terms
     //                     R_u^n      , R_s^n       and R_t^n
     // *************************************************************************************
-    for (auto& seqn : scalar_eqns()) {
-        seqn->compute_advection_term(amr_wind::FieldState::Old);
-    }
+    m_sim.pde_manager().compute_scalar_advection(amr_wind::FieldState::Old);
 
     // *************************************************************************************
     // Update density first
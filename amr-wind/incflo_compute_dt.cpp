@@ -31,7 +31,7 @@ using namespace amrex;
  */
 void incflo::compute_dt()
 {
-    BL_PROFILE("amr-wind::incflo::compute_dt");
+    AMR_WIND_PROFILE("amr-wind::incflo::compute_dt");
 
     bool explicit_diffusion = (m_diff_type == DiffusionType::Explicit);
 
@@ -212,7 +212,7 @@ void incflo::compute_dt()
 
 void incflo::compute_prescribe_dt()
 {
-    BL_PROFILE("amr-wind::incflo::compute_prescribe_dt");
+    AMR_WIND_PROFILE("amr-wind::incflo::compute_prescribe_dt");
 
     Real conv_cfl = 0.0;
     const bool mesh_mapping = m_sim.has_mesh_mapping();
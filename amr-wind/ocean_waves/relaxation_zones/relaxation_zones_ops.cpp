@@ -37,6 +37,8 @@ void read_inputs(
 
     pp.query("current", wdata.current);
 
+    pp.query("restrict_target_update", wdata.restrict_target_update);
+
     wdata.has_ramp = pp.contains("timeramp_period");
     if (wdata.has_ramp) {
         pp.get("timeramp_period", wdata.ramp_period);
@@ -48,7 +50,107 @@ void read_inputs(
 
 void init_data_structures(RelaxZonesBaseData& /*unused*/) {}
 
-void update_target_vof(CFDSim& sim)
+bool box_needs_target_fields(
+    const amrex::Box& gbx,
+    const amrex::Geometry& geom,
+    const RelaxZonesBaseData& wdata)
+{
+    // Ghost cells of boxes at the domain boundaries are used for inflow
+    if (!geom.Domain().contains(gbx)) {
+        return true;
+    }
+
+    const auto& problo = geom.ProbLoArray();
+    const auto& probhi = geom.ProbHiArray();
+    const auto& dx = geom.CellSizeArray();
+    const amrex::Real xlo = problo[0] + (gbx.smallEnd(0) + 0.5) * dx[0];
+    const amrex::Real xhi = problo[0] + (gbx.bigEnd(0) + 0.5) * dx[0];
+    const amrex::Real ylo = problo[1] + (gbx.smallEnd(1) + 0.5) * dx[1];
+    const amrex::Real yhi = problo[1] + (gbx.bigEnd(1) + 0.5) * dx[1];
+
+    const bool has_zone_y = wdata.zone_length_y > constants::EPS;
+    // Lateral zones blend into the beach over an extended length
+    const amrex::Real xhi_factor = (has_zone_y && wdata.has_beach) ? 1.5 : 1.0;
+
+    const bool in_gen = xlo <= problo[0] + wdata.gen_length;
+    const bool in_beach = xhi >= probhi[0] - xhi_factor * wdata.beach_length;
+    const bool in_zone_y = has_zone_y &&
+                           (ylo <= problo[1] + wdata.zone_length_y ||
+                            yhi >= probhi[1] - wdata.zone_length_y);
+
+    return in_gen || in_beach || in_zone_y;
+}
+
+void update_target_box_masks(CFDSim& sim, RelaxZonesBaseData& wdata)
+{
+    // Target fields are used everywhere when waves act as terrain
+    if (!sim.repo().field_exists("vof")) {
+        wdata.restrict_target_update = false;
+    }
+    if (!wdata.restrict_target_update) {
+        return;
+    }
+
+    const int nlevels = sim.repo().num_active_levels();
+    auto& ow_levelset = sim.repo().get_field("ow_levelset");
+    auto& ow_vel = sim.repo().get_field("ow_velocity");
+    auto& ow_vof = sim.repo().get_field("ow_vof");
+    const auto& geom = sim.mesh().Geom();
+
+    bool masks_valid =
+        !wdata.regrid_occurred &&
+        (static_cast<int>(wdata.target_box_mask.size()) == nlevels);
+    for (int lev = 0; masks_valid && lev < nlevels; ++lev) {
+        masks_valid = static_cast<int>(wdata.target_box_mask[lev].size()) ==
+                      ow_vel(lev).size();
+    }
+    if (masks_valid) {
+        return;
+    }
+
+    BL_PROFILE("amr-wind::ocean_waves::update_target_box_masks");
+    wdata.target_box_mask.resize(nlevels);
+    const amrex::Real zsl = wdata.zsl;
+    const amrex::Real current = wdata.current;
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto& dx = geom[lev].CellSizeArray();
+        const auto& problo = geom[lev].ProbLoArray();
+        const amrex::Real eps = 2. * std::cbrt(dx[0] * dx[1] * dx[2]);
+        auto& mask = wdata.target_box_mask[lev];
+        mask.assign(ow_vel(lev).size(), 0);
+
+        for (amrex::MFIter mfi(ow_vel(lev)); mfi.isValid(); ++mfi) {
+            const auto& gbx = mfi.growntilebox(ow_vel.num_grow());
+            if (box_needs_target_fields(gbx, geom[lev], wdata)) {
+                mask[mfi.index()] = 1;
+                continue;
+            }
+
+            // Quiescent state in boxes that are skipped during updates
+            const auto& phi = ow_levelset(lev).array(mfi);
+            const auto& vel = ow_vel(lev).array(mfi);
+            amrex::ParallelFor(
+                gbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                    const amrex::Real z = problo[2] + (k + 0.5) * dx[2];
+                    phi(i, j, k) = zsl - z;
+                    vel(i, j, k, 0) = (phi(i, j, k) >= 0.) ? current : 0.;
+                    vel(i, j, k, 1) = 0.;
+                    vel(i, j, k, 2) = 0.;
+                });
+            const auto& volfrac = ow_vof(lev).array(mfi);
+            const auto& phi_c = ow_levelset(lev).const_array(mfi);
+            amrex::ParallelFor(
+                mfi.growntilebox(ow_vof.num_grow()),
+                [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                    volfrac(i, j, k) =
+                        multiphase::levelset_to_vof(i, j, k, eps, phi_c);
+                });
+        }
+    }
+    amrex::Gpu::streamSynchronize();
+}
+
+void update_target_vof(CFDSim& sim, const RelaxZonesBaseData& wdata)
 {
     const int nlevels = sim.repo().num_active_levels();
     const auto& ow_levelset = sim.repo().get_field("ow_levelset");
@@ -57,15 +159,20 @@ void update_target_vof(CFDSim& sim)
 
     for (int lev = 0; lev < nlevels; ++lev) {
         const auto& dx = geom[lev].CellSizeArray();
-        const auto target_phi = ow_levelset(lev).const_arrays();
-        auto target_volfrac = ow_vof(lev).arrays();
         const amrex::Real eps = 2. * std::cbrt(dx[0] * dx[1] * dx[2]);
-        amrex::ParallelFor(
-            ow_vof(lev), amrex::IntVect(2),
-            [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
-                target_volfrac[nbx](i, j, k) =
-                    multiphase::levelset_to_vof(i, j, k, eps, target_phi[nbx]);
-            });
+        for (amrex::MFIter mfi(ow_vof(lev)); mfi.isValid(); ++mfi) {
+            if (!target_box_active(wdata, lev, mfi.index())) {
+                continue;
+            }
+            const auto target_phi = ow_levelset(lev).const_array(mfi);
+            const auto target_volfrac = ow_vof(lev).array(mfi);
+            amrex::ParallelFor(
+                mfi.growntilebox(2),
+                [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                    target_volfrac(i, j, k) =
+                        multiphase::levelset_to_vof(i, j, k, eps, target_phi);
+                });
+        }
     }
     amrex::Gpu::streamSynchronize();
 }
@@ -83,46 +190,49 @@ void modify_target_fields_for_beach(
         const auto& dx = geom[lev].CellSizeArray();
         const auto& problo = geom[lev].ProbLoArray();
         const auto& probhi = geom[lev].ProbHiArray();
-        auto target_ls_arrs = ow_levelset(lev).arrays();
-        auto target_vel_arrs = ow_vel(lev).arrays();
 
         const amrex::Real gen_length = wdata.gen_length;
         const amrex::Real beach_length = wdata.beach_length;
         const amrex::Real zsl = wdata.zsl;
         const amrex::Real current = wdata.current;
 
-        amrex::ParallelFor(
-            ow_vel(lev), amrex::IntVect(3),
-            [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
-                // x is for combining wave profiles and does not need to exceed
-                // domain limits
-                const amrex::Real x = amrex::min(
-                    amrex::max(problo[0] + (i + 0.5) * dx[0], problo[0]),
-                    probhi[0]);
-                // z is for distance function and needs to exceed domain limits
-                // so norms can be calculated when converted to vof
-                const amrex::Real z = problo[2] + (k + 0.5) * dx[2];
-
-                auto target_ls = target_ls_arrs[nbx];
-                auto target_vel = target_vel_arrs[nbx];
-
-                // Create wave vector for generation, numerical beach
-                const utils::WaveVec wave_sol{
-                    target_vel(i, j, k, 0), target_vel(i, j, k, 1),
-                    target_vel(i, j, k, 2), target_ls(i, j, k)};
-                const utils::WaveVec outlet{current, 0.0, 0.0, zsl - z};
-
-                // Harmonize between inlet/bulk profile and outlet profile
-                const auto target_profile = utils::harmonize_profiles_1d(
-                    x, problo[0], gen_length, probhi[0], beach_length, wave_sol,
-                    wave_sol, outlet);
-
-                // Update target fields based on harmonization
-                for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
-                    target_vel(i, j, k, dir) = target_profile[dir];
-                }
-                target_ls(i, j, k) = target_profile[3];
-            });
+        for (amrex::MFIter mfi(ow_vel(lev)); mfi.isValid(); ++mfi) {
+            if (!target_box_active(wdata, lev, mfi.index())) {
+                continue;
+            }
+            auto target_ls = ow_levelset(lev).array(mfi);
+            auto target_vel = ow_vel(lev).array(mfi);
+
+            amrex::ParallelFor(
+                mfi.growntilebox(3),
+                [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                    // x is for combining wave profiles and does not need to
+                    // exceed domain limits
+                    const amrex::Real x = amrex::min(
+                        amrex::max(problo[0] + (i + 0.5) * dx[0], problo[0]),
+                        probhi[0]);
+                    // z is for distance function and needs to exceed domain
+                    // limits so norms can be calculated when converted to vof
+                    const amrex::Real z = problo[2] + (k + 0.5) * dx[2];
+
+                    // Create wave vector for generation, numerical beach
+                    const utils::WaveVec wave_sol{
+                        target_vel(i, j, k, 0), target_vel(i, j, k, 1),
+                        target_vel(i, j, k, 2), target_ls(i, j, k)};
+                    const utils::WaveVec outlet{current, 0.0, 0.0, zsl - z};
+
+                    // Harmonize between inlet/bulk profile and outlet profile
+                    const auto target_profile = utils::harmonize_profiles_1d(
+                        x, problo[0], gen_length, probhi[0], beach_length,
+                        wave_sol, wave_sol, outlet);
+
+                    // Update target fields based on harmonization
+                    for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+                        target_vel(i, j, k, dir) = target_profile[dir];
+                    }
+                    target_ls(i, j, k) = target_profile[3];
+                });
+        }
     }
     amrex::Gpu::streamSynchronize();
 }
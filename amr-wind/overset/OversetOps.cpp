@@ -6,11 +6,24 @@
 #include "amr-wind/core/MLMGOptions.H"
 #include "amr-wind/projection/nodal_projection_ops.H"
 #include <hydro_NodalProjector.H>
+#include <algorithm>
 #include "amr-wind/wind_energy/ABL.H"
 #include "amr-wind/wind_energy/ABLBoundaryPlane.H"
 
 namespace amr_wind {
 
+namespace {
+//! Zero the data in the boxes flagged as active
+void zero_active_boxes(amrex::MultiFab& mf, const amrex::Vector<int>& active)
+{
+    for (amrex::MFIter mfi(mf); mfi.isValid(); ++mfi) {
+        if (active[mfi.index()] != 0) {
+            mf[mfi].setVal<amrex::RunOn::Device>(0.0);
+        }
+    }
+}
+} // namespace
+
 void OversetOps::initialize(CFDSim& sim)
 {
     m_sim_ptr = &sim;
@@ -206,18 +219,16 @@ void OversetOps::sharpen_nalu_data()
     auto& gp_noghost = repo.get_field("gp");
     auto& p = repo.get_field("p");
 
-    // 9 components are vof, density, 3 of velocity, 3 of gp, and psource flag
-    auto flux_x = repo.create_scratch_field(9, 1, amr_wind::FieldLoc::XFACE);
-    auto flux_y = repo.create_scratch_field(9, 1, amr_wind::FieldLoc::YFACE);
-    auto flux_z = repo.create_scratch_field(9, 1, amr_wind::FieldLoc::ZFACE);
-
-    auto p_src = repo.create_scratch_field(1, 0, amr_wind::FieldLoc::NODE);
-    auto normal_vec = repo.create_scratch_field(3, vof.num_grow()[0] - 1);
-    auto target_vof = repo.create_scratch_field(1, vof.num_grow()[0]);
-
-    // Sharpening fluxes (at faces) have 1 ghost, requiring fields to have >= 2
-    auto gp_scr = repo.create_scratch_field(3, 2);
-    auto& gp = *gp_scr;
+    // Reuse scratch fields between calls and focus on the overset fringe
+    allocate_sharpen_scratch();
+    update_fringe_boxes();
+    auto& flux_x = *m_flux_x;
+    auto& flux_y = *m_flux_y;
+    auto& flux_z = *m_flux_z;
+    auto& p_src = *m_p_src;
+    auto& normal_vec = *m_normal_vec;
+    auto& target_vof = *m_target_vof;
+    auto& gp = *m_gp_scr;
 
     // Give initial max possible value of pseudo-velocity scale
     const auto dx_lev0 = (geom[0]).CellSizeArray();
@@ -249,19 +260,19 @@ void OversetOps::sharpen_nalu_data()
     amrex::ParallelDescriptor::ReduceRealMin(pvscale);
 
     // Convert levelset to vof to get target_vof
-    m_mphase->levelset2vof(iblank_cell, *target_vof);
+    m_mphase->levelset2vof(iblank_cell, target_vof);
 
     // Process target vof for tiny margins from single-phase
     for (int lev = 0; lev < nlevels; ++lev) {
         // A tolerance of 0 should do nothing
-        overset_ops::process_vof((*target_vof)(lev), m_target_cutoff);
+        overset_ops::process_vof(target_vof(lev), m_target_cutoff);
     }
     amrex::Gpu::streamSynchronize();
 
     // Replace vof with original values in amr domain
     for (int lev = 0; lev < nlevels; ++lev) {
         overset_ops::harmonize_vof(
-            (*target_vof)(lev), vof(lev), iblank_cell(lev));
+            target_vof(lev), vof(lev), iblank_cell(lev));
     }
     amrex::Gpu::streamSynchronize();
 
@@ -269,9 +280,14 @@ void OversetOps::sharpen_nalu_data()
     amrex::Vector<amrex::Array<amrex::MultiFab*, AMREX_SPACEDIM>> fluxes(
         repo.num_active_levels());
     for (int lev = 0; lev < nlevels; ++lev) {
-        fluxes[lev][0] = &(*flux_x)(lev);
-        fluxes[lev][1] = &(*flux_y)(lev);
-        fluxes[lev][2] = &(*flux_z)(lev);
+        fluxes[lev][0] = &flux_x(lev);
+        fluxes[lev][1] = &flux_y(lev);
+        fluxes[lev][2] = &flux_z(lev);
+        // Only vof bounds are modified away from the fringe
+        if (m_n_iterations > 0) {
+            overset_ops::process_vof_inactive(
+                vof(lev), m_vof_tol, m_fringe_boxes[lev]);
+        }
     }
 
     // Pseudo-time loop
@@ -289,28 +305,30 @@ void OversetOps::sharpen_nalu_data()
         const amrex::Real pCFL = 0.5;
 
         for (int lev = 0; lev < nlevels; ++lev) {
+            const auto& active = m_fringe_boxes[lev];
+
             // Populate normal vector
             overset_ops::populate_normal_vector(
-                (*normal_vec)(lev), vof(lev), iblank_cell(lev));
+                normal_vec(lev), vof(lev), iblank_cell(lev), active);
 
             // Sharpening fluxes for vof, density, and momentum
             overset_ops::populate_sharpen_fluxes(
-                (*flux_x)(lev), (*flux_y)(lev), (*flux_z)(lev), vof(lev),
-                (*target_vof)(lev), (*normal_vec)(lev), velocity(lev), gp(lev),
+                flux_x(lev), flux_y(lev), flux_z(lev), vof(lev),
+                target_vof(lev), normal_vec(lev), velocity(lev), gp(lev),
                 rho(lev), pvscale, m_upw_margin, m_mphase->rho1(),
-                m_mphase->rho2());
+                m_mphase->rho2(), active);
 
             // Process fluxes
             overset_ops::process_fluxes_calc_src(
-                (*flux_x)(lev), (*flux_y)(lev), (*flux_z)(lev), (*p_src)(lev),
-                vof(lev), iblank_cell(lev));
+                flux_x(lev), flux_y(lev), flux_z(lev), p_src(lev), vof(lev),
+                iblank_cell(lev), active);
 
             // Measure convergence to determine if loop can stop
             if (calc_convg) {
                 // Update error at specified interval of steps
                 const amrex::Real err_lev =
                     overset_ops::measure_convergence(
-                        (*flux_x)(lev), (*flux_y)(lev), (*flux_z)(lev)) /
+                        flux_x(lev), flux_y(lev), flux_z(lev), active) /
                     pvscale;
                 err = amrex::max(err, err_lev);
             }
@@ -330,8 +348,8 @@ void OversetOps::sharpen_nalu_data()
             // Compare vof fluxes to vof in source cells
             // Convergence tolerance determines what size of fluxes matter
             const amrex::Real ptfac_lev = overset_ops::calculate_pseudo_dt_flux(
-                (*flux_x)(lev), (*flux_y)(lev), (*flux_z)(lev), vof(lev), dx,
-                m_convg_tol);
+                flux_x(lev), flux_y(lev), flux_z(lev), vof(lev), dx,
+                m_convg_tol, m_fringe_boxes[lev]);
             ptfac = amrex::min(ptfac, ptfac_lev);
         }
         amrex::Gpu::streamSynchronize();
@@ -345,9 +363,9 @@ void OversetOps::sharpen_nalu_data()
             const auto dx = (geom[lev]).CellSizeArray();
 
             overset_ops::apply_fluxes(
-                (*flux_x)(lev), (*flux_y)(lev), (*flux_z)(lev), (*p_src)(lev),
-                vof(lev), rho(lev), velocity(lev), gp(lev), p(lev), dx, ptfac,
-                m_vof_tol);
+                flux_x(lev), flux_y(lev), flux_z(lev), p_src(lev), vof(lev),
+                rho(lev), velocity(lev), gp(lev), p(lev), dx, ptfac, m_vof_tol,
+                m_fringe_boxes[lev]);
 
             vof(lev).FillBoundary(geom[lev].periodicity());
             velocity(lev).FillBoundary(geom[lev].periodicity());
@@ -369,6 +387,16 @@ void OversetOps::sharpen_nalu_data()
         }
     }
 
+    // Fluxes away from the fringe are never computed and must remain zero for
+    // the next call, where the fringe can be elsewhere
+    for (int lev = 0; lev < nlevels; ++lev) {
+        zero_active_boxes(flux_x(lev), m_fringe_boxes[lev]);
+        zero_active_boxes(flux_y(lev), m_fringe_boxes[lev]);
+        zero_active_boxes(flux_z(lev), m_fringe_boxes[lev]);
+        zero_active_boxes(p_src(lev), m_fringe_boxes[lev]);
+    }
+    amrex::Gpu::streamSynchronize();
+
     // Fillpatch for pressure to make sure pressure stencil has all points
     p.fillpatch(m_sim_ptr->time().current_time());
 
@@ -381,6 +409,103 @@ void OversetOps::sharpen_nalu_data()
     amrex::Gpu::streamSynchronize();
 }
 
+void OversetOps::allocate_sharpen_scratch()
+{
+    const auto& repo = m_sim_ptr->repo();
+    const int nlevels = repo.num_active_levels();
+    const auto& vof = repo.get_field("vof");
+
+    bool mesh_changed = (m_flux_x == nullptr) ||
+                        (static_cast<int>(m_scratch_ba.size()) != nlevels);
+    for (int lev = 0; (lev < nlevels) && !mesh_changed; ++lev) {
+        mesh_changed = (m_scratch_ba[lev] != vof(lev).boxArray()) ||
+                       (m_scratch_dm[lev] != vof(lev).DistributionMap());
+    }
+    if (!mesh_changed) {
+        return;
+    }
+
+    m_scratch_ba.resize(nlevels);
+    m_scratch_dm.resize(nlevels);
+    for (int lev = 0; lev < nlevels; ++lev) {
+        m_scratch_ba[lev] = vof(lev).boxArray();
+        m_scratch_dm[lev] = vof(lev).DistributionMap();
+    }
+
+    // 9 components are vof, density, 3 of velocity, 3 of gp, and psource flag
+    m_flux_x = repo.create_scratch_field(9, 1, amr_wind::FieldLoc::XFACE);
+    m_flux_y = repo.create_scratch_field(9, 1, amr_wind::FieldLoc::YFACE);
+    m_flux_z = repo.create_scratch_field(9, 1, amr_wind::FieldLoc::ZFACE);
+
+    m_p_src = repo.create_scratch_field(1, 0, amr_wind::FieldLoc::NODE);
+    m_normal_vec = repo.create_scratch_field(3, vof.num_grow()[0] - 1);
+    m_target_vof = repo.create_scratch_field(1, vof.num_grow()[0]);
+
+    // Sharpening fluxes (at faces) have 1 ghost, requiring fields to have >= 2
+    m_gp_scr = repo.create_scratch_field(3, 2);
+
+    // Fluxes are only computed near the fringe and are zero elsewhere
+    for (int lev = 0; lev < nlevels; ++lev) {
+        (*m_flux_x)(lev).setVal(0.0);
+        (*m_flux_y)(lev).setVal(0.0);
+        (*m_flux_z)(lev).setVal(0.0);
+        (*m_p_src)(lev).setVal(0.0);
+    }
+}
+
+void OversetOps::update_fringe_boxes()
+{
+    const auto& repo = m_sim_ptr->repo();
+    const int nlevels = repo.num_active_levels();
+    const auto& iblank_cell = repo.get_int_field("iblank_cell");
+
+    // Fluxes are nonzero only between two fringe cells, so a box is modified
+    // only if it has fringe cells within one cell of its boundary
+    constexpr int fringe_margin = 1;
+
+    m_fringe_boxes.resize(nlevels);
+    for (int lev = nlevels - 1; lev >= 0; --lev) {
+        auto& flags = m_fringe_boxes[lev];
+        flags = overset_ops::fringe_box_flags(iblank_cell(lev), fringe_margin);
+        if (lev == nlevels - 1) {
+            continue;
+        }
+
+        // Coarse faces are modified by averaging down the fine fluxes
+        const auto& ba_fine = iblank_cell(lev + 1).boxArray();
+        const auto& flags_fine = m_fringe_boxes[lev + 1];
+        const auto& rr = repo.mesh().refRatio(lev);
+        amrex::BoxList bl_fine;
+        for (int i = 0; i < static_cast<int>(ba_fine.size()); ++i) {
+            if (flags_fine[i] != 0) {
+                bl_fine.push_back(
+                    amrex::grow(amrex::coarsen(ba_fine[i], rr), fringe_margin));
+            }
+        }
+        if (bl_fine.isEmpty()) {
+            continue;
+        }
+        const amrex::BoxArray ba_covered(std::move(bl_fine));
+        const auto& ba = iblank_cell(lev).boxArray();
+        for (int i = 0; i < static_cast<int>(ba.size()); ++i) {
+            if ((flags[i] == 0) && ba_covered.intersects(ba[i])) {
+                flags[i] = 1;
+            }
+        }
+    }
+
+    if (m_verbose > 1) {
+        for (int lev = 0; lev < nlevels; ++lev) {
+            const auto& flags = m_fringe_boxes[lev];
+            const auto nactive = std::count_if(
+                flags.begin(), flags.end(), [](int f) { return f != 0; });
+            amrex::Print() << "OversetOps: sharpening on " << nactive << " of "
+                           << flags.size() << " boxes at level " << lev
+                           << std::endl;
+        }
+    }
+}
+
 void OversetOps::form_perturb_pressure()
 {
     auto& pressure = m_sim_ptr->repo().get_field("p");
@@ -11,6 +11,64 @@
 #include <numeric>
 namespace amr_wind {
 
+namespace {
+
+/** Flag local patches taking part in the exchange
+ *
+ *  \param ib IBLANK field on a level
+ *  \param receptor Flag patches with receptors (-1) if true, otherwise flag
+ *  patches with any field (1) or receptor point
+ */
+amrex::Vector<int> flag_patches(const amrex::iMultiFab& ib, const bool receptor)
+{
+    amrex::Vector<int> flags(ib.local_size(), 0);
+    for (amrex::MFIter mfi(ib); mfi.isValid(); ++mfi) {
+        const auto& fab = ib[mfi];
+        const auto& bx = mfi.fabbox();
+        const bool has_receptor = fab.min<amrex::RunOn::Device>(bx) < 0;
+        const bool has_field =
+            !receptor && (fab.max<amrex::RunOn::Device>(bx) > 0);
+        flags[mfi.LocalIndex()] = (has_receptor || has_field) ? 1 : 0;
+    }
+    return flags;
+}
+
+/** Copy whole patches between device and host fields
+ *
+ *  Only patches with a non-zero flag are copied; an empty flag array copies
+ *  all patches.
+ */
+void copy_patches(
+    amrex::MultiFab& dst,
+    const amrex::MultiFab& src,
+    const int scomp,
+    const int dcomp,
+    const int ncomp,
+    const amrex::Vector<int>& flags,
+    const bool to_host)
+{
+    for (amrex::MFIter mfi(dst); mfi.isValid(); ++mfi) {
+        if (!flags.empty() && (flags[mfi.LocalIndex()] == 0)) {
+            continue;
+        }
+        auto& dfab = dst[mfi];
+        const auto& sfab = src[mfi];
+        AMREX_ASSERT(dfab.box() == sfab.box());
+        const std::size_t nbytes =
+            sizeof(amrex::Real) * dfab.box().numPts() * ncomp;
+        if (to_host) {
+            amrex::Gpu::dtoh_memcpy_async(
+                dfab.dataPtr(dcomp), sfab.dataPtr(scomp), nbytes);
+        } else {
+            amrex::Gpu::htod_memcpy_async(
+                dfab.dataPtr(dcomp), sfab.dataPtr(scomp), nbytes);
+        }
+    }
+    amrex::Gpu::streamSynchronize();
+}
+
+} // namespace
+
 AMROversetInfo::AMROversetInfo(const int nglobal, const int nlocal)
     : level(nglobal)
     , mpi_rank(nglobal)
@@ -59,6 +117,9 @@ void TiogaInterface::post_init_actions()
 
 void TiogaInterface::post_regrid_actions()
 {
+    // Exchange buffers are tied to the old grids
+    reset_exchange_buffers();
+
     amr_to_tioga_mesh();
     amr_to_tioga_iblank();
 
@@ -102,6 +163,8 @@ void TiogaInterface::post_overset_conn_work()
     overset_ops::iblank_to_mask(m_iblank_cell, m_mask_cell);
     overset_ops::iblank_to_mask(m_iblank_node, m_mask_node);
 
+    update_exchange_patches();
+
     // Update equation systems after a connectivity update
     m_sim.pde_manager().icns().post_regrid_actions();
     for (auto& eqn : m_sim.pde_manager().scalar_eqns()) {
@@ -125,13 +188,20 @@ void TiogaInterface::register_solution(
     const int nnode_vars =
         std::accumulate(node_vars.begin(), node_vars.end(), 0, comp_counter);
     const int num_ghost = m_sim.pde_manager().num_ghost_state();
-    m_qcell = repo.create_scratch_field(ncell_vars, num_ghost, FieldLoc::CELL);
-    m_qnode = repo.create_scratch_field(nnode_vars, num_ghost, FieldLoc::NODE);
 
-    m_qcell_host = repo.create_scratch_field_on_host(
-        ncell_vars, num_ghost, FieldLoc::CELL);
-    m_qnode_host = repo.create_scratch_field_on_host(
-        nnode_vars, num_ghost, FieldLoc::NODE);
+    // Exchange buffers are reused until the grids or the variables change
+    if (!m_qcell || (m_qcell->num_comp() != ncell_vars)) {
+        m_qcell =
+            repo.create_scratch_field(ncell_vars, num_ghost, FieldLoc::CELL);
+        m_qcell_host = repo.create_scratch_field_on_host(
+            ncell_vars, num_ghost, FieldLoc::CELL);
+    }
+    if (!m_qnode || (m_qnode->num_comp() != nnode_vars)) {
+        m_qnode =
+            repo.create_scratch_field(nnode_vars, num_ghost, FieldLoc::NODE);
+        m_qnode_host = repo.create_scratch_field_on_host(
+            nnode_vars, num_ghost, FieldLoc::NODE);
+    }
     // Store field variable names for use in update_solution step
     m_cell_vars = cell_vars;
     m_node_vars = node_vars;
@@ -140,58 +210,44 @@ void TiogaInterface::register_solution(
                                            ? m_sim.time().new_time()
                                            : m_sim.time().current_time();
 
-    // Move cell variables into scratch field
-    {
-        int icomp = 0;
-        for (const auto& cvar : m_cell_vars) {
-            auto& fld = repo.get_field(cvar);
-            const int ncomp = fld.num_comp();
-            fld.fillpatch(time_fillpatch);
-            field_ops::copy(*m_qcell, fld, 0, icomp, ncomp, num_ghost);
-            icomp += ncomp;
-        }
-    }
+    const int nlevels = repo.num_active_levels();
+    const bool use_patches = !m_exchange_patches.empty();
+    const amrex::Vector<int> all_patches;
 
-    // Move cell variables into host scratch field
+    // Move cell variables into scratch fields. Patches consisting entirely of
+    // hole cells are not copied to the host.
     {
         int icomp = 0;
         for (const auto& cvar : m_cell_vars) {
             auto& fld = repo.get_field(cvar);
             const int ncomp = fld.num_comp();
             fld.fillpatch(time_fillpatch);
-            // Device to host copy happens here
-            const int nlevels = repo.num_active_levels();
+            field_ops::copy(*m_qcell, fld, 0, icomp, ncomp, num_ghost);
             for (int lev = 0; lev < nlevels; ++lev) {
-                dtoh_memcpy((*m_qcell_host)(lev), fld(lev), 0, icomp, ncomp);
+                copy_patches(
+                    (*m_qcell_host)(lev), fld(lev), 0, icomp, ncomp,
+                    use_patches ? m_exchange_patches.cell_exchange[lev]
+                                : all_patches,
+                    true);
             }
-
             icomp += ncomp;
         }
+        AMREX_ASSERT(ncell_vars == icomp);
     }
-    // Move node variables into scratch field
+    // Move node variables into scratch fields
     {
         int icomp = 0;
         for (const auto& cvar : m_node_vars) {
             auto& fld = repo.get_field(cvar);
-
             const int ncomp = fld.num_comp();
             fld.fillpatch(time_fillpatch);
             field_ops::copy(*m_qnode, fld, 0, icomp, ncomp, num_ghost);
-            icomp += ncomp;
-        }
-        AMREX_ASSERT(nnode_vars == icomp);
-    }
-    // Copy node data from device to host scratch field
-    {
-        int icomp = 0;
-        for (const auto& cvar : m_node_vars) {
-            auto& fld = repo.get_field(cvar);
-            const int ncomp = fld.num_comp();
-            fld.fillpatch(time_fillpatch);
-            // Device to host copy happens here
-            const int nlevels = repo.num_active_levels();
             for (int lev = 0; lev < nlevels; ++lev) {
-                dtoh_memcpy((*m_qnode_host)(lev), fld(lev), 0, icomp, ncomp);
+                copy_patches(
+                    (*m_qnode_host)(lev), fld(lev), 0, icomp, ncomp,
+                    use_patches ? m_exchange_patches.node_exchange[lev]
+                                : all_patches,
+                    true);
             }
             icomp += ncomp;
         }
@@ -201,7 +257,6 @@ void TiogaInterface::register_solution(
     // Update data pointers for TIOGA exchange
     {
         int ilp = 0;
-        const int nlevels = m_sim.repo().num_active_levels();
         auto& ad = *m_amr_data;
         amrex::Vector<amrex::Real*> qcellPtr(ad.qcell.size());
         amrex::Vector<amrex::Real*> qnodePtr(ad.qnode.size());
@@ -243,16 +298,24 @@ void TiogaInterface::update_solution()
                                            ? m_sim.time().new_time()
                                            : m_sim.time().current_time();
 
-    // Update cell variables on device
+    const int nlevels = repo.num_active_levels();
+    const bool use_patches = !m_exchange_patches.empty();
+    const amrex::Vector<int> all_patches;
+
+    // Update cell variables on device, only patches with receptors have been
+    // modified by the exchange
     {
         int icomp = 0;
         for (const auto& cvar : m_cell_vars) {
             auto& fld = repo.get_field(cvar);
             const int ncomp = fld.num_comp();
             // Host to device copy happens here
-            const int nlevels = repo.num_active_levels();
             for (int lev = 0; lev < nlevels; ++lev) {
-                htod_memcpy(fld(lev), (*m_qcell_host)(lev), icomp, 0, ncomp);
+                copy_patches(
+                    fld(lev), (*m_qcell_host)(lev), icomp, 0, ncomp,
+                    use_patches ? m_exchange_patches.cell_receptor[lev]
+                                : all_patches,
+                    false);
             }
             fld.fillpatch(time_fillpatch);
             icomp += ncomp;
@@ -266,21 +329,42 @@ void TiogaInterface::update_solution()
             auto& fld = repo.get_field(cvar);
             const int ncomp = fld.num_comp();
             // Host to device copy happens here
-            const int nlevels = repo.num_active_levels();
             for (int lev = 0; lev < nlevels; ++lev) {
-                htod_memcpy(fld(lev), (*m_qnode_host)(lev), icomp, 0, ncomp);
+                copy_patches(
+                    fld(lev), (*m_qnode_host)(lev), icomp, 0, ncomp,
+                    use_patches ? m_exchange_patches.node_receptor[lev]
+                                : all_patches,
+                    false);
             }
             fld.fillpatch(time_fillpatch);
             icomp += ncomp;
         }
     }
+}
+
+void TiogaInterface::update_exchange_patches()
+{
+    BL_PROFILE("amr-wind::TiogaInterface::update_exchange_patches");
+    const int nlevels = m_sim.repo().num_active_levels();
+    auto& xp = m_exchange_patches;
+    xp.clear();
+    for (int lev = 0; lev < nlevels; ++lev) {
+        xp.cell_exchange.push_back(flag_patches(m_iblank_cell(lev), false));
+        xp.cell_receptor.push_back(flag_patches(m_iblank_cell(lev), true));
+        xp.node_exchange.push_back(flag_patches(m_iblank_node(lev), false));
+        xp.node_receptor.push_back(flag_patches(m_iblank_node(lev), true));
+    }
+}
 
-    // Release memory to avoid holding onto scratch fields across regrids
+void TiogaInterface::reset_exchange_buffers()
+{
     m_qcell.reset();
     m_qnode.reset();
 
     m_qcell_host.reset();
     m_qnode_host.reset();
+
+    m_exchange_patches.clear();
 }
 
 void TiogaInterface::amr_to_tioga_mesh()
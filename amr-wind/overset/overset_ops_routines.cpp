@@ -2,6 +2,14 @@
 
 namespace amr_wind::overset_ops {
 
+namespace {
+//! Check if a box is in the list of active boxes (all boxes if empty)
+bool is_active(const amrex::Vector<int>& active, const int idx)
+{
+    return active.empty() || (active[idx] != 0);
+}
+} // namespace
+
 /** Convert iblanks to AMReX mask
  *
  *  \f{align}
@@ -220,44 +228,65 @@ void harmonize_vof(
         });
 }
 
+// Flag boxes with overset fringe cells (iblank = -1) within nghost cells
+amrex::Vector<int>
+fringe_box_flags(const amrex::iMultiFab& mf_iblank, const int nghost)
+{
+    amrex::Vector<int> flags(mf_iblank.size(), 0);
+    for (amrex::MFIter mfi(mf_iblank); mfi.isValid(); ++mfi) {
+        const auto& bx = amrex::grow(mfi.validbox(), nghost);
+        if (mf_iblank[mfi].min<amrex::RunOn::Device>(bx, 0) < 0) {
+            flags[mfi.index()] = 1;
+        }
+    }
+    amrex::ParallelDescriptor::ReduceIntMax(
+        flags.data(), static_cast<int>(flags.size()));
+    return flags;
+}
+
 // Populate normal vector with special treatment of overset boundary
 void populate_normal_vector(
     amrex::MultiFab& mf_normvec,
     const amrex::MultiFab& mf_vof,
-    const amrex::iMultiFab& mf_iblank)
+    const amrex::iMultiFab& mf_iblank,
+    const amrex::Vector<int>& active)
 {
-    const auto& normvec = mf_normvec.arrays();
-    const auto& vof = mf_vof.const_arrays();
-    const auto& iblank = mf_iblank.const_arrays();
-    // Calculate gradients in each direction with centered diff
-    amrex::ParallelFor(
-        mf_normvec, mf_normvec.n_grow - amrex::IntVect(1),
-        [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
-            // Neumann condition across nalu bdy
-            int ibdy =
-                (iblank[nbx](i, j, k) != iblank[nbx](i - 1, j, k)) ? -1 : 0;
-            int jbdy =
-                (iblank[nbx](i, j, k) != iblank[nbx](i, j - 1, k)) ? -1 : 0;
-            int kbdy =
-                (iblank[nbx](i, j, k) != iblank[nbx](i, j, k - 1)) ? -1 : 0;
-            // no cell should be isolated such that -1 and 1 are needed
-            ibdy =
-                (iblank[nbx](i, j, k) != iblank[nbx](i + 1, j, k)) ? +1 : ibdy;
-            jbdy =
-                (iblank[nbx](i, j, k) != iblank[nbx](i, j + 1, k)) ? +1 : jbdy;
-            kbdy =
-                (iblank[nbx](i, j, k) != iblank[nbx](i, j, k + 1)) ? +1 : kbdy;
-            // Calculate normal
-            amrex::Real mx, my, mz, mmag;
-            multiphase::youngs_finite_difference_normal_neumann(
-                i, j, k, ibdy, jbdy, kbdy, vof[nbx], mx, my, mz);
-            // Normalize normal
-            mmag = std::sqrt(mx * mx + my * my + mz * mz + 1e-20);
-            // Save normal
-            normvec[nbx](i, j, k, 0) = mx / mmag;
-            normvec[nbx](i, j, k, 1) = my / mmag;
-            normvec[nbx](i, j, k, 2) = mz / mmag;
-        });
+    const auto ngrow = mf_normvec.n_grow - amrex::IntVect(1);
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+    for (amrex::MFIter mfi(mf_normvec, amrex::TilingIfNotGPU()); mfi.isValid();
+         ++mfi) {
+        if (!is_active(active, mfi.index())) {
+            continue;
+        }
+        const auto& bx = mfi.growntilebox(ngrow);
+        const auto& normvec = mf_normvec.array(mfi);
+        const auto& vof = mf_vof.const_array(mfi);
+        const auto& iblank = mf_iblank.const_array(mfi);
+        // Calculate gradients in each direction with centered diff
+        amrex::ParallelFor(
+            bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                // Neumann condition across nalu bdy
+                int ibdy = (iblank(i, j, k) != iblank(i - 1, j, k)) ? -1 : 0;
+                int jbdy = (iblank(i, j, k) != iblank(i, j - 1, k)) ? -1 : 0;
+                int kbdy = (iblank(i, j, k) != iblank(i, j, k - 1)) ? -1 : 0;
+                // no cell should be isolated such that -1 and 1 are needed
+                ibdy = (iblank(i, j, k) != iblank(i + 1, j, k)) ? +1 : ibdy;
+                jbdy = (iblank(i, j, k) != iblank(i, j + 1, k)) ? +1 : jbdy;
+                kbdy = (iblank(i, j, k) != iblank(i, j, k + 1)) ? +1 : kbdy;
+                // Calculate normal
+                amrex::Real mx, my, mz, mmag;
+                multiphase::youngs_finite_difference_normal_neumann(
+                    i, j, k, ibdy, jbdy, kbdy, vof, mx, my, mz);
+                // Normalize normal
+                mmag = std::sqrt(mx * mx + my * my + mz * mz + 1e-20);
+                // Save normal
+                normvec(i, j, k, 0) = mx / mmag;
+                normvec(i, j, k, 1) = my / mmag;
+                normvec(i, j, k, 2) = mz / mmag;
+            });
+    }
 }
 
 // Calculate fluxes for reinitialization over entire domain without concern for
@@ -275,83 +304,56 @@ void populate_sharpen_fluxes(
     const amrex::Real Gamma,
     const amrex::Real margin,
     const amrex::Real rho1,
-    const amrex::Real rho2)
+    const amrex::Real rho2,
+    const amrex::Vector<int>& active)
 {
-    const auto& fx = mf_fx.arrays();
-    const auto& fy = mf_fy.arrays();
-    const auto& fz = mf_fz.arrays();
-    const auto& vof = mf_vof.const_arrays();
-    const auto& tg_vof = mf_target_vof.const_arrays();
-    const auto& norm = mf_norm.const_arrays();
-    const auto& vel = mf_velocity.const_arrays();
-    const auto& gp = mf_gp.const_arrays();
-    const auto& rho = mf_density.const_arrays();
-    amrex::ParallelFor(
-        mf_fx, mf_fx.n_grow,
-        [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
-            // vof flux
-            amrex::Real flux = Gamma * alpha_flux(
-                                           i, j, k, 0, margin, vof[nbx],
-                                           tg_vof[nbx], norm[nbx]);
-            fx[nbx](i, j, k, 0) = flux;
-            // density flux
-            flux *= (rho1 - rho2);
-            fx[nbx](i, j, k, 1) = flux;
-            // momentum fluxes (dens flux * face vel)
-            amrex::Real uf, vf, wf;
-            velocity_face(i, j, k, 0, vof[nbx], vel[nbx], uf, vf, wf);
-            fx[nbx](i, j, k, 2) = flux * uf;
-            fx[nbx](i, j, k, 3) = flux * vf;
-            fx[nbx](i, j, k, 4) = flux * wf;
-            // pressure gradient fluxes
-            gp_rho_face(i, j, k, 0, vof[nbx], gp[nbx], rho[nbx], uf, vf, wf);
-            fx[nbx](i, j, k, 5) = flux * uf;
-            fx[nbx](i, j, k, 6) = flux * vf;
-            fx[nbx](i, j, k, 7) = flux * wf;
-            // Turn "on" all flux faces, later modified in
-            // process_fluxes_calc_src
-            fx[nbx](i, j, k, 8) = 1.0;
-        });
-    amrex::ParallelFor(
-        mf_fy, mf_fy.n_grow,
-        [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
-            amrex::Real flux = Gamma * alpha_flux(
-                                           i, j, k, 1, margin, vof[nbx],
-                                           tg_vof[nbx], norm[nbx]);
-            fy[nbx](i, j, k, 0) = flux;
-            flux *= (rho1 - rho2);
-            fy[nbx](i, j, k, 1) = flux;
-            amrex::Real uf, vf, wf;
-            velocity_face(i, j, k, 1, vof[nbx], vel[nbx], uf, vf, wf);
-            fy[nbx](i, j, k, 2) = flux * uf;
-            fy[nbx](i, j, k, 3) = flux * vf;
-            fy[nbx](i, j, k, 4) = flux * wf;
-            gp_rho_face(i, j, k, 1, vof[nbx], gp[nbx], rho[nbx], uf, vf, wf);
-            fy[nbx](i, j, k, 5) = flux * uf;
-            fy[nbx](i, j, k, 6) = flux * vf;
-            fy[nbx](i, j, k, 7) = flux * wf;
-            fy[nbx](i, j, k, 8) = 1.0;
-        });
-    amrex::ParallelFor(
-        mf_fz, mf_fz.n_grow,
-        [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
-            amrex::Real flux = Gamma * alpha_flux(
-                                           i, j, k, 2, margin, vof[nbx],
-                                           tg_vof[nbx], norm[nbx]);
-            fz[nbx](i, j, k, 0) = flux;
-            flux *= (rho1 - rho2);
-            fz[nbx](i, j, k, 1) = flux;
-            amrex::Real uf, vf, wf;
-            velocity_face(i, j, k, 2, vof[nbx], vel[nbx], uf, vf, wf);
-            fz[nbx](i, j, k, 2) = flux * uf;
-            fz[nbx](i, j, k, 3) = flux * vf;
-            fz[nbx](i, j, k, 4) = flux * wf;
-            gp_rho_face(i, j, k, 2, vof[nbx], gp[nbx], rho[nbx], uf, vf, wf);
-            fz[nbx](i, j, k, 5) = flux * uf;
-            fz[nbx](i, j, k, 6) = flux * vf;
-            fz[nbx](i, j, k, 7) = flux * wf;
-            fz[nbx](i, j, k, 8) = 1.0;
-        });
+    amrex::Array<amrex::MultiFab*, AMREX_SPACEDIM> mf_flux{
+        &mf_fx, &mf_fy, &mf_fz};
+    for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+        auto& mf_f = *mf_flux[dir];
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+        for (amrex::MFIter mfi(mf_f, amrex::TilingIfNotGPU()); mfi.isValid();
+             ++mfi) {
+            if (!is_active(active, mfi.index())) {
+                continue;
+            }
+            const auto& bx = mfi.growntilebox(mf_f.n_grow);
+            const auto& f = mf_f.array(mfi);
+            const auto& vof = mf_vof.const_array(mfi);
+            const auto& tg_vof = mf_target_vof.const_array(mfi);
+            const auto& norm = mf_norm.const_array(mfi);
+            const auto& vel = mf_velocity.const_array(mfi);
+            const auto& gp = mf_gp.const_array(mfi);
+            const auto& rho = mf_density.const_array(mfi);
+            amrex::ParallelFor(
+                bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                    // vof flux
+                    amrex::Real flux =
+                        Gamma *
+                        alpha_flux(i, j, k, dir, margin, vof, tg_vof, norm);
+                    f(i, j, k, 0) = flux;
+                    // density flux
+                    flux *= (rho1 - rho2);
+                    f(i, j, k, 1) = flux;
+                    // momentum fluxes (dens flux * face vel)
+                    amrex::Real uf, vf, wf;
+                    velocity_face(i, j, k, dir, vof, vel, uf, vf, wf);
+                    f(i, j, k, 2) = flux * uf;
+                    f(i, j, k, 3) = flux * vf;
+                    f(i, j, k, 4) = flux * wf;
+                    // pressure gradient fluxes
+                    gp_rho_face(i, j, k, dir, vof, gp, rho, uf, vf, wf);
+                    f(i, j, k, 5) = flux * uf;
+                    f(i, j, k, 6) = flux * vf;
+                    f(i, j, k, 7) = flux * wf;
+                    // Turn "on" all flux faces, later modified in
+                    // process_fluxes_calc_src
+                    f(i, j, k, 8) = 1.0;
+                });
+        }
+    }
 }
 
 // Process reinitialization fluxes - zero non-internal to overset region;
@@ -362,48 +364,55 @@ void process_fluxes_calc_src(
     amrex::MultiFab& mf_fz,
     amrex::MultiFab& mf_psource,
     const amrex::MultiFab& mf_vof,
-    const amrex::iMultiFab& mf_iblank)
+    const amrex::iMultiFab& mf_iblank,
+    const amrex::Vector<int>& active)
 {
-    const auto& fx = mf_fx.arrays();
-    const auto& fy = mf_fy.arrays();
-    const auto& fz = mf_fz.arrays();
-    const auto& sp = mf_psource.arrays();
-    const auto& vof = mf_vof.const_arrays();
-    const auto& iblank = mf_iblank.const_arrays();
     constexpr amrex::Real tiny = std::numeric_limits<amrex::Real>::epsilon();
-    // Zero fluxes based on iblank array
-    amrex::ParallelFor(
-        mf_fx, mf_fx.n_grow, mf_fx.n_comp,
-        [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k, int n) noexcept {
-            const bool zero_all =
-                (iblank[nbx](i - 1, j, k) + iblank[nbx](i, j, k) > -2);
-            fx[nbx](i, j, k, n) *= zero_all ? 0. : 1.;
-        });
-    amrex::ParallelFor(
-        mf_fy, mf_fy.n_grow, mf_fy.n_comp,
-        [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k, int n) noexcept {
-            const bool zero_all =
-                (iblank[nbx](i, j - 1, k) + iblank[nbx](i, j, k) > -2);
-            fy[nbx](i, j, k, n) *= zero_all ? 0. : 1.;
-        });
-    amrex::ParallelFor(
-        mf_fz, mf_fz.n_grow, mf_fz.n_comp,
-        [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k, int n) noexcept {
-            const bool zero_all =
-                (iblank[nbx](i, j, k - 1) + iblank[nbx](i, j, k) > -2);
-            fz[nbx](i, j, k, n) *= zero_all ? 0. : 1.;
-        });
-    // With knowledge of fluxes, compute pressure source term
-    amrex::ParallelFor(
-        mf_psource,
-        [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
-            sp[nbx](i, j, k) =
-                gp_flux_tensor(i, j, k, fx[nbx], fy[nbx], fz[nbx], tiny) &&
-                normal_reinit_tensor(
-                    i, j, k, fx[nbx], fy[nbx], fz[nbx], vof[nbx], tiny);
-        });
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+    for (amrex::MFIter mfi(mf_vof); mfi.isValid(); ++mfi) {
+        if (!is_active(active, mfi.index())) {
+            continue;
+        }
+        const auto& fx = mf_fx.array(mfi);
+        const auto& fy = mf_fy.array(mfi);
+        const auto& fz = mf_fz.array(mfi);
+        const auto& sp = mf_psource.array(mfi);
+        const auto& vof = mf_vof.const_array(mfi);
+        const auto& iblank = mf_iblank.const_array(mfi);
+        // Zero fluxes based on iblank array
+        amrex::ParallelFor(
+            amrex::grow(mf_fx.box(mfi.index()), mf_fx.n_grow), mf_fx.n_comp,
+            [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+                const bool zero_all =
+                    (iblank(i - 1, j, k) + iblank(i, j, k) > -2);
+                fx(i, j, k, n) *= zero_all ? 0. : 1.;
+            });
+        amrex::ParallelFor(
+            amrex::grow(mf_fy.box(mfi.index()), mf_fy.n_grow), mf_fy.n_comp,
+            [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+                const bool zero_all =
+                    (iblank(i, j - 1, k) + iblank(i, j, k) > -2);
+                fy(i, j, k, n) *= zero_all ? 0. : 1.;
+            });
+        amrex::ParallelFor(
+            amrex::grow(mf_fz.box(mfi.index()), mf_fz.n_grow), mf_fz.n_comp,
+            [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+                const bool zero_all =
+                    (iblank(i, j, k - 1) + iblank(i, j, k) > -2);
+                fz(i, j, k, n) *= zero_all ? 0. : 1.;
+            });
+        // With knowledge of fluxes, compute pressure source term
+        amrex::ParallelFor(
+            mf_psource.box(mfi.index()),
+            [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                sp(i, j, k) =
+                    gp_flux_tensor(i, j, k, fx, fy, fz, tiny) &&
+                    normal_reinit_tensor(i, j, k, fx, fy, fz, vof, tiny);
+            });
+    }
 }
-
 amrex::Real calculate_pseudo_velocity_scale(
     const amrex::iMultiFab& mf_iblank,
     const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx,
@@ -422,68 +431,44 @@ amrex::Real calculate_pseudo_dt_flux(
     const amrex::MultiFab& mf_fz,
     const amrex::MultiFab& mf_vof,
     const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& dx,
-    const amrex::Real tol)
+    const amrex::Real tol,
+    const amrex::Vector<int>& active)
 {
+    amrex::ReduceOps<amrex::ReduceOpMin> reduce_op;
+    amrex::ReduceData<amrex::Real> reduce_data(reduce_op);
+    using ReduceTuple = typename decltype(reduce_data)::Type;
+
     // Get the maximum flux magnitude, but just for vof fluxes
-    const amrex::Real pdt_fx = amrex::ReduceMin(
-        mf_fx, mf_vof, 0,
-        [=] AMREX_GPU_HOST_DEVICE(
-            amrex::Box const& bx, amrex::Array4<amrex::Real const> const& fx,
-            amrex::Array4<amrex::Real const> const& vof) -> amrex::Real {
-            amrex::Real pdt_fab = 1.0;
-            amrex::Loop(bx, [=, &pdt_fab](int i, int j, int k) noexcept {
-                amrex::Real pdt_lim = 1.0;
-                if (fx(i, j, k, 0) > tol && vof(i, j, k) > tol) {
-                    // VOF is removed from cell i
-                    pdt_lim = vof(i, j, k) * dx[0] / fx(i, j, k, 0);
-                } else if (fx(i, j, k, 0) < -tol && vof(i - 1, j, k) > tol) {
-                    // VOF is removed from cell i-1
-                    pdt_lim = vof(i - 1, j, k) * dx[0] / -fx(i, j, k, 0);
-                }
-                pdt_fab = amrex::min(pdt_fab, pdt_lim);
-            });
-            return pdt_fab;
-        });
-    const amrex::Real pdt_fy = amrex::ReduceMin(
-        mf_fy, mf_vof, 0,
-        [=] AMREX_GPU_HOST_DEVICE(
-            amrex::Box const& bx, amrex::Array4<amrex::Real const> const& fy,
-            amrex::Array4<amrex::Real const> const& vof) -> amrex::Real {
-            amrex::Real pdt_fab = 1.0;
-            amrex::Loop(bx, [=, &pdt_fab](int i, int j, int k) noexcept {
-                amrex::Real pdt_lim = 1.0;
-                if (fy(i, j, k, 0) > tol && vof(i, j, k) > tol) {
-                    // VOF is removed from cell j
-                    pdt_lim = vof(i, j, k) * dx[1] / fy(i, j, k, 0);
-                } else if (fy(i, j, k, 0) < -tol && vof(i, j - 1, k) > tol) {
-                    // VOF is removed from cell j-1
-                    pdt_lim = vof(i, j - 1, k) * dx[1] / -fy(i, j, k, 0);
-                }
-                pdt_fab = amrex::min(pdt_fab, pdt_lim);
-            });
-            return pdt_fab;
-        });
-    const amrex::Real pdt_fz = amrex::ReduceMin(
-        mf_fz, mf_vof, 0,
-        [=] AMREX_GPU_HOST_DEVICE(
-            amrex::Box const& bx, amrex::Array4<amrex::Real const> const& fz,
-            amrex::Array4<amrex::Real const> const& vof) -> amrex::Real {
-            amrex::Real pdt_fab = 1.0;
-            amrex::Loop(bx, [=, &pdt_fab](int i, int j, int k) noexcept {
-                amrex::Real pdt_lim = 1.0;
-                if (fz(i, j, k, 0) > tol && vof(i, j, k) > tol) {
-                    // VOF is removed from cell k
-                    pdt_lim = vof(i, j, k) * dx[2] / fz(i, j, k, 0);
-                } else if (fz(i, j, k, 0) < -tol && vof(i, j, k - 1) > tol) {
-                    // VOF is removed from cell k-1
-                    pdt_lim = vof(i, j, k - 1) * dx[2] / -fz(i, j, k, 0);
-                }
-                pdt_fab = amrex::min(pdt_fab, pdt_lim);
-            });
-            return pdt_fab;
-        });
-    const amrex::Real pdt = amrex::min(pdt_fx, amrex::min(pdt_fy, pdt_fz));
-    return pdt;
+    const amrex::Array<const amrex::MultiFab*, AMREX_SPACEDIM> mf_flux{
+        &mf_fx, &mf_fy, &mf_fz};
+    for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+        const auto& mf_f = *mf_flux[dir];
+        const auto iv = amrex::IntVect::TheDimensionVector(dir);
+        const amrex::Real dxd = dx[dir];
+        for (amrex::MFIter mfi(mf_f); mfi.isValid(); ++mfi) {
+            if (!is_active(active, mfi.index())) {
+                continue;
+            }
+            const auto& f = mf_f.const_array(mfi);
+            const auto& vof = mf_vof.const_array(mfi);
+            reduce_op.eval(
+                mfi.validbox(), reduce_data,
+                [=] AMREX_GPU_DEVICE(int i, int j, int k) -> ReduceTuple {
+                    amrex::Real pdt_lim = 1.0;
+                    const amrex::IntVect ivc(i, j, k);
+                    if (f(i, j, k, 0) > tol && vof(ivc) > tol) {
+                        // VOF is removed from cell on high side of face
+                        pdt_lim = vof(ivc) * dxd / f(i, j, k, 0);
+                    } else if (f(i, j, k, 0) < -tol && vof(ivc - iv) > tol) {
+                        // VOF is removed from cell on low side of face
+                        pdt_lim = vof(ivc - iv) * dxd / -f(i, j, k, 0);
+                    }
+                    return {pdt_lim};
+                });
+        }
+    }
+    const amrex::Real pdt = amrex::get<0>(reduce_data.value(reduce_op));
+    return amrex::min<amrex::Real>(pdt, 1.0);
 }
 
 // Apply reinitialization fluxes to modify fields
@@ -499,123 +484,126 @@ void apply_fluxes(
     amrex::MultiFab& mf_pressure,
     const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx,
     const amrex::Real ptfac,
-    const amrex::Real vof_tol)
+    const amrex::Real vof_tol,
+    const amrex::Vector<int>& active)
 {
-    const auto& fx = mf_fx.const_arrays();
-    const auto& fy = mf_fy.const_arrays();
-    const auto& fz = mf_fz.const_arrays();
-    const auto& sp = mf_psource.const_arrays();
-    const auto& vof = mf_vof.arrays();
-    const auto& dens = mf_dens.arrays();
-    const auto& vel = mf_vel.arrays();
-    const auto& gp = mf_gp.arrays();
-    const auto& p = mf_pressure.arrays();
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+    for (amrex::MFIter mfi(mf_vof, amrex::TilingIfNotGPU()); mfi.isValid();
+         ++mfi) {
+        if (!is_active(active, mfi.index())) {
+            continue;
+        }
+        const auto& fx = mf_fx.const_array(mfi);
+        const auto& fy = mf_fy.const_array(mfi);
+        const auto& fz = mf_fz.const_array(mfi);
+        const auto& vof = mf_vof.array(mfi);
+        const auto& dens = mf_dens.array(mfi);
+        const auto& vel = mf_vel.array(mfi);
+        const auto& gp = mf_gp.array(mfi);
+        amrex::ParallelFor(
+            mfi.tilebox(), [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                // Divergence of the fluxes for a component
+                const auto div = [=](const int n) {
+                    return (fx(i + 1, j, k, n) - fx(i, j, k, n)) / dx[0] +
+                           (fy(i, j + 1, k, n) - fy(i, j, k, n)) / dx[1] +
+                           (fz(i, j, k + 1, n) - fz(i, j, k, n)) / dx[2];
+                };
+                const amrex::Real olddens = dens(i, j, k);
+                vof(i, j, k) += ptfac * div(0);
+                dens(i, j, k) += ptfac * div(1);
+                for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+                    vel(i, j, k, n) =
+                        1.0 / dens(i, j, k) *
+                        (olddens * vel(i, j, k, n) + ptfac * div(2 + n));
+                }
+                for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+                    gp(i, j, k, n) += ptfac * div(5 + n);
+                }
 
-    amrex::ParallelFor(
-        mf_vof, [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
-            const amrex::Real olddens = dens[nbx](i, j, k);
-            vof[nbx](i, j, k) +=
-                ptfac *
-                ((fx[nbx](i + 1, j, k, 0) - fx[nbx](i, j, k, 0)) / dx[0] +
-                 (fy[nbx](i, j + 1, k, 0) - fy[nbx](i, j, k, 0)) / dx[1] +
-                 (fz[nbx](i, j, k + 1, 0) - fz[nbx](i, j, k, 0)) / dx[2]);
-            dens[nbx](i, j, k) +=
-                ptfac *
-                ((fx[nbx](i + 1, j, k, 1) - fx[nbx](i, j, k, 1)) / dx[0] +
-                 (fy[nbx](i, j + 1, k, 1) - fy[nbx](i, j, k, 1)) / dx[1] +
-                 (fz[nbx](i, j, k + 1, 1) - fz[nbx](i, j, k, 1)) / dx[2]);
-            vel[nbx](i, j, k, 0) =
-                1.0 / dens[nbx](i, j, k) *
-                (olddens * vel[nbx](i, j, k, 0) +
-                 ptfac *
-                     ((fx[nbx](i + 1, j, k, 2) - fx[nbx](i, j, k, 2)) / dx[0] +
-                      (fy[nbx](i, j + 1, k, 2) - fy[nbx](i, j, k, 2)) / dx[1] +
-                      (fz[nbx](i, j, k + 1, 2) - fz[nbx](i, j, k, 2)) / dx[2]));
-            vel[nbx](i, j, k, 1) =
-                1.0 / dens[nbx](i, j, k) *
-                (olddens * vel[nbx](i, j, k, 1) +
-                 ptfac *
-                     ((fx[nbx](i + 1, j, k, 3) - fx[nbx](i, j, k, 3)) / dx[0] +
-                      (fy[nbx](i, j + 1, k, 3) - fy[nbx](i, j, k, 3)) / dx[1] +
-                      (fz[nbx](i, j, k + 1, 3) - fz[nbx](i, j, k, 3)) / dx[2]));
-            vel[nbx](i, j, k, 2) =
-                1.0 / dens[nbx](i, j, k) *
-                (olddens * vel[nbx](i, j, k, 2) +
-                 ptfac *
-                     ((fx[nbx](i + 1, j, k, 4) - fx[nbx](i, j, k, 4)) / dx[0] +
-                      (fy[nbx](i, j + 1, k, 4) - fy[nbx](i, j, k, 4)) / dx[1] +
-                      (fz[nbx](i, j, k + 1, 4) - fz[nbx](i, j, k, 4)) / dx[2]));
-            gp[nbx](i, j, k, 0) +=
-                ptfac *
-                ((fx[nbx](i + 1, j, k, 5) - fx[nbx](i, j, k, 5)) / dx[0] +
-                 (fy[nbx](i, j + 1, k, 5) - fy[nbx](i, j, k, 5)) / dx[1] +
-                 (fz[nbx](i, j, k + 1, 5) - fz[nbx](i, j, k, 5)) / dx[2]);
-            gp[nbx](i, j, k, 1) +=
-                ptfac *
-                ((fx[nbx](i + 1, j, k, 6) - fx[nbx](i, j, k, 6)) / dx[0] +
-                 (fy[nbx](i, j + 1, k, 6) - fy[nbx](i, j, k, 6)) / dx[1] +
-                 (fz[nbx](i, j, k + 1, 6) - fz[nbx](i, j, k, 6)) / dx[2]);
-            gp[nbx](i, j, k, 2) +=
-                ptfac *
-                ((fx[nbx](i + 1, j, k, 7) - fx[nbx](i, j, k, 7)) / dx[0] +
-                 (fy[nbx](i, j + 1, k, 7) - fy[nbx](i, j, k, 7)) / dx[1] +
-                 (fz[nbx](i, j, k + 1, 7) - fz[nbx](i, j, k, 7)) / dx[2]);
-
-            // Ensure vof is bounded
-            vof[nbx](i, j, k) =
-                vof[nbx](i, j, k) < vof_tol
-                    ? 0.0
-                    : (vof[nbx](i, j, k) > 1. - vof_tol ? 1.
-                                                        : vof[nbx](i, j, k));
-            // Density bounds are enforced elsewhere
-        });
-    amrex::ParallelFor(
-        mf_pressure,
-        [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
-            p[nbx](i, j, k) += ptfac * sp[nbx](i, j, k);
-        });
+                // Ensure vof is bounded
+                const amrex::Real vof_new = vof(i, j, k);
+                vof(i, j, k) = vof_new < vof_tol
+                                   ? 0.0
+                                   : (vof_new > 1. - vof_tol ? 1. : vof_new);
+                // Density bounds are enforced elsewhere
+            });
+    }
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+    for (amrex::MFIter mfi(mf_pressure, amrex::TilingIfNotGPU());
+         mfi.isValid(); ++mfi) {
+        if (!is_active(active, mfi.index())) {
+            continue;
+        }
+        const auto& sp = mf_psource.const_array(mfi);
+        const auto& p = mf_pressure.array(mfi);
+        amrex::ParallelFor(
+            mfi.tilebox(), [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                p(i, j, k) += ptfac * sp(i, j, k);
+            });
+    }
+}
+
+// Bound vof in the boxes that are not flagged as active
+void process_vof_inactive(
+    amrex::MultiFab& mf_vof,
+    const amrex::Real vof_tol,
+    const amrex::Vector<int>& active)
+{
+    if (active.empty()) {
+        return;
+    }
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+    for (amrex::MFIter mfi(mf_vof, amrex::TilingIfNotGPU()); mfi.isValid();
+         ++mfi) {
+        if (active[mfi.index()] != 0) {
+            continue;
+        }
+        const auto& vof = mf_vof.array(mfi);
+        amrex::ParallelFor(
+            mfi.tilebox(), [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                const amrex::Real vof_old = vof(i, j, k);
+                vof(i, j, k) = vof_old < vof_tol
+                                   ? 0.0
+                                   : (vof_old > 1. - vof_tol ? 1. : vof_old);
+            });
+    }
 }
 
 // Get the size of the smallest VOF flux to quantify convergence
 amrex::Real measure_convergence(
-    amrex::MultiFab& mf_fx, amrex::MultiFab& mf_fy, amrex::MultiFab& mf_fz)
+    amrex::MultiFab& mf_fx,
+    amrex::MultiFab& mf_fy,
+    amrex::MultiFab& mf_fz,
+    const amrex::Vector<int>& active)
 {
+    amrex::ReduceOps<amrex::ReduceOpMax> reduce_op;
+    amrex::ReduceData<amrex::Real> reduce_data(reduce_op);
+    using ReduceTuple = typename decltype(reduce_data)::Type;
+
     // Get the maximum flux magnitude, but just for vof fluxes
-    const amrex::Real err_fx = amrex::ReduceMax(
-        mf_fx, 0,
-        [=] AMREX_GPU_HOST_DEVICE(
-            amrex::Box const& bx,
-            amrex::Array4<amrex::Real const> const& fx) -> amrex::Real {
-            amrex::Real err_fab = -1.0;
-            amrex::Loop(bx, [=, &err_fab](int i, int j, int k) noexcept {
-                err_fab = amrex::max(err_fab, std::abs(fx(i, j, k, 0)));
-            });
-            return err_fab;
-        });
-    const amrex::Real err_fy = amrex::ReduceMax(
-        mf_fy, 0,
-        [=] AMREX_GPU_HOST_DEVICE(
-            amrex::Box const& bx,
-            amrex::Array4<amrex::Real const> const& fy) -> amrex::Real {
-            amrex::Real err_fab = -1.0;
-            amrex::Loop(bx, [=, &err_fab](int i, int j, int k) noexcept {
-                err_fab = amrex::max(err_fab, std::abs(fy(i, j, k, 0)));
-            });
-            return err_fab;
-        });
-    const amrex::Real err_fz = amrex::ReduceMax(
-        mf_fz, 0,
-        [=] AMREX_GPU_HOST_DEVICE(
-            amrex::Box const& bx,
-            amrex::Array4<amrex::Real const> const& fz) -> amrex::Real {
-            amrex::Real err_fab = -1.0;
-            amrex::Loop(bx, [=, &err_fab](int i, int j, int k) noexcept {
-                err_fab = amrex::max(err_fab, std::abs(fz(i, j, k, 0)));
-            });
-            return err_fab;
-        });
-    const amrex::Real err = amrex::max(err_fx, amrex::max(err_fy, err_fz));
-    return err;
+    const amrex::Array<const amrex::MultiFab*, AMREX_SPACEDIM> mf_flux{
+        &mf_fx, &mf_fy, &mf_fz};
+    for (const auto* mf_f : mf_flux) {
+        for (amrex::MFIter mfi(*mf_f); mfi.isValid(); ++mfi) {
+            if (!is_active(active, mfi.index())) {
+                continue;
+            }
+            const auto& f = mf_f->const_array(mfi);
+            reduce_op.eval(
+                mfi.validbox(), reduce_data,
+                [=] AMREX_GPU_DEVICE(int i, int j, int k) -> ReduceTuple {
+                    return {std::abs(f(i, j, k, 0))};
+                });
+        }
+    }
+    const amrex::Real err = amrex::get<0>(reduce_data.value(reduce_op));
+    return amrex::max<amrex::Real>(err, -1.0);
 }
 
 // Set levelset field to another quantity to view in plotfile for debugging
@@ -11,8 +11,8 @@ namespace amr_wind::forestdrag {
 
 ForestDrag::ForestDrag(CFDSim& sim)
     : m_sim(sim)
-    , m_forest_drag(sim.repo().declare_field("forest_drag", 1, 1, 1))
-    , m_forest_id(sim.repo().declare_field("forest_id", 1, 1, 1))
+    , m_forest_drag(sim.repo().declare_float_field("forest_drag", 1, 1))
+    , m_forest_id(sim.repo().declare_float_field("forest_id", 1, 1))
 {
 
     amrex::ParmParse pp(identifier());
@@ -23,8 +23,6 @@ ForestDrag::ForestDrag(CFDSim& sim)
 
     m_forest_drag.setVal(0.0);
     m_forest_id.setVal(-1.0);
-    m_forest_id.set_default_fillpatch_bc(m_sim.time());
-    m_forest_drag.set_default_fillpatch_bc(m_sim.time());
 }
 
 void ForestDrag::initialize_fields(int level, const amrex::Geometry& geom)
@@ -41,8 +39,8 @@ void ForestDrag::initialize_fields(int level, const amrex::Geometry& geom)
     const auto& prob_lo = geom.ProbLoArray();
     auto& drag = m_forest_drag(level);
     auto& fst_id = m_forest_id(level);
-    drag.setVal(0.0);
-    fst_id.setVal(-1.0);
+    drag.setVal(0.0F);
+    fst_id.setVal(-1.0F);
 #ifdef AMREX_USE_OMP
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
 #endif
@@ -66,15 +64,22 @@ void ForestDrag::initialize_fields(int level, const amrex::Geometry& geom)
                         if (z <= fst.m_height_forest &&
                             radius <= (0.5 * fst.m_diameter_forest)) {
                             const auto treelaimax = fst.lm();
-                            levelId(i, j, k) = fst.m_id;
-                            levelDrag(i, j, k) +=
+                            levelId(i, j, k) = static_cast<float>(fst.m_id);
+                            levelDrag(i, j, k) += static_cast<float>(
                                 fst.m_cd_forest *
-                                fst.area_fraction(z, treelaimax);
+                                fst.area_fraction(z, treelaimax));
                         }
                     });
             }
         }
     }
+
+    const auto& drag_arrs = drag.const_arrays();
+    m_active_cells.build(
+        level, drag,
+        [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
+            return drag_arrs[nbx](i, j, k) != 0.0F;
+        });
 }
 
 void ForestDrag::post_regrid_actions()
@@ -83,6 +88,7 @@ void ForestDrag::post_regrid_actions()
     for (int lev = 0; lev < nlevels; ++lev) {
         initialize_fields(lev, m_sim.repo().mesh().Geom(lev));
     }
+    m_active_cells.set_num_levels(nlevels);
 }
 
 amrex::Vector<Forest> ForestDrag::read_forest(const int level) const
@@ -4,14 +4,171 @@
 #include "AMReX_MultiFabUtil.H"
 #include "AMReX_ParmParse.H"
 #include "AMReX_ParReduce.H"
+#include "AMReX_VisMF.H"
+#include "AMReX_Utility.H"
 #include "amr-wind/utilities/trig_ops.H"
 #include "amr-wind/utilities/IOManager.H"
 #include "amr-wind/utilities/io_utils.H"
 #include "amr-wind/utilities/linear_interpolation.H"
 
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
 namespace amr_wind::terraindrag {
 
-namespace {} // namespace
+namespace {
+
+//! Read a flat grid file on the I/O rank and broadcast it to all ranks
+void read_and_bcast_flat_grid_file(
+    const std::string& fname,
+    const bool optional,
+    amrex::Vector<amrex::Real>& xs,
+    amrex::Vector<amrex::Real>& ys,
+    amrex::Vector<amrex::Real>& zs)
+{
+    const int root = amrex::ParallelDescriptor::IOProcessorNumber();
+    amrex::Vector<int> sizes{0, 0};
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        std::ifstream file(fname, std::ios::in);
+        if (!optional || file.good()) {
+            ioutils::read_flat_grid_file(fname, xs, ys, zs);
+            sizes[0] = static_cast<int>(xs.size());
+            sizes[1] = static_cast<int>(ys.size());
+        }
+    }
+    amrex::ParallelDescriptor::Bcast(sizes.data(), sizes.size(), root);
+
+    xs.resize(sizes[0]);
+    ys.resize(sizes[1]);
+    zs.resize(static_cast<size_t>(sizes[0]) * sizes[1]);
+    if (zs.empty()) {
+        return;
+    }
+    amrex::ParallelDescriptor::Bcast(xs.data(), xs.size(), root);
+    amrex::ParallelDescriptor::Bcast(ys.data(), ys.size(), root);
+    amrex::ParallelDescriptor::Bcast(zs.data(), zs.size(), root);
+}
+
+//! Path, size and modification time of a file, used to validate caches
+std::string file_identity(const std::string& fname)
+{
+    std::error_code ec;
+    const auto path = std::filesystem::absolute(fname, ec);
+    const auto size = std::filesystem::file_size(path, ec);
+    if (ec) {
+        return path.string() + " missing";
+    }
+    const auto mtime = std::filesystem::last_write_time(path, ec);
+    std::ostringstream oss;
+    oss << path.string() << " " << size << " "
+        << mtime.time_since_epoch().count();
+    return oss.str();
+}
+
+//! Check if a coordinate array is uniformly spaced
+bool is_uniform(const amrex::Vector<amrex::Real>& xs)
+{
+    if (xs.size() < 2) {
+        return false;
+    }
+    const amrex::Real dx =
+        (xs.back() - xs.front()) / static_cast<amrex::Real>(xs.size() - 1);
+    for (int n = 0; n < static_cast<int>(xs.size()) - 1; ++n) {
+        if (std::abs(xs[n + 1] - xs[n] - dx) > 1.0e-6 * std::abs(dx)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** Device copy of the part of a flat grid covering a bounding box
+ *
+ *  The window includes the grid points bracketing the bounding box so that
+ *  interpolation gives the same result as with the full grid.
+ */
+struct FlatGridWindow
+{
+    amrex::Gpu::DeviceVector<amrex::Real> xs;
+    amrex::Gpu::DeviceVector<amrex::Real> ys;
+    amrex::Gpu::DeviceVector<amrex::Real> zs;
+    bool uniform_x{false};
+    bool uniform_y{false};
+
+    FlatGridWindow(
+        const amrex::Vector<amrex::Real>& xin,
+        const amrex::Vector<amrex::Real>& yin,
+        const amrex::Vector<amrex::Real>& zin,
+        const amrex::RealBox& bbox)
+    {
+        if (zin.empty()) {
+            return;
+        }
+        const auto window = [](const amrex::Vector<amrex::Real>& x,
+                               const amrex::Real lo, const amrex::Real hi) {
+            const int n = static_cast<int>(x.size());
+            const int ilo = amrex::max(
+                0, static_cast<int>(
+                       std::upper_bound(x.begin(), x.end(), lo) - x.begin()) -
+                       1);
+            const int ihi = amrex::min(
+                n - 1, static_cast<int>(
+                           std::lower_bound(x.begin(), x.end(), hi) -
+                           x.begin()));
+            return std::make_pair(ilo, amrex::max(ilo, ihi));
+        };
+        const auto [ilo, ihi] = window(xin, bbox.lo(0), bbox.hi(0));
+        const auto [jlo, jhi] = window(yin, bbox.lo(1), bbox.hi(1));
+        const int nx = ihi - ilo + 1;
+        const int ny = jhi - jlo + 1;
+        const int ny_in = static_cast<int>(yin.size());
+
+        amrex::Vector<amrex::Real> zwin(static_cast<size_t>(nx) * ny);
+        for (int i = 0; i < nx; ++i) {
+            for (int j = 0; j < ny; ++j) {
+                zwin[i * ny + j] = zin[(ilo + i) * ny_in + (jlo + j)];
+            }
+        }
+
+        xs.resize(nx);
+        ys.resize(ny);
+        zs.resize(zwin.size());
+        amrex::Gpu::copy(
+            amrex::Gpu::hostToDevice, xin.begin() + ilo,
+            xin.begin() + ihi + 1, xs.begin());
+        amrex::Gpu::copy(
+            amrex::Gpu::hostToDevice, yin.begin() + jlo,
+            yin.begin() + jhi + 1, ys.begin());
+        amrex::Gpu::copy(
+            amrex::Gpu::hostToDevice, zwin.begin(), zwin.end(), zs.begin());
+
+        uniform_x = (nx > 1) && is_uniform(xin);
+        uniform_y = (ny > 1) && is_uniform(yin);
+    }
+};
+
+//! Bilinear interpolation on a flat grid, O(1) lookup for uniform grids
+AMREX_GPU_DEVICE AMREX_FORCE_INLINE amrex::Real interp_flat_grid(
+    const amrex::Real* xs,
+    const int nx,
+    const bool uniform_x,
+    const amrex::Real* ys,
+    const int ny,
+    const bool uniform_y,
+    const amrex::Real* zs,
+    const amrex::Real x,
+    const amrex::Real y)
+{
+    const auto xidx = uniform_x ? interp::uniform_search(xs, xs + nx, x)
+                                : interp::bisection_search(xs, xs + nx, x);
+    const auto yidx = uniform_y ? interp::uniform_search(ys, ys + ny, y)
+                                : interp::bisection_search(ys, ys + ny, y);
+    return interp::bilinear_impl(xs, ys, ny, zs, x, y, xidx, yidx);
+}
+
+} // namespace
 
 TerrainDrag::TerrainDrag(CFDSim& sim)
     : m_sim(sim)
@@ -19,8 +176,9 @@ TerrainDrag::TerrainDrag(CFDSim& sim)
     , m_mesh(sim.mesh())
     , m_terrain_blank(sim.repo().declare_int_field("terrain_blank", 1, 1, 1))
     , m_terrain_drag(sim.repo().declare_int_field("terrain_drag", 1, 1, 1))
-    , m_terrainz0(sim.repo().declare_field("terrainz0", 1, 1, 1))
-    , m_terrain_height(sim.repo().declare_field("terrain_height", 1, 1, 1))
+    , m_terrainz0(sim.repo().declare_float_field("terrainz0", 1, 1, 1))
+    , m_terrain_height(
+          sim.repo().declare_float_field("terrain_height", 1, 1, 1))
 {
 
     m_terrain_is_waves = sim.physics_manager().contains("OceanWaves") &&
@@ -30,6 +188,7 @@ TerrainDrag::TerrainDrag(CFDSim& sim)
         amrex::ParmParse pp(identifier());
         pp.query("terrain_file", m_terrain_file);
         pp.query("roughness_file", m_roughness_file);
+        pp.query("terrain_cache", m_terrain_cache);
     } else {
         m_wave_volume_fraction = &m_repo.get_field(m_wave_volume_fraction_name);
         m_wave_negative_elevation =
@@ -38,13 +197,13 @@ TerrainDrag::TerrainDrag(CFDSim& sim)
 
     m_sim.io_manager().register_output_int_var("terrain_drag");
     m_sim.io_manager().register_output_int_var("terrain_blank");
-    m_sim.io_manager().register_io_var("terrainz0");
-    m_sim.io_manager().register_io_var("terrain_height");
+    m_sim.io_manager().register_output_var("terrainz0");
+    m_sim.io_manager().register_output_var("terrain_height");
 
     m_terrain_blank.setVal(0.0);
     m_terrain_drag.setVal(0.0);
-    m_terrainz0.set_default_fillpatch_bc(m_sim.time());
-    m_terrain_height.set_default_fillpatch_bc(m_sim.time());
+    m_terrainz0.setVal(0.0);
+    m_terrain_height.setVal(0.0);
 }
 
 void TerrainDrag::initialize_fields(int level, const amrex::Geometry& geom)
@@ -55,65 +214,28 @@ void TerrainDrag::initialize_fields(int level, const amrex::Geometry& geom)
 
     BL_PROFILE("amr-wind::" + this->identifier() + "::initialize_fields");
 
-    //! Reading the Terrain Coordinates from  file
-    amrex::Vector<amrex::Real> xterrain;
-    amrex::Vector<amrex::Real> yterrain;
-    amrex::Vector<amrex::Real> zterrain;
-    ioutils::read_flat_grid_file(m_terrain_file, xterrain, yterrain, zterrain);
+    const auto& columns = terrain_columns(level, geom);
 
-    // No checks for the file as it is optional currently
-    amrex::Vector<amrex::Real> xrough;
-    amrex::Vector<amrex::Real> yrough;
-    amrex::Vector<amrex::Real> z0rough;
-    std::ifstream file(m_roughness_file, std::ios::in);
-    if (file.good()) {
-        ioutils::read_flat_grid_file(m_roughness_file, xrough, yrough, z0rough);
+    // Gather the column data matching the boxes of this level
+    auto& blanking = m_terrain_blank(level);
+    const int klo = geom.Domain().smallEnd(2);
+    amrex::BoxList col_bl(blanking.boxArray());
+    for (auto& bx : col_bl) {
+        bx.setRange(2, klo);
     }
-    file.close();
+    amrex::MultiFab level_columns(
+        amrex::BoxArray(std::move(col_bl)), blanking.DistributionMap(),
+        columns.nComp(), m_terrain_blank.num_grow());
+    level_columns.ParallelCopy(
+        columns, 0, 0, columns.nComp(), columns.nGrowVect(),
+        level_columns.nGrowVect());
 
     const auto& dx = geom.CellSizeArray();
     const auto& prob_lo = geom.ProbLoArray();
-    auto& blanking = m_terrain_blank(level);
     auto& terrainz0 = m_terrainz0(level);
     auto& terrain_height = m_terrain_height(level);
     auto& drag = m_terrain_drag(level);
-    const auto xterrain_size = xterrain.size();
-    const auto yterrain_size = yterrain.size();
-    const auto zterrain_size = zterrain.size();
-    amrex::Gpu::DeviceVector<amrex::Real> d_xterrain(xterrain_size);
-    amrex::Gpu::DeviceVector<amrex::Real> d_yterrain(yterrain_size);
-    amrex::Gpu::DeviceVector<amrex::Real> d_zterrain(zterrain_size);
-    amrex::Gpu::copy(
-        amrex::Gpu::hostToDevice, xterrain.begin(), xterrain.end(),
-        d_xterrain.begin());
-    amrex::Gpu::copy(
-        amrex::Gpu::hostToDevice, yterrain.begin(), yterrain.end(),
-        d_yterrain.begin());
-    amrex::Gpu::copy(
-        amrex::Gpu::hostToDevice, zterrain.begin(), zterrain.end(),
-        d_zterrain.begin());
-    const auto* xterrain_ptr = d_xterrain.data();
-    const auto* yterrain_ptr = d_yterrain.data();
-    const auto* zterrain_ptr = d_zterrain.data();
-    // Copy Roughness to gpu
-    const auto xrough_size = xrough.size();
-    const auto yrough_size = yrough.size();
-    const auto z0rough_size = z0rough.size();
-    amrex::Gpu::DeviceVector<amrex::Real> d_xrough(xrough_size);
-    amrex::Gpu::DeviceVector<amrex::Real> d_yrough(yrough_size);
-    amrex::Gpu::DeviceVector<amrex::Real> d_z0rough(z0rough_size);
-    amrex::Gpu::copy(
-        amrex::Gpu::hostToDevice, xrough.begin(), xrough.end(),
-        d_xrough.begin());
-    amrex::Gpu::copy(
-        amrex::Gpu::hostToDevice, yrough.begin(), yrough.end(),
-        d_yrough.begin());
-    amrex::Gpu::copy(
-        amrex::Gpu::hostToDevice, z0rough.begin(), z0rough.end(),
-        d_z0rough.begin());
-    const auto* xrough_ptr = d_xrough.data();
-    const auto* yrough_ptr = d_yrough.data();
-    const auto* z0rough_ptr = d_z0rough.data();
+    const auto& col_arrs = level_columns.const_arrays();
     auto levelBlanking = blanking.arrays();
     auto levelDrag = drag.arrays();
     auto levelz0 = terrainz0.arrays();
@@ -121,23 +243,13 @@ void TerrainDrag::initialize_fields(int level, const amrex::Geometry& geom)
     amrex::ParallelFor(
         blanking, m_terrain_blank.num_grow(),
         [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
-            const amrex::Real x = prob_lo[0] + (i + 0.5) * dx[0];
-            const amrex::Real y = prob_lo[1] + (j + 0.5) * dx[1];
             const amrex::Real z = prob_lo[2] + (k + 0.5) * dx[2];
-            const amrex::Real terrainHt = interp::bilinear(
-                xterrain_ptr, xterrain_ptr + xterrain_size, yterrain_ptr,
-                yterrain_ptr + yterrain_size, zterrain_ptr, x, y);
+            const amrex::Real terrainHt = col_arrs[nbx](i, j, klo, 0);
             levelBlanking[nbx](i, j, k, 0) =
                 static_cast<int>((z <= terrainHt) && (z > prob_lo[2]));
-            levelheight[nbx](i, j, k, 0) = terrainHt;
-
-            amrex::Real roughz0 = 0.1;
-            if (xrough_size > 0) {
-                roughz0 = interp::bilinear(
-                    xrough_ptr, xrough_ptr + xrough_size, yrough_ptr,
-                    yrough_ptr + yrough_size, z0rough_ptr, x, y);
-            }
-            levelz0[nbx](i, j, k, 0) = roughz0;
+            levelheight[nbx](i, j, k, 0) = static_cast<float>(terrainHt);
+            levelz0[nbx](i, j, k, 0) =
+                static_cast<float>(col_arrs[nbx](i, j, klo, 1));
         });
     amrex::Gpu::streamSynchronize();
     amrex::ParallelFor(
@@ -150,6 +262,224 @@ void TerrainDrag::initialize_fields(int level, const amrex::Geometry& geom)
             }
         });
     amrex::Gpu::streamSynchronize();
+
+    update_active_cells(level);
+}
+
+void TerrainDrag::update_active_cells(int level)
+{
+    BL_PROFILE("amr-wind::" + this->identifier() + "::update_active_cells");
+    const auto& blanking = m_terrain_blank(level);
+    const auto& blank_arrs = blanking.const_arrays();
+    const auto& drag_arrs = m_terrain_drag(level).const_arrays();
+    m_active_cells.build(
+        level, blanking,
+        [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
+            return (blank_arrs[nbx](i, j, k) == 1) ||
+                   (drag_arrs[nbx](i, j, k) == 1);
+        });
+}
+
+void TerrainDrag::update_active_cells(
+    int level, const amrex::Vector<int>& changed)
+{
+    BL_PROFILE("amr-wind::" + this->identifier() + "::update_active_cells");
+    const auto& blanking = m_terrain_blank(level);
+    const auto& blank_arrs = blanking.const_arrays();
+    const auto& drag_arrs = m_terrain_drag(level).const_arrays();
+    m_active_cells.update(
+        level, blanking, changed,
+        [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
+            return (blank_arrs[nbx](i, j, k) == 1) ||
+                   (drag_arrs[nbx](i, j, k) == 1);
+        });
+}
+
+void TerrainDrag::read_terrain_data()
+{
+    if (m_terrain_data_read) {
+        return;
+    }
+    BL_PROFILE("amr-wind::" + this->identifier() + "::read_terrain_data");
+
+    read_and_bcast_flat_grid_file(
+        m_terrain_file, false, m_xterrain, m_yterrain, m_zterrain);
+    // No checks for the file as it is optional currently
+    read_and_bcast_flat_grid_file(
+        m_roughness_file, true, m_xrough, m_yrough, m_z0rough);
+    m_terrain_data_read = true;
+}
+
+const amrex::MultiFab&
+TerrainDrag::terrain_columns(int level, const amrex::Geometry& geom)
+{
+    if (level >= static_cast<int>(m_terrain_columns.size())) {
+        m_terrain_columns.resize(level + 1);
+    }
+
+    // Terrain height and roughness only depend on the (x, y) location, so
+    // they are stored on a single layer of cells spanning the level domain
+    amrex::Box slab = geom.Domain();
+    slab.setRange(2, slab.smallEnd(2));
+    auto& columns = m_terrain_columns[level];
+    if (columns && (columns->boxArray().minimalBox() == slab)) {
+        return *columns;
+    }
+
+    amrex::BoxArray ba(slab);
+    ba.maxSize(m_mesh.maxGridSize(level));
+    columns = std::make_unique<amrex::MultiFab>(
+        ba, amrex::DistributionMapping(ba), 2, m_terrain_blank.num_grow());
+
+    const std::string cache_dir =
+        m_terrain_cache.empty()
+            ? ""
+            : amrex::Concatenate(m_terrain_cache + "/Level_", level, 1);
+    const std::string cache_name = cache_dir + "/terrain_columns";
+    const std::string cache_header = cache_name + "_info";
+    const std::string header =
+        m_terrain_cache.empty() ? "" : terrain_cache_header(geom);
+    if (!m_terrain_cache.empty() && amrex::FileExists(cache_name + "_H")) {
+        // The cache is only valid for the same terrain files and geometry
+        if (!cache_header_matches(cache_header, header)) {
+            amrex::Print()
+                << "WARNING: TerrainDrag: rebuilding terrain cache "
+                << cache_name
+                << " created from different terrain files or geometry"
+                << std::endl;
+        } else {
+            amrex::MultiFab cached;
+            amrex::VisMF::Read(cached, cache_name);
+            if ((cached.boxArray().minimalBox() == slab) &&
+                (cached.nComp() == columns->nComp()) &&
+                (cached.nGrowVect() == columns->nGrowVect())) {
+                columns->ParallelCopy(
+                    cached, 0, 0, columns->nComp(), cached.nGrowVect(),
+                    columns->nGrowVect());
+                return *columns;
+            }
+            amrex::Print() << "WARNING: TerrainDrag: ignoring terrain cache "
+                           << cache_name << " that does not match the mesh"
+                           << std::endl;
+        }
+    }
+
+    compute_terrain_columns(geom, *columns);
+
+    if (!m_terrain_cache.empty()) {
+        if (amrex::ParallelDescriptor::IOProcessor()) {
+            if (!amrex::UtilCreateDirectory(cache_dir, 0755)) {
+                amrex::CreateDirectoryFailed(cache_dir);
+            }
+        }
+        amrex::ParallelDescriptor::Barrier();
+        amrex::VisMF::Write(*columns, cache_name);
+        if (amrex::ParallelDescriptor::IOProcessor()) {
+            std::ofstream ofh(cache_header);
+            ofh << header;
+        }
+    }
+    return *columns;
+}
+
+std::string TerrainDrag::terrain_cache_header(const amrex::Geometry& geom) const
+{
+    const auto& dx = geom.CellSizeArray();
+    const auto& prob_lo = geom.ProbLoArray();
+    std::ostringstream oss;
+    oss << std::setprecision(17);
+    oss << "terrain_file " << file_identity(m_terrain_file) << "\n"
+        << "roughness_file " << file_identity(m_roughness_file) << "\n"
+        << "prob_lo";
+    for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+        oss << " " << prob_lo[d];
+    }
+    oss << "\ndx";
+    for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+        oss << " " << dx[d];
+    }
+    oss << "\n";
+    return oss.str();
+}
+
+bool TerrainDrag::cache_header_matches(
+    const std::string& fname, const std::string& header)
+{
+    int matches = 0;
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        std::ifstream ifh(fname);
+        if (ifh.good()) {
+            std::ostringstream oss;
+            oss << ifh.rdbuf();
+            matches = static_cast<int>(oss.str() == header);
+        }
+    }
+    amrex::ParallelDescriptor::Bcast(
+        &matches, 1, amrex::ParallelDescriptor::IOProcessorNumber());
+    return matches != 0;
+}
+
+void TerrainDrag::compute_terrain_columns(
+    const amrex::Geometry& geom, amrex::MultiFab& columns)
+{
+    BL_PROFILE("amr-wind::" + this->identifier() + "::compute_terrain_columns");
+    read_terrain_data();
+
+    const auto& dx = geom.CellSizeArray();
+    const auto& prob_lo = geom.ProbLoArray();
+
+    // Only the part of the terrain grid covering local columns is copied
+    amrex::Box local_bx;
+    for (amrex::MFIter mfi(columns); mfi.isValid(); ++mfi) {
+        local_bx = local_bx.isEmpty() ? mfi.fabbox()
+                                      : amrex::minBox(local_bx, mfi.fabbox());
+    }
+    if (local_bx.isEmpty()) {
+        return;
+    }
+    const amrex::RealBox bbox(
+        {prob_lo[0] + (local_bx.smallEnd(0) + 0.5) * dx[0],
+         prob_lo[1] + (local_bx.smallEnd(1) + 0.5) * dx[1], prob_lo[2]},
+        {prob_lo[0] + (local_bx.bigEnd(0) + 0.5) * dx[0],
+         prob_lo[1] + (local_bx.bigEnd(1) + 0.5) * dx[1], prob_lo[2]});
+
+    const FlatGridWindow terrain(m_xterrain, m_yterrain, m_zterrain, bbox);
+    const FlatGridWindow rough(m_xrough, m_yrough, m_z0rough, bbox);
+
+    const auto* xterrain_ptr = terrain.xs.data();
+    const auto* yterrain_ptr = terrain.ys.data();
+    const auto* zterrain_ptr = terrain.zs.data();
+    const int xterrain_size = static_cast<int>(terrain.xs.size());
+    const int yterrain_size = static_cast<int>(terrain.ys.size());
+    const bool terrain_uniform_x = terrain.uniform_x;
+    const bool terrain_uniform_y = terrain.uniform_y;
+    const auto* xrough_ptr = rough.xs.data();
+    const auto* yrough_ptr = rough.ys.data();
+    const auto* z0rough_ptr = rough.zs.data();
+    const int xrough_size = static_cast<int>(rough.xs.size());
+    const int yrough_size = static_cast<int>(rough.ys.size());
+    const bool rough_uniform_x = rough.uniform_x;
+    const bool rough_uniform_y = rough.uniform_y;
+
+    const auto& col_arrs = columns.arrays();
+    amrex::ParallelFor(
+        columns, columns.nGrowVect(),
+        [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
+            const amrex::Real x = prob_lo[0] + (i + 0.5) * dx[0];
+            const amrex::Real y = prob_lo[1] + (j + 0.5) * dx[1];
+            col_arrs[nbx](i, j, k, 0) = interp_flat_grid(
+                xterrain_ptr, xterrain_size, terrain_uniform_x, yterrain_ptr,
+                yterrain_size, terrain_uniform_y, zterrain_ptr, x, y);
+
+            amrex::Real roughz0 = 0.1;
+            if (xrough_size > 0) {
+                roughz0 = interp_flat_grid(
+                    xrough_ptr, xrough_size, rough_uniform_x, yrough_ptr,
+                    yrough_size, rough_uniform_y, z0rough_ptr, x, y);
+            }
+            col_arrs[nbx](i, j, k, 1) = roughz0;
+        });
+    amrex::Gpu::streamSynchronize();
 }
 
 void TerrainDrag::post_init_actions()
@@ -167,7 +497,7 @@ void TerrainDrag::pre_advance_work()
         return;
     }
     BL_PROFILE("amr-wind::" + this->identifier() + "::pre_advance_work");
-    convert_waves_to_terrain_fields();
+    convert_waves_to_terrain_fields(false);
 }
 
 void TerrainDrag::post_regrid_actions()
@@ -180,9 +510,10 @@ void TerrainDrag::post_regrid_actions()
             initialize_fields(lev, m_sim.repo().mesh().Geom(lev));
         }
     }
+    m_active_cells.set_num_levels(m_sim.repo().num_active_levels());
 }
 
-void TerrainDrag::convert_waves_to_terrain_fields()
+void TerrainDrag::convert_waves_to_terrain_fields(const bool rebuild_all)
 {
     const int nlevels = m_sim.repo().num_active_levels();
     // Uniform, low roughness for waves
@@ -204,15 +535,22 @@ void TerrainDrag::convert_waves_to_terrain_fields()
         const auto wave_vol_frac =
             (*m_wave_volume_fraction)(level).const_arrays();
 
-        // Get terrain blanking from ocean waves fields
+        // Get terrain blanking from ocean waves fields, flagging the boxes
+        // where it changed (the drag layer only depends on the blanking)
+        amrex::Gpu::DeviceVector<int> changed_d(blanking.local_size(), 0);
+        auto* changed_ptr = changed_d.data();
         amrex::ParallelFor(
             blanking, m_terrain_blank.num_grow(),
             [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
                 const amrex::Real z = prob_lo[2] + (k + 0.5) * dx[2];
-                levelBlanking[nbx](i, j, k, 0) = static_cast<int>(
+                const int blank = static_cast<int>(
                     (wave_vol_frac[nbx](i, j, k) >= 0.5) && (z > prob_lo[2]));
-                levelHeight[nbx](i, j, k, 0) =
-                    -negative_wave_elevation[nbx](i, j, k);
+                if (levelBlanking[nbx](i, j, k, 0) != blank) {
+                    amrex::Gpu::Atomic::Max(changed_ptr + nbx, 1);
+                }
+                levelBlanking[nbx](i, j, k, 0) = blank;
+                levelHeight[nbx](i, j, k, 0) = static_cast<float>(
+                    -negative_wave_elevation[nbx](i, j, k));
             });
         amrex::ParallelFor(
             blanking,
@@ -224,6 +562,18 @@ void TerrainDrag::convert_waves_to_terrain_fields()
                     levelDrag[nbx](i, j, k, 0) = 0;
                 }
             });
+
+        // The waves only change the blanking of the boxes near the free
+        // surface, the other boxes keep their active cells
+        if (rebuild_all) {
+            update_active_cells(level);
+        } else {
+            amrex::Vector<int> changed(changed_d.size());
+            amrex::Gpu::copy(
+                amrex::Gpu::deviceToHost, changed_d.begin(), changed_d.end(),
+                changed.begin());
+            update_active_cells(level, changed);
+        }
     }
 }
 
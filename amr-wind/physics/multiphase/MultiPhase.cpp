@@ -7,6 +7,7 @@
 #include "amr-wind/core/field_ops.H"
 #include "amr-wind/equation_systems/BCOps.H"
 #include <AMReX_MultiFabUtil.H>
+#include "AMReX_ParReduce.H"
 #include "amr-wind/core/SimTime.H"
 
 namespace amr_wind {
@@ -99,10 +100,11 @@ void MultiPhase::post_init_actions()
         };
     }
 
-    m_q0 = momentum_sum(0);
-    m_q1 = momentum_sum(1);
-    m_q2 = momentum_sum(2);
-    m_sumvof0 = volume_fraction_sum();
+    const auto sums = conserved_sums();
+    m_sumvof0 = sums[0];
+    m_q0 = sums[1];
+    m_q1 = sums[2];
+    m_q2 = sums[3];
 
     // Check if water level is specified (from case definition)
     amrex::ParmParse pp_multiphase("MultiPhase");
@@ -175,10 +177,11 @@ void MultiPhase::post_advance_work()
     case InterfaceCapturingMethod::VOF:
         // Compute and print the total volume fraction, momenta, and differences
         if (m_verbose > 0) {
-            m_total_volfrac = volume_fraction_sum();
-            amrex::Real mom_x = momentum_sum(0) - m_q0;
-            amrex::Real mom_y = momentum_sum(1) - m_q1;
-            amrex::Real mom_z = momentum_sum(2) - m_q2;
+            const auto sums = conserved_sums();
+            m_total_volfrac = sums[0];
+            amrex::Real mom_x = sums[1] - m_q0;
+            amrex::Real mom_y = sums[2] - m_q1;
+            amrex::Real mom_z = sums[3] - m_q2;
             const auto& geom = m_sim.mesh().Geom();
             const amrex::Real total_vol = geom[0].ProbDomain().volume();
             amrex::Print() << "Volume of Fluid diagnostics:" << std::endl;
@@ -296,6 +299,66 @@ amrex::Real MultiPhase::momentum_sum(int n)
     return total_momentum;
 }
 
+amrex::Array<amrex::Real, 4> MultiPhase::conserved_sums()
+{
+    BL_PROFILE("amr-wind::multiphase::ComputeConservedSums");
+    const int nlevels = m_sim.repo().num_active_levels();
+    const auto& geom = m_sim.mesh().Geom();
+    const auto& mesh = m_sim.mesh();
+
+    // Volume fraction followed by the three momentum components
+    amrex::Array<amrex::Real, 4> sums{0.0, 0.0, 0.0, 0.0};
+
+    for (int lev = 0; lev < nlevels; ++lev) {
+
+        amrex::iMultiFab level_mask;
+        if (lev < nlevels - 1) {
+            level_mask = makeFineMask(
+                mesh.boxArray(lev), mesh.DistributionMap(lev),
+                mesh.boxArray(lev + 1), mesh.refRatio(lev), 1, 0);
+        } else {
+            level_mask.define(
+                mesh.boxArray(lev), mesh.DistributionMap(lev), 1, 0,
+                amrex::MFInfo());
+            level_mask.setVal(1);
+        }
+
+        const auto& vof_arrs = (*m_vof)(lev).const_arrays();
+        const auto& vel_arrs = m_velocity(lev).const_arrays();
+        const auto& dens_arrs = m_density(lev).const_arrays();
+        const auto& mask_arrs = level_mask.const_arrays();
+        const amrex::Real cell_vol = geom[lev].CellSize()[0] *
+                                     geom[lev].CellSize()[1] *
+                                     geom[lev].CellSize()[2];
+
+        const auto vals = amrex::ParReduce(
+            amrex::TypeList<
+                amrex::ReduceOpSum, amrex::ReduceOpSum, amrex::ReduceOpSum,
+                amrex::ReduceOpSum>{},
+            amrex::TypeList<
+                amrex::Real, amrex::Real, amrex::Real, amrex::Real>{},
+            level_mask, amrex::IntVect(0),
+            [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k)
+                -> amrex::GpuTuple<
+                    amrex::Real, amrex::Real, amrex::Real, amrex::Real> {
+                const auto& vel = vel_arrs[nbx];
+                const amrex::Real wt = mask_arrs[nbx](i, j, k) * cell_vol;
+                const amrex::Real rho_wt = dens_arrs[nbx](i, j, k) * wt;
+                return {
+                    vof_arrs[nbx](i, j, k) * wt, vel(i, j, k, 0) * rho_wt,
+                    vel(i, j, k, 1) * rho_wt, vel(i, j, k, 2) * rho_wt};
+            });
+        sums[0] += amrex::get<0>(vals);
+        sums[1] += amrex::get<1>(vals);
+        sums[2] += amrex::get<2>(vals);
+        sums[3] += amrex::get<3>(vals);
+    }
+    amrex::ParallelDescriptor::ReduceRealSum(
+        sums.data(), static_cast<int>(sums.size()));
+
+    return sums;
+}
+
 void MultiPhase::set_density_via_levelset()
 {
     const int nlevels = m_sim.repo().num_active_levels();
@@ -155,7 +155,7 @@ void incflo::ApplyProjection(
     Real scaling_factor,
     bool incremental)
 {
-    BL_PROFILE("amr-wind::incflo::ApplyProjection");
+    AMR_WIND_PROFILE("amr-wind::incflo::ApplyProjection");
 
     // If we have dropped the dt substantially for whatever reason,
     // use a different form of the approximate projection that
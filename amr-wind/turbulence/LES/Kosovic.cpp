@@ -70,9 +70,11 @@ void Kosovic<Transport>::update_turbulent_viscosity(
         has_terrain ? &this->m_sim.repo().get_int_field("terrain_drag")
                     : nullptr;
     const auto* m_terrain_height =
-        has_terrain ? &this->m_sim.repo().get_field("terrain_height") : nullptr;
+        has_terrain ? &this->m_sim.repo().get_float_field("terrain_height")
+                    : nullptr;
     const auto* m_terrain_z0 =
-        has_terrain ? &this->m_sim.repo().get_field("terrainz0") : nullptr;
+        has_terrain ? &this->m_sim.repo().get_float_field("terrainz0")
+                    : nullptr;
     // Populate strainrate into the turbulent viscosity arrays to avoid creating
     // a temporary buffer
     fvm::strainrate(mu_turb, vel);
@@ -106,9 +108,9 @@ void Kosovic<Transport>::update_turbulent_viscosity(
                                     : amrex::MultiArray4<const int>();
         const auto& height_arrs = has_terrain
                                       ? (*m_terrain_height)(lev).const_arrays()
-                                      : amrex::MultiArray4<const double>();
+                                      : amrex::MultiArray4<const float>();
         const auto& z0_arrs = has_terrain ? (*m_terrain_z0)(lev).const_arrays()
-                                          : amrex::MultiArray4<const double>();
+                                          : amrex::MultiArray4<const float>();
         const amrex::Real monin_obukhov_length = m_monin_obukhov_length;
         const amrex::Real kappa = m_kappa;
         const amrex::Real surface_roughness_z0 = m_surface_roughness_z0;
@@ -152,8 +154,9 @@ void Kosovic<Transport>::update_turbulent_viscosity(
                 const amrex::Real uy = vel_arrs[nbx](i, j, k + 1, 1);
                 const amrex::Real m = std::sqrt(ux * ux + uy * uy);
                 const amrex::Real local_z0 =
-                    (has_terrain) ? std::max(z0_arrs[nbx](i, j, k, 0), 1e-4)
-                                  : surface_roughness_z0;
+                    (has_terrain)
+                        ? std::max<amrex::Real>(z0_arrs[nbx](i, j, k, 0), 1e-4)
+                        : surface_roughness_z0;
                 // ustar from neighbor cell above
                 const amrex::Real ustar =
                     m * kappa /
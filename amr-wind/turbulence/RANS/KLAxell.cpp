@@ -118,7 +118,7 @@ void KLAxell<Transport>::update_turbulent_viscosity(
             this->m_sim.repo().int_field_exists("terrain_blank");
         if (has_terrain) {
             const auto* m_terrain_height =
-                &this->m_sim.repo().get_field("terrain_height");
+                &this->m_sim.repo().get_float_field("terrain_height");
             const auto* m_terrain_blank =
                 &this->m_sim.repo().get_int_field("terrain_blank");
             const auto& ht_arrs = (*m_terrain_height)(lev).const_arrays();
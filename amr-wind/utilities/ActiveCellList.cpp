@@ -0,0 +1,16 @@
+#include "amr-wind/utilities/ActiveCellList.H"
+
+namespace amr_wind {
+
+amrex::Long ActiveCellList::num_local_cells(const int lev) const
+{
+    amrex::Long ncells = 0;
+    if (lev < static_cast<int>(m_cells.size())) {
+        for (const auto& cells : m_cells[lev]) {
+            ncells += static_cast<amrex::Long>(cells.size());
+        }
+    }
+    return ncells;
+}
+
+} // namespace amr_wind
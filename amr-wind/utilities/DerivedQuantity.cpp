@@ -55,7 +55,94 @@ void DerivedQty::var_names(amrex::Vector<std::string>& plt_var_names)
     ioutils::add_var_names(plt_var_names, this->name(), this->num_comp());
 }
 
-DerivedQtyMgr::DerivedQtyMgr(const FieldRepo& repo) : m_repo(repo) {}
+DerivedQtyCache::DerivedQtyCache(const FieldRepo& repo, const SimTime& time)
+    : m_repo(repo), m_time(time)
+{}
+
+void DerivedQtyCache::add_consumer(const std::string& key)
+{
+    ++m_consumers[key];
+}
+
+void DerivedQtyCache::remove_consumer(const std::string& key)
+{
+    auto it = m_consumers.find(key);
+    if (it == m_consumers.end()) {
+        return;
+    }
+    if (--(it->second) < 1) {
+        m_consumers.erase(it);
+    }
+    m_entries.erase(key);
+}
+
+bool DerivedQtyCache::is_shared(const std::string& key) const noexcept
+{
+    auto it = m_consumers.find(key);
+    return (it != m_consumers.end()) && (it->second > 1);
+}
+
+bool DerivedQtyCache::is_current(const Entry& entry) const
+{
+    const auto& mesh = m_repo.mesh();
+    const int nlevels = mesh.finestLevel() + 1;
+    if ((entry.time_index != m_time.time_index()) ||
+        (static_cast<int>(entry.ba.size()) != nlevels)) {
+        return false;
+    }
+    for (int lev = 0; lev < nlevels; ++lev) {
+        if ((entry.ba[lev] != mesh.boxArray(lev)) ||
+            (entry.dm[lev] != mesh.DistributionMap(lev))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void DerivedQtyCache::copy(
+    const std::string& key,
+    const DerivedQty& qty,
+    ScratchField& fld,
+    const int dcomp)
+{
+    BL_PROFILE("amr-wind::DerivedQtyCache::copy");
+    AMREX_ALWAYS_ASSERT((dcomp + qty.num_comp()) <= fld.num_comp());
+
+    auto& entry = m_entries[key];
+    if (!entry.field || !is_current(entry)) {
+        const auto& mesh = m_repo.mesh();
+        const int nlevels = mesh.finestLevel() + 1;
+        entry.field = m_repo.create_scratch_field(key, qty.num_comp(), 0);
+        qty(*entry.field, 0);
+        entry.time_index = m_time.time_index();
+        entry.ba.resize(nlevels);
+        entry.dm.resize(nlevels);
+        for (int lev = 0; lev < nlevels; ++lev) {
+            entry.ba[lev] = mesh.boxArray(lev);
+            entry.dm[lev] = mesh.DistributionMap(lev);
+        }
+    }
+
+    const auto& src = *entry.field;
+    const int nlevels = static_cast<int>(fld.vec_ptrs().size());
+    for (int lev = 0; lev < nlevels; ++lev) {
+        amrex::MultiFab::Copy(
+            fld(lev), src(lev), 0, dcomp, qty.num_comp(), 0);
+    }
+}
+
+DerivedQtyMgr::DerivedQtyMgr(const FieldRepo& repo, DerivedQtyCache* cache)
+    : m_repo(repo), m_cache(cache)
+{}
+
+DerivedQtyMgr::~DerivedQtyMgr()
+{
+    if (m_cache != nullptr) {
+        for (const auto& key : m_keys) {
+            m_cache->remove_consumer(key);
+        }
+    }
+}
 
 DerivedQty& DerivedQtyMgr::create(const std::string& key)
 {
@@ -69,7 +156,11 @@ DerivedQty& DerivedQtyMgr::create(const std::string& key)
     auto tokens = parse_derived_qty(qty_name);
     m_derived_vec.emplace_back(
         DerivedQty::create(tokens.first, m_repo, tokens.second));
+    m_keys.push_back(qty_name);
     m_obj_map[qty_name] = static_cast<int>(m_derived_vec.size()) - 1;
+    if (m_cache != nullptr) {
+        m_cache->add_consumer(qty_name);
+    }
 
     return *m_derived_vec.back();
 }
@@ -86,8 +177,13 @@ void DerivedQtyMgr::operator()(ScratchField& fld, const int scomp) const
     AMREX_ALWAYS_ASSERT((scomp + num_comp()) <= fld.num_comp());
 
     int icomp = scomp;
-    for (const auto& qty : m_derived_vec) {
-        (*qty)(fld, icomp);
+    for (int i = 0; i < static_cast<int>(m_derived_vec.size()); ++i) {
+        const auto& qty = m_derived_vec[i];
+        if ((m_cache != nullptr) && m_cache->is_shared(m_keys[i])) {
+            m_cache->copy(m_keys[i], *qty, fld, icomp);
+        } else {
+            (*qty)(fld, icomp);
+        }
         icomp += qty->num_comp();
     }
     fld.fillpatch(0.0);
@@ -124,28 +220,22 @@ void DerivedQtyMgr::filter(const amrex::Vector<std::string>& erase)
 
 void DerivedQtyMgr::filter(const std::set<std::string>& erase)
 {
-    // first erase from the unordered map
-    amrex::Vector<decltype(m_obj_map)::key_type> keys_to_erase;
-    for (int i = 0; i < m_derived_vec.size(); i++) {
+    TypeVector derived_vec;
+    amrex::Vector<std::string> keys;
+    m_obj_map.clear();
+    for (int i = 0; i < static_cast<int>(m_derived_vec.size()); ++i) {
         if (erase.find(m_derived_vec[i]->name()) != erase.end()) {
-            auto it = std::find_if(
-                m_obj_map.begin(), m_obj_map.end(),
-                [&i](auto&& p) { return p.second == i; });
-            keys_to_erase.emplace_back(it->first);
+            if (m_cache != nullptr) {
+                m_cache->remove_consumer(m_keys[i]);
+            }
+            continue;
         }
+        m_obj_map[m_keys[i]] = static_cast<int>(derived_vec.size());
+        derived_vec.push_back(std::move(m_derived_vec[i]));
+        keys.push_back(m_keys[i]);
     }
-    for (auto&& key : keys_to_erase) {
-        m_obj_map.erase(key);
-    }
-
-    // then erase from the derived vec
-    m_derived_vec.erase(
-        std::remove_if(
-            m_derived_vec.begin(), m_derived_vec.end(),
-            [=](const auto& qty) {
-                return erase.find(qty->name()) != erase.end();
-            }),
-        m_derived_vec.end());
+    m_derived_vec = std::move(derived_vec);
+    m_keys = std::move(keys);
 }
 
 } // namespace amr_wind
@@ -8,8 +8,11 @@
 #include "amr-wind/CFDSim.H"
 #include "amr-wind/utilities/console_io.H"
 #include "amr-wind/utilities/io_utils.H"
+#include "amr-wind/utilities/PerfMonitor.H"
 #include "amr-wind/utilities/DerivedQuantity.H"
 #include "amr-wind/utilities/DerivedQtyDefs.H"
+#include "amr-wind/utilities/PlotRegion.H"
+#include "amr-wind/utilities/PostProcessing.H"
 #include "amr-wind/utilities/ncutils/nc_interface.H"
 
 #include "AMReX_ParmParse.H"
@@ -23,7 +26,8 @@
 namespace amr_wind {
 
 IOManager::IOManager(CFDSim& sim)
-    : m_sim(sim), m_derived_mgr(new DerivedQtyMgr(m_sim.repo()))
+    : m_sim(sim)
+    , m_derived_mgr(new DerivedQtyMgr(m_sim.repo(), &m_sim.derived_cache()))
 {}
 
 IOManager::~IOManager() = default;
@@ -34,12 +38,14 @@ void IOManager::initialize_io()
     amrex::Vector<std::string> out_int_vars;
     amrex::Vector<std::string> out_derived_vars;
     amrex::Vector<std::string> out_skip_vars;
+    amrex::Vector<std::string> out_regions;
     std::set<std::string> outputs;
     std::set<std::string> skip_outputs;
     std::set<std::string> int_outputs;
 
     amrex::ParmParse pp("io");
     pp.query("output_default_variables", m_output_default_vars);
+    pp.query("output_full_domain", m_output_full_domain);
     pp.query("plot_file", m_plt_prefix);
     pp.query("check_file", m_chk_prefix);
     pp.query("post_processing_directory", m_post_dir);
@@ -58,6 +64,7 @@ void IOManager::initialize_io()
     pp.queryarr("int_outputs", out_int_vars);
     pp.queryarr("derived_outputs", out_derived_vars);
     pp.queryarr("skip_outputs", out_skip_vars);
+    pp.queryarr("output_regions", out_regions);
 
     // We process the input vector to eliminate duplicates
     for (const auto& name : out_vars) {
@@ -90,12 +97,16 @@ void IOManager::initialize_io()
     // Process output variables information
     auto& repo = m_sim.repo();
     m_plt_num_comp = 0;
+    amrex::Vector<std::string> float_outputs;
     for (const auto& fname : outputs) {
         if (repo.field_exists(fname)) {
             auto& fld = repo.get_field(fname);
             m_plt_num_comp += fld.num_comp();
             m_plt_fields.emplace_back(&fld);
             ioutils::add_var_names(m_plt_var_names, fld.name(), fld.num_comp());
+        } else if (repo.float_field_exists(fname)) {
+            // Output after the integer fields, in the same order as the data
+            float_outputs.push_back(fname);
         } else {
             amrex::Print() << "  Invalid output variable requested: " << fname
                            << std::endl;
@@ -114,6 +125,13 @@ void IOManager::initialize_io()
         }
     }
 
+    for (const auto& fname : float_outputs) {
+        auto& fld = repo.get_float_field(fname);
+        m_plt_num_comp += fld.num_comp();
+        m_float_plt_fields.emplace_back(&fld);
+        ioutils::add_var_names(m_plt_var_names, fld.name(), fld.num_comp());
+    }
+
     if (!out_derived_vars.empty()) {
         m_derived_mgr->create(out_derived_vars);
         m_derived_mgr->filter(outputs);
@@ -121,6 +139,13 @@ void IOManager::initialize_io()
         m_derived_mgr->var_names(m_plt_var_names);
     }
 
+    for (const auto& label : out_regions) {
+        m_plt_regions.emplace_back(std::make_unique<PlotRegion>(m_sim, label));
+        m_plt_regions.back()->initialize(
+            m_plt_prefix, m_plt_fields, m_int_plt_fields, m_float_plt_fields,
+            out_derived_vars);
+    }
+
     for (const auto& fname : m_chkvars) {
         auto& fld = repo.get_field(fname);
         m_chk_fields.emplace_back(&fld);
@@ -131,7 +156,14 @@ void IOManager::initialize_io()
 
 void IOManager::write_plot_file()
 {
-    BL_PROFILE("amr-wind::IOManager::write_plot_file");
+    AMR_WIND_PROFILE("amr-wind::IOManager::write_plot_file");
+
+    for (auto& region : m_plt_regions) {
+        region->write_plot_file();
+    }
+    if (!m_output_full_domain) {
+        return;
+    }
 
     amrex::Vector<int> istep(
         m_sim.mesh().finestLevel() + 1, m_sim.time().time_index());
@@ -156,6 +188,11 @@ void IOManager::write_plot_file()
                 0);
             icomp += fld->num_comp();
         }
+
+        for (auto* fld : m_float_plt_fields) {
+            fld->copy_to(lev, mf, icomp);
+            icomp += fld->num_comp();
+        }
     }
 
     (*m_derived_mgr)(*outfield, start_comp);
@@ -188,7 +225,12 @@ void IOManager::write_plot_file()
 
 void IOManager::write_checkpoint_file(const int start_level, int end_level)
 {
-    BL_PROFILE("amr-wind::IOManager::write_checkpoint_file");
+    AMR_WIND_PROFILE("amr-wind::IOManager::write_checkpoint_file");
+
+    // Post-processing output staged in memory must be on disk before the
+    // simulation can be restarted from this checkpoint
+    m_sim.post_manager().flush_output();
+
     const std::string level_prefix = "Level_";
     const std::string chkname =
         amrex::Concatenate(m_chk_prefix, m_sim.time().time_index());
@@ -255,6 +297,9 @@ void IOManager::read_checkpoint_fields(
                     amrex::MultiFabFileFullPrefix(
                         lev, restart_file, level_prefix, field.name()));
             } else {
+                // The checkpoint layout is mapped onto the ranks that own the
+                // data in the new layout (see incflo::ReadCheckpointFile), so
+                // the copy below moves little data between ranks
                 amrex::MultiFab tmp(
                     ba_fab, dm_chk[lev], mfab.nComp(), mfab.nGrowVect());
                 amrex::VisMF::Read(
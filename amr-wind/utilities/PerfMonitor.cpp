@@ -0,0 +1,460 @@
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+#include "amr-wind/utilities/PerfMonitor.H"
+#include "amr-wind/utilities/GlobalReductions.H"
+#include "amr-wind/CFDSim.H"
+
+#include "AMReX_FArrayBox.H"
+#include "AMReX_GpuDevice.H"
+#include "AMReX_ParallelDescriptor.H"
+#include "AMReX_ParmParse.H"
+#include "AMReX_Print.H"
+
+namespace amr_wind {
+
+namespace perf {
+
+TimerRegistry& TimerRegistry::instance()
+{
+    static TimerRegistry registry;
+    return registry;
+}
+
+void TimerRegistry::add(const std::string& name, const amrex::Real elapsed)
+{
+    auto& timer = m_timers[name];
+    timer.step_time += elapsed;
+    timer.total_time += elapsed;
+    ++timer.step_calls;
+}
+
+void TimerRegistry::end_step()
+{
+    for (auto& kv : m_timers) {
+        auto& timer = kv.second;
+        timer.window_time += timer.step_time;
+        timer.window_max = amrex::max(timer.window_max, timer.step_time);
+        timer.step_time = 0.0;
+        timer.step_calls = 0;
+    }
+}
+
+void TimerRegistry::reset_window()
+{
+    for (auto& kv : m_timers) {
+        kv.second.window_time = 0.0;
+        kv.second.window_max = 0.0;
+    }
+}
+
+void TimerRegistry::sync_regions()
+{
+    const int nprocs = amrex::ParallelDescriptor::NProcs();
+    if (nprocs == 1) {
+        return;
+    }
+
+    int changed = (static_cast<int>(m_timers.size()) != m_nsynced) ? 1 : 0;
+    amrex::ParallelDescriptor::ReduceIntMax(changed);
+    if (changed == 0) {
+        return;
+    }
+
+    // Names are exchanged as newline-separated lists: gather all lists on
+    // the I/O rank and broadcast their union
+    const auto pack = [this]() {
+        std::string names;
+        for (const auto& kv : m_timers) {
+            names += kv.first + '\n';
+        }
+        return names;
+    };
+    const auto unpack = [this](const std::string& names) {
+        std::istringstream iss(names);
+        std::string name;
+        while (std::getline(iss, name)) {
+            m_timers.try_emplace(name);
+        }
+    };
+
+    const int root = amrex::ParallelDescriptor::IOProcessorNumber();
+    const std::string local = pack();
+    const int nlocal = static_cast<int>(local.size());
+    std::vector<int> counts(nprocs, 0);
+    amrex::ParallelDescriptor::Gather(&nlocal, 1, counts.data(), 1, root);
+    std::vector<int> disps(nprocs, 0);
+    for (int i = 1; i < nprocs; ++i) {
+        disps[i] = disps[i - 1] + counts[i - 1];
+    }
+    std::string all(disps.back() + counts.back(), '\0');
+    amrex::ParallelDescriptor::Gatherv(
+        local.data(), nlocal, all.data(), counts, disps, root);
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        unpack(all);
+    }
+
+    std::string names = pack();
+    int nchars = static_cast<int>(names.size());
+    amrex::ParallelDescriptor::Bcast(&nchars, 1, root);
+    names.resize(nchars);
+    amrex::ParallelDescriptor::Bcast(names.data(), nchars, root);
+    unpack(names);
+
+    m_nsynced = static_cast<int>(m_timers.size());
+}
+
+ScopedTimer::ScopedTimer(const std::string& name)
+    : m_active(TimerRegistry::instance().active())
+{
+    if (!m_active) {
+        return;
+    }
+
+    m_name = name;
+    if (TimerRegistry::instance().device_sync()) {
+        amrex::Gpu::streamSynchronize();
+    }
+    m_start = amrex::ParallelDescriptor::second();
+}
+
+ScopedTimer::~ScopedTimer()
+{
+    if (!m_active) {
+        return;
+    }
+
+    auto& registry = TimerRegistry::instance();
+    if (registry.device_sync()) {
+        amrex::Gpu::streamSynchronize();
+    }
+    registry.add(m_name, amrex::ParallelDescriptor::second() - m_start);
+}
+
+} // namespace perf
+
+namespace {
+
+template <typename FType>
+amrex::Real field_bytes(const FType& fld, const int nlevels)
+{
+    amrex::Real nbytes = 0.0;
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto& mf = fld(lev);
+        for (int i = 0; i < mf.local_size(); ++i) {
+            nbytes += static_cast<amrex::Real>(mf.fabPtr(i)->nBytes());
+        }
+    }
+    return nbytes;
+}
+
+} // namespace
+
+PerfMonitor::PerfMonitor(CFDSim& sim) : m_sim(sim) {}
+
+PerfMonitor::~PerfMonitor()
+{
+    perf::TimerRegistry::instance().set_active(false);
+}
+
+void PerfMonitor::initialize()
+{
+    bool device_sync = false;
+    {
+        amrex::ParmParse pp("perf");
+        pp.query("enabled", m_enabled);
+        pp.query("format", m_format);
+        pp.query("output_file", m_out_fname);
+        pp.query("summary_interval", m_summary_interval);
+        pp.query("track_memory", m_track_memory);
+        pp.query("device_sync", device_sync);
+    }
+
+    auto& registry = perf::TimerRegistry::instance();
+    registry.set_active(m_enabled);
+    registry.set_device_sync(device_sync);
+    if (!m_enabled) {
+        return;
+    }
+
+    if ((m_format != "json") && (m_format != "csv")) {
+        amrex::Abort(
+            "PerfMonitor: invalid perf.format = " + m_format +
+            ". Valid options are json or csv");
+    }
+
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        const std::string ext = (m_format == "json") ? ".jsonl" : ".csv";
+        m_out.open(m_out_fname + ext, std::ios::out | std::ios::trunc);
+        if (m_format == "csv") {
+            m_out << "step,time,wall_time,region,step_time_max,"
+                  << "step_time_min,calls" << std::endl;
+        }
+    }
+
+    // Discard the memory high-water mark of the initialization
+    amrex::ResetTotalBytesAllocatedInFabsHWM();
+}
+
+void PerfMonitor::update_memory()
+{
+    const auto& repo = m_sim.repo();
+    const int nlevels = repo.num_active_levels();
+
+    m_mem_names.clear();
+    amrex::Vector<amrex::Real> local_bytes;
+    for (const auto& fld : repo.fields()) {
+        m_mem_names.push_back(fld->name());
+        local_bytes.push_back(field_bytes(*fld, nlevels));
+    }
+    for (const auto& fld : repo.int_fields()) {
+        m_mem_names.push_back(fld->name());
+        local_bytes.push_back(field_bytes(*fld, nlevels));
+    }
+    for (const auto& fld : repo.float_fields()) {
+        m_mem_names.push_back(fld->name());
+        local_bytes.push_back(field_bytes(*fld, nlevels));
+    }
+
+    amrex::Real local_total = 0.0;
+    for (const auto nbytes : local_bytes) {
+        local_total += nbytes;
+    }
+
+    // Pack all memory statistics into a single sum and a single max reduction
+    GlobalReductions reductions;
+    const int nfields = static_cast<int>(local_bytes.size());
+    amrex::Vector<int> sum_idx(nfields);
+    amrex::Vector<int> max_idx(nfields);
+    for (int i = 0; i < nfields; ++i) {
+        sum_idx[i] = reductions.add_sum(local_bytes[i]);
+        max_idx[i] = reductions.add_max(local_bytes[i]);
+    }
+    const int total_idx = reductions.add_max(local_total);
+    const int hwm_idx = reductions.add_max(
+        static_cast<amrex::Real>(amrex::TotalBytesAllocatedInFabsHWM()));
+    reductions.reduce();
+
+    m_mem_sum.resize(nfields);
+    m_mem_max.resize(nfields);
+    for (int i = 0; i < nfields; ++i) {
+        m_mem_sum[i] = reductions.sum(sum_idx[i]);
+        m_mem_max[i] = reductions.max(max_idx[i]);
+    }
+    m_field_bytes = reductions.max(total_idx);
+    m_fab_hwm = reductions.max(hwm_idx);
+
+    amrex::ResetTotalBytesAllocatedInFabsHWM();
+}
+
+void PerfMonitor::reduce_timers()
+{
+    auto& registry = perf::TimerRegistry::instance();
+    registry.sync_regions();
+
+    // Minima are reduced as the maxima of the negated values
+    GlobalReductions reductions;
+    m_timer_names.clear();
+    amrex::Vector<int> max_idx;
+    amrex::Vector<int> min_idx;
+    amrex::Vector<int> calls_idx;
+    for (const auto& kv : registry.timers()) {
+        m_timer_names.push_back(kv.first);
+        max_idx.push_back(reductions.add_max(kv.second.step_time));
+        min_idx.push_back(reductions.add_max(-kv.second.step_time));
+        calls_idx.push_back(reductions.add_max(
+            static_cast<amrex::Real>(kv.second.step_calls)));
+    }
+    reductions.reduce();
+
+    const int ntimers = static_cast<int>(m_timer_names.size());
+    m_timer_max.resize(ntimers);
+    m_timer_min.resize(ntimers);
+    m_timer_calls.resize(ntimers);
+    for (int i = 0; i < ntimers; ++i) {
+        m_timer_max[i] = reductions.max(max_idx[i]);
+        m_timer_min[i] = -reductions.max(min_idx[i]);
+        m_timer_calls[i] = static_cast<long>(reductions.max(calls_idx[i]));
+    }
+}
+
+void PerfMonitor::end_step(const amrex::Real step_wall_time)
+{
+    if (!m_enabled) {
+        return;
+    }
+
+    BL_PROFILE("amr-wind::PerfMonitor::end_step");
+    if (m_track_memory) {
+        update_memory();
+    }
+
+    reduce_timers();
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        if (m_format == "json") {
+            write_json_record(step_wall_time);
+        } else {
+            write_csv_record(step_wall_time);
+        }
+    }
+    m_last_field_bytes = m_field_bytes;
+
+    auto& registry = perf::TimerRegistry::instance();
+    registry.end_step();
+    ++m_window_steps;
+    m_window_wall_time += step_wall_time;
+
+    if ((m_summary_interval > 0) &&
+        (m_sim.time().time_index() % m_summary_interval == 0)) {
+        print_summary();
+        registry.reset_window();
+        m_window_steps = 0;
+        m_window_wall_time = 0.0;
+    }
+}
+
+void PerfMonitor::write_json_record(const amrex::Real step_wall_time)
+{
+    const auto& time = m_sim.time();
+    m_out << std::setprecision(6) << "{\"step\": " << time.time_index()
+          << ", \"time\": " << time.new_time()
+          << ", \"wall_time\": " << step_wall_time << ", \"timers\": {";
+
+    bool first = true;
+    for (int i = 0; i < static_cast<int>(m_timer_names.size()); ++i) {
+        if (m_timer_calls[i] < 1) {
+            continue;
+        }
+        m_out << (first ? "" : ", ") << "\"" << m_timer_names[i] << "\": ["
+              << m_timer_max[i] << ", " << m_timer_min[i] << ", "
+              << m_timer_calls[i] << "]";
+        first = false;
+    }
+    m_out << "}";
+
+    if (m_track_memory) {
+        m_out << ", \"memory\": {\"fields_max\": " << m_field_bytes
+              << ", \"fab_hwm_max\": " << m_fab_hwm << ", \"scratch_max\": "
+              << amrex::max<amrex::Real>(m_fab_hwm - m_field_bytes, 0.0);
+        // Per-field memory only changes on regrid, avoid repeating it
+        if (m_field_bytes != m_last_field_bytes) {
+            m_out << ", \"fields\": {";
+            for (int i = 0; i < static_cast<int>(m_mem_names.size()); ++i) {
+                m_out << ((i > 0) ? ", " : "") << "\"" << m_mem_names[i]
+                      << "\": [" << m_mem_max[i] << ", " << m_mem_sum[i]
+                      << "]";
+            }
+            m_out << "}";
+        }
+        m_out << "}";
+    }
+    m_out << "}" << std::endl;
+}
+
+void PerfMonitor::write_csv_record(const amrex::Real step_wall_time)
+{
+    const auto& time = m_sim.time();
+    const auto prefix = [&]() -> std::ostream& {
+        return m_out << time.time_index() << "," << time.new_time() << ","
+                     << step_wall_time << ",";
+    };
+
+    m_out << std::setprecision(6);
+    for (int i = 0; i < static_cast<int>(m_timer_names.size()); ++i) {
+        if (m_timer_calls[i] < 1) {
+            continue;
+        }
+        prefix() << m_timer_names[i] << "," << m_timer_max[i] << ","
+                 << m_timer_min[i] << "," << m_timer_calls[i] << "\n";
+    }
+
+    // Memory is reported in bytes as the maximum across ranks, using the
+    // same columns with no minimum and zero calls
+    if (m_track_memory) {
+        prefix() << "memory::fields_max," << m_field_bytes << ",,0\n";
+        prefix() << "memory::fab_hwm_max," << m_fab_hwm << ",,0\n";
+        if (m_field_bytes != m_last_field_bytes) {
+            for (int i = 0; i < static_cast<int>(m_mem_names.size()); ++i) {
+                prefix() << "memory::" << m_mem_names[i] << ","
+                         << m_mem_max[i] << ",,0\n";
+            }
+        }
+    }
+    m_out << std::flush;
+}
+
+void PerfMonitor::print_summary()
+{
+    if (m_window_steps < 1) {
+        return;
+    }
+
+    auto& registry = perf::TimerRegistry::instance();
+    registry.sync_regions();
+
+    // Reduce the window of each region: the time summed over the window
+    // (max and min across ranks) and the maximum per-step time
+    struct WindowEntry
+    {
+        std::string name;
+        amrex::Real time_max{0.0};
+        amrex::Real time_min{0.0};
+        amrex::Real step_max{0.0};
+    };
+    GlobalReductions reductions;
+    amrex::Vector<WindowEntry> entries;
+    amrex::Vector<int> max_idx;
+    amrex::Vector<int> min_idx;
+    amrex::Vector<int> step_idx;
+    for (const auto& kv : registry.timers()) {
+        entries.push_back(WindowEntry{kv.first});
+        max_idx.push_back(reductions.add_max(kv.second.window_time));
+        min_idx.push_back(reductions.add_max(-kv.second.window_time));
+        step_idx.push_back(reductions.add_max(kv.second.window_max));
+    }
+    reductions.reduce();
+    for (int i = 0; i < static_cast<int>(entries.size()); ++i) {
+        entries[i].time_max = reductions.max(max_idx[i]);
+        entries[i].time_min = -reductions.max(min_idx[i]);
+        entries[i].step_max = reductions.max(step_idx[i]);
+    }
+    std::sort(
+        entries.begin(), entries.end(),
+        [](const WindowEntry& a, const WindowEntry& b) {
+            return a.time_max > b.time_max;
+        });
+
+    const amrex::Real nsteps = static_cast<amrex::Real>(m_window_steps);
+    const amrex::Real avg_wall = m_window_wall_time / nsteps;
+    amrex::Print() << "\nPerfMonitor summary over the last " << m_window_steps
+                   << " steps (average step wall time " << std::setprecision(4)
+                   << avg_wall << " s)\n"
+                   << std::setw(56) << std::left << "Region" << std::right
+                   << std::setw(12) << "Avg max (s)" << std::setw(12)
+                   << "Avg min (s)" << std::setw(12) << "Max (s)"
+                   << std::setw(10) << "Step %" << std::endl;
+    for (const auto& entry : entries) {
+        if (entry.time_max <= 0.0) {
+            continue;
+        }
+        const amrex::Real avg = entry.time_max / nsteps;
+        const amrex::Real pct =
+            (avg_wall > 0.0) ? 100.0 * avg / avg_wall : 0.0;
+        amrex::Print() << std::setw(56) << std::left << entry.name
+                       << std::right << std::setw(12) << avg << std::setw(12)
+                       << entry.time_min / nsteps << std::setw(12)
+                       << entry.step_max << std::setw(10)
+                       << std::setprecision(3) << pct << std::setprecision(4)
+                       << std::endl;
+    }
+
+    if (m_track_memory) {
+        amrex::Print() << "Field memory (max per rank): " << m_field_bytes
+                       << " bytes; FAB high-water mark (max per rank): "
+                       << m_fab_hwm << " bytes" << std::endl;
+    }
+    amrex::Print() << std::endl;
+}
+
+} // namespace amr_wind
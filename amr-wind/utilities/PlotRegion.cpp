@@ -0,0 +1,290 @@
+#include <cmath>
+#include <set>
+
+#include "amr-wind/utilities/PlotRegion.H"
+#include "amr-wind/CFDSim.H"
+#include "amr-wind/utilities/io_utils.H"
+#include "amr-wind/utilities/IOManager.H"
+#include "amr-wind/utilities/DerivedQuantity.H"
+
+#include "AMReX_ParmParse.H"
+#include "AMReX_PlotFileUtil.H"
+#include "AMReX_MultiFabUtil.H"
+
+namespace amr_wind {
+
+namespace {
+
+//! Copy the data of a level into the region boxes contained in its boxes
+template <typename FAB>
+void copy_box_data(
+    const amrex::FabArray<FAB>& src,
+    const amrex::Vector<int>& src_index,
+    const int ncomp,
+    const int dcomp,
+    amrex::MultiFab& mf)
+{
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+    for (amrex::MFIter mfi(mf, amrex::TilingIfNotGPU()); mfi.isValid();
+         ++mfi) {
+        const auto& bx = mfi.tilebox();
+        const auto& sarr = src.const_array(src_index[mfi.index()]);
+        const auto& darr = mf.array(mfi);
+        amrex::ParallelFor(
+            bx, ncomp,
+            [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+                darr(i, j, k, dcomp + n) =
+                    static_cast<amrex::Real>(sarr(i, j, k, n));
+            });
+    }
+}
+
+} // namespace
+
+PlotRegion::PlotRegion(CFDSim& sim, std::string label)
+    : m_sim(sim)
+    , m_derived_mgr(new DerivedQtyMgr(m_sim.repo(), &m_sim.derived_cache()))
+    , m_label(std::move(label))
+{}
+
+PlotRegion::~PlotRegion() = default;
+
+void PlotRegion::initialize(
+    const std::string& plt_prefix,
+    const amrex::Vector<Field*>& plt_fields,
+    const amrex::Vector<IntField*>& int_plt_fields,
+    const amrex::Vector<FloatField*>& float_plt_fields,
+    const amrex::Vector<std::string>& derived_vars)
+{
+    const auto& mesh = m_sim.mesh();
+    const auto& geom = mesh.Geom(0);
+    const auto& domain = geom.Domain();
+
+    const auto* problo = geom.ProbLo();
+    const auto* probhi = geom.ProbHi();
+    amrex::Vector<amrex::Real> lo(problo, problo + AMREX_SPACEDIM);
+    amrex::Vector<amrex::Real> hi(probhi, probhi + AMREX_SPACEDIM);
+    amrex::Vector<std::string> outputs;
+    amrex::Vector<std::string> int_outputs;
+    amrex::Vector<std::string> derived_outputs;
+
+    m_plt_prefix = plt_prefix + "_" + m_label;
+    m_max_level = mesh.maxLevel();
+
+    amrex::ParmParse pp("io." + m_label);
+    pp.queryarr("lo", lo, 0, AMREX_SPACEDIM);
+    pp.queryarr("hi", hi, 0, AMREX_SPACEDIM);
+    pp.query("max_level", m_max_level);
+    pp.query("coarsen", m_coarsen);
+    pp.query("plot_file", m_plt_prefix);
+    pp.queryarr("outputs", outputs);
+    pp.queryarr("int_outputs", int_outputs);
+    pp.queryarr("derived_outputs", derived_outputs);
+
+    if (m_coarsen < 1) {
+        amrex::Abort(
+            "PlotRegion: io." + m_label +
+            ".coarsen must be a positive integer");
+    }
+    if (!domain.coarsenable(m_coarsen)) {
+        amrex::Abort(
+            "PlotRegion: the level 0 domain cannot be coarsened by io." +
+            m_label + ".coarsen");
+    }
+
+    // Cells of level 0 overlapping the region, extended to full coarse cells
+    const auto* dx = geom.CellSize();
+    amrex::IntVect ilo;
+    amrex::IntVect ihi;
+    for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+        ilo[dir] =
+            static_cast<int>(std::floor((lo[dir] - problo[dir]) / dx[dir]));
+        ihi[dir] =
+            static_cast<int>(std::ceil((hi[dir] - problo[dir]) / dx[dir])) - 1;
+    }
+    m_box = amrex::Box(ilo, ihi);
+    m_box.coarsen(m_coarsen).refine(m_coarsen);
+    m_box &= domain;
+    if (!m_box.ok()) {
+        amrex::Abort(
+            "PlotRegion: region " + m_label + " does not intersect the domain");
+    }
+    for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+        m_rbox.setLo(dir, problo[dir] + m_box.smallEnd(dir) * dx[dir]);
+        m_rbox.setHi(dir, problo[dir] + (m_box.bigEnd(dir) + 1) * dx[dir]);
+    }
+
+    // Use the plot variables of the full domain output unless the region
+    // provides its own list
+    const bool use_defaults =
+        outputs.empty() && int_outputs.empty() && derived_outputs.empty();
+    auto& repo = m_sim.repo();
+    if (use_defaults) {
+        m_fields = plt_fields;
+        m_int_fields = int_plt_fields;
+        m_float_fields = float_plt_fields;
+        derived_outputs = derived_vars;
+    } else {
+        for (const auto& fname : outputs) {
+            if (repo.field_exists(fname)) {
+                m_fields.emplace_back(&repo.get_field(fname));
+            } else if (repo.float_field_exists(fname)) {
+                m_float_fields.emplace_back(&repo.get_float_field(fname));
+            } else {
+                amrex::Print() << "  Invalid output variable requested: "
+                               << fname << std::endl;
+            }
+        }
+        for (const auto& fname : int_outputs) {
+            if (repo.int_field_exists(fname)) {
+                m_int_fields.emplace_back(&repo.get_int_field(fname));
+            } else {
+                amrex::Print() << "  Invalid output variable requested: "
+                               << fname << std::endl;
+            }
+        }
+    }
+
+    std::set<std::string> field_names;
+    m_num_comp = 0;
+    m_var_names.clear();
+    for (const auto* fld : m_fields) {
+        field_names.insert(fld->name());
+        m_num_comp += fld->num_comp();
+        ioutils::add_var_names(m_var_names, fld->name(), fld->num_comp());
+    }
+    for (const auto* fld : m_int_fields) {
+        m_num_comp += fld->num_comp();
+        ioutils::add_var_names(m_var_names, fld->name(), fld->num_comp());
+    }
+    for (const auto* fld : m_float_fields) {
+        field_names.insert(fld->name());
+        m_num_comp += fld->num_comp();
+        ioutils::add_var_names(m_var_names, fld->name(), fld->num_comp());
+    }
+    if (!derived_outputs.empty()) {
+        m_derived_mgr->create(derived_outputs);
+        m_derived_mgr->filter(field_names);
+        m_num_comp += m_derived_mgr->num_comp();
+        m_derived_mgr->var_names(m_var_names);
+    }
+
+    amrex::Print() << "  Plot region " << m_label << ": " << m_rbox
+                   << ", max level = " << m_max_level
+                   << ", coarsening = " << m_coarsen
+                   << ", variables = " << m_num_comp << std::endl;
+}
+
+void PlotRegion::copy_level_data(
+    const int lev,
+    const amrex::Vector<int>& src_index,
+    const amrex::MultiFab* derived,
+    amrex::MultiFab& mf) const
+{
+    int icomp = 0;
+    for (const auto* fld : m_fields) {
+        copy_box_data((*fld)(lev), src_index, fld->num_comp(), icomp, mf);
+        icomp += fld->num_comp();
+    }
+    for (const auto* fld : m_int_fields) {
+        copy_box_data((*fld)(lev), src_index, fld->num_comp(), icomp, mf);
+        icomp += fld->num_comp();
+    }
+    for (const auto* fld : m_float_fields) {
+        copy_box_data((*fld)(lev), src_index, fld->num_comp(), icomp, mf);
+        icomp += fld->num_comp();
+    }
+    if (derived != nullptr) {
+        copy_box_data(*derived, src_index, derived->nComp(), icomp, mf);
+    }
+}
+
+void PlotRegion::write_plot_file()
+{
+    BL_PROFILE("amr-wind::PlotRegion::write_plot_file");
+
+    const auto& mesh = m_sim.mesh();
+    const auto& time = m_sim.time();
+    const int max_lev = amrex::min(m_max_level, mesh.finestLevel());
+
+    // Derived quantities are evaluated on whole levels
+    std::unique_ptr<ScratchField> derived;
+    if (m_derived_mgr->num_comp() > 0) {
+        derived = m_sim.repo().create_scratch_field(m_derived_mgr->num_comp());
+        (*m_derived_mgr)(*derived, 0);
+    }
+
+    amrex::Vector<amrex::MultiFab> outdata;
+    amrex::Vector<amrex::Geometry> geoms;
+    amrex::Vector<amrex::IntVect> ref_ratio;
+    const amrex::Array<int, AMREX_SPACEDIM> is_periodic{AMREX_D_DECL(0, 0, 0)};
+    amrex::Box rbx = m_box;
+    for (int lev = 0; lev <= max_lev; ++lev) {
+        if (lev > 0) {
+            rbx.refine(mesh.refRatio(lev - 1));
+        }
+
+        // The region boxes of a level are the intersections of its boxes with
+        // the region and are owned by the same ranks, so no data is
+        // communicated
+        const auto& ba = mesh.boxArray(lev);
+        const auto& dm = mesh.DistributionMap(lev);
+        amrex::BoxList bl;
+        amrex::Vector<int> pmap;
+        amrex::Vector<int> src_index;
+        for (int i = 0; i < static_cast<int>(ba.size()); ++i) {
+            const auto bx = ba[i] & rbx;
+            if (bx.ok()) {
+                bl.push_back(bx);
+                pmap.push_back(dm[i]);
+                src_index.push_back(i);
+            }
+        }
+        // Finer levels without any boxes within the region are not output
+        if (bl.isEmpty()) {
+            break;
+        }
+
+        const amrex::BoxArray rba(std::move(bl));
+        const amrex::DistributionMapping rdm(std::move(pmap));
+        amrex::MultiFab fine(rba, rdm, m_num_comp, 0);
+        copy_level_data(
+            lev, src_index, (derived ? &(*derived)(lev) : nullptr), fine);
+
+        if (m_coarsen > 1) {
+            if (!rba.coarsenable(m_coarsen)) {
+                amrex::Abort(
+                    "PlotRegion: the boxes of level " + std::to_string(lev) +
+                    " cannot be coarsened by io." + m_label +
+                    ".coarsen, it must divide amr.blocking_factor");
+            }
+            outdata.emplace_back(
+                amrex::coarsen(rba, m_coarsen), rdm, m_num_comp, 0);
+            amrex::average_down(fine, outdata.back(), 0, m_num_comp, m_coarsen);
+        } else {
+            outdata.push_back(std::move(fine));
+        }
+
+        geoms.emplace_back(
+            amrex::coarsen(rbx, m_coarsen), m_rbox, mesh.Geom(0).Coord(),
+            is_periodic);
+        if (lev > 0) {
+            ref_ratio.push_back(mesh.refRatio(lev - 1));
+        }
+    }
+
+    const int nlevels = static_cast<int>(outdata.size());
+    const amrex::Vector<int> istep(nlevels, time.time_index());
+    const std::string plt_filename =
+        amrex::Concatenate(m_plt_prefix, time.time_index());
+    amrex::Print() << "Writing plot file       " << plt_filename << " at time "
+                   << time.new_time() << std::endl;
+    amrex::WriteMultiLevelPlotfile(
+        plt_filename, nlevels, amrex::GetVecOfConstPtrs(outdata), m_var_names,
+        geoms, time.new_time(), istep, ref_ratio);
+    m_sim.io_manager().write_info_file(plt_filename);
+}
+
+} // namespace amr_wind
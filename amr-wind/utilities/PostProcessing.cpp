@@ -1,6 +1,7 @@
 #include "amr-wind/utilities/PostProcessing.H"
 #include "amr-wind/CFDSim.H"
 #include "amr-wind/utilities/averaging/TimeAveraging.H"
+#include "amr-wind/utilities/PerfMonitor.H"
 
 #include "AMReX_ParmParse.H"
 
@@ -37,6 +38,7 @@ void PostProcessManager::pre_init_actions()
 
         perform_checks(registered_types, ptype);
         m_post.emplace_back(PostProcessBase::create(ptype, m_sim, label));
+        m_timer_names.push_back("amr-wind::" + ptype + "::" + label);
     }
 
     for (auto& post : m_post) {
@@ -56,41 +58,94 @@ void PostProcessManager::post_init_actions()
     // Calculate and get minimum tolerance
     m_sim.time().calculate_minimum_enforce_dt_abs_tol();
     auto tol = m_sim.time().get_minimum_enforce_dt_abs_tol();
-    for (auto& post : m_post) {
-        if (post->do_output_now(
+    amrex::Vector<int> outputs;
+    for (int i = 0; i < static_cast<int>(m_post.size()); ++i) {
+        if (m_post[i]->do_output_now(
                 m_sim.time().time_index(), m_sim.time().new_time(),
                 m_sim.time().delta_t(), tol)) {
-            post->output_actions();
+            outputs.push_back(i);
         }
     }
+    output_actions(outputs);
 }
 
 void PostProcessManager::post_advance_work()
 {
     // Get minimum tolerance
     auto tol = m_sim.time().get_minimum_enforce_dt_abs_tol();
-    for (auto& post : m_post) {
-        post->post_advance_work();
-        if (post->do_output_now(
+    // Each utility outputs right after its own post_advance_work, as when the
+    // reductions are not batched, so that utilities registered later (e.g.,
+    // time averaging) do not change the data seen by earlier ones
+    GlobalReductions reductions;
+    amrex::Vector<int> deferred;
+    for (int i = 0; i < static_cast<int>(m_post.size()); ++i) {
+        const perf::ScopedTimer timer(m_timer_names[i]);
+        m_post[i]->post_advance_work();
+        if (m_post[i]->do_output_now(
                 m_sim.time().time_index(), m_sim.time().new_time(),
                 m_sim.time().delta_t(), tol)) {
-            post->output_actions();
+            output_or_defer(i, reductions, deferred);
         }
     }
+    output_deferred(reductions, deferred);
 }
 
 void PostProcessManager::final_output()
 {
     // Get minimum tolerance
     auto tol = m_sim.time().get_minimum_enforce_dt_abs_tol();
-    for (auto& post : m_post) {
+    amrex::Vector<int> outputs;
+    for (int i = 0; i < static_cast<int>(m_post.size()); ++i) {
         // Avoid doing output if already taken place on final time step
-        if (!post->do_output_now(
+        if (!m_post[i]->do_output_now(
                 m_sim.time().time_index(), m_sim.time().new_time(),
                 m_sim.time().delta_t(), tol)) {
-            post->output_actions();
+            outputs.push_back(i);
         }
     }
+    output_actions(outputs);
+}
+
+void PostProcessManager::output_actions(const amrex::Vector<int>& indices)
+{
+    GlobalReductions reductions;
+    amrex::Vector<int> deferred;
+    for (const int i : indices) {
+        const perf::ScopedTimer timer(m_timer_names[i]);
+        output_or_defer(i, reductions, deferred);
+    }
+    output_deferred(reductions, deferred);
+}
+
+void PostProcessManager::output_or_defer(
+    const int idx, GlobalReductions& reductions, amrex::Vector<int>& deferred)
+{
+    // The rank-local contributions are computed at the turn of the utility,
+    // only writing the reduced values waits for the shared collective
+    const int nsums = reductions.num_sums();
+    const int nmaxs = reductions.num_maxs();
+    m_post[idx]->add_local_reductions(reductions);
+    if ((reductions.num_sums() == nsums) && (reductions.num_maxs() == nmaxs)) {
+        m_post[idx]->output_actions();
+    } else {
+        deferred.push_back(idx);
+    }
+}
+
+void PostProcessManager::output_deferred(
+    GlobalReductions& reductions, const amrex::Vector<int>& deferred)
+{
+    if (deferred.empty()) {
+        return;
+    }
+
+    // Scalar diagnostics from all utilities share a single collective
+    reductions.reduce();
+    for (const int i : deferred) {
+        const perf::ScopedTimer timer(m_timer_names[i]);
+        m_post[i]->apply_batched_reductions(reductions);
+        m_post[i]->output_actions();
+    }
 }
 
 void PostProcessManager::post_regrid_actions()
@@ -100,4 +155,12 @@ void PostProcessManager::post_regrid_actions()
     }
 }
 
+void PostProcessManager::flush_output()
+{
+    for (int i = 0; i < static_cast<int>(m_post.size()); ++i) {
+        const perf::ScopedTimer timer(m_timer_names[i]);
+        m_post[i]->flush_output();
+    }
+}
+
 } // namespace amr_wind
@@ -663,35 +663,37 @@ void incflo::PrintMaxValues(const std::string& header)
 {
     BL_PROFILE("amr-wind::incflo::PrintMaxValues");
 
+    amrex::Vector<const amr_wind::Field*> fields{
+        &icns().fields().field, &grad_p()};
+    for (auto& eqn : scalar_eqns()) {
+        fields.push_back(&eqn->fields().field);
+    }
+
+    // Gather the local norms for all levels, fields, and components so that
+    // they are reduced with a single collective
+    amrex::Vector<amrex::Real> norms;
+    for (int lev = 0; lev <= finest_level; lev++) {
+        for (const auto* fld : fields) {
+            for (int i = 0; i < fld->num_comp(); ++i) {
+                norms.push_back((*fld)(lev).norm0(i, 0, true));
+            }
+        }
+    }
+    amrex::ParallelDescriptor::ReduceRealMax(
+        norms.data(), static_cast<int>(norms.size()));
+
     amrex::Print() << "\nL-inf norm summary: " << header << std::endl
                    << "........................................................"
                       "......................";
 
+    int idx = 0;
     for (int lev = 0; lev <= finest_level; lev++) {
         amrex::Print() << "\nLevel " << lev << std::endl;
 
-        const auto& vel = icns().fields().field;
-        amrex::Print() << "  " << std::setw(16) << std::left << vel.name();
-        for (int i = 0; i < vel.num_comp(); ++i) {
-            amrex::Print() << std::setw(20) << std::right << vel(lev).norm0(i);
-        }
-        amrex::Print() << std::endl;
-
-        const auto& gradp = grad_p();
-        amrex::Print() << "  " << std::setw(16) << std::left << gradp.name();
-        for (int i = 0; i < gradp.num_comp(); ++i) {
-            amrex::Print() << std::setw(20) << std::right
-                           << gradp(lev).norm0(i);
-        }
-        amrex::Print() << std::endl;
-
-        for (auto& eqn : scalar_eqns()) {
-            auto& field = eqn->fields().field;
-            amrex::Print() << "  " << std::setw(16) << std::left
-                           << field.name();
-            for (int i = 0; i < field.num_comp(); ++i) {
-                amrex::Print()
-                    << std::setw(20) << std::right << field(lev).norm0(i);
+        for (const auto* fld : fields) {
+            amrex::Print() << "  " << std::setw(16) << std::left << fld->name();
+            for (int i = 0; i < fld->num_comp(); ++i) {
+                amrex::Print() << std::setw(20) << std::right << norms[idx++];
             }
             amrex::Print() << std::endl;
         }
@@ -205,9 +205,8 @@ void incflo::ReadCheckpointFile()
             amrex::Print() << " NEW Domain" << ba_rep.minimalBox() << std::endl;
         }
 
-        // Create distribution mapping
-        dm_inp[lev].define(ba_inp[lev], ParallelDescriptor::NProcs());
-
+        // The new layout is load-balanced for the current number of ranks
+        // and max_grid_size, independent of the layout in the checkpoint
         BoxArray ba(ba_rep.simplified());
         ba.maxSize(maxGridSize(lev));
         if (refine_grid_layout) {
@@ -216,6 +215,19 @@ void incflo::ReadCheckpointFile()
         DistributionMapping dm =
             DistributionMapping{ba, ParallelDescriptor::NProcs()};
 
+        // Checkpoint boxes are read by the ranks that own them in the new
+        // layout. This reduces to the new mapping when the layout is
+        // unchanged.
+        if (ba == ba_inp[lev]) {
+            dm_inp[lev] = dm;
+        } else {
+            amrex::Print() << "Repartitioning checkpoint data on level " << lev
+                           << ": " << ba_inp[lev].size() << " grids -> "
+                           << ba.size() << " grids" << std::endl;
+            dm_inp[lev] = amr_wind::ioutils::overlap_distribution_map(
+                ba_inp[lev], ba, dm);
+        }
+
         MakeNewLevelFromScratch(lev, m_time.current_time(), ba, dm);
     }
 
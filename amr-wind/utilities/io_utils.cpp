@@ -1,6 +1,10 @@
+#include <algorithm>
 #include <fstream>
+#include <map>
+#include <vector>
 
 #include "amr-wind/utilities/io_utils.H"
+#include "AMReX_ParallelDescriptor.H"
 
 namespace amr_wind::ioutils {
 
@@ -56,4 +60,45 @@ void read_flat_grid_file(
 
     file.close();
 }
+
+amrex::DistributionMapping overlap_distribution_map(
+    const amrex::BoxArray& ba_src,
+    const amrex::BoxArray& ba_dst,
+    const amrex::DistributionMapping& dm_dst)
+{
+    const int nprocs = amrex::ParallelDescriptor::NProcs();
+    amrex::Vector<int> pmap(ba_src.size());
+    amrex::Vector<amrex::Long> load(nprocs, 0);
+    std::vector<std::pair<int, amrex::Box>> isects;
+
+    for (int i = 0; i < static_cast<int>(ba_src.size()); ++i) {
+        const amrex::Box& bx = ba_src[i];
+
+        // Number of cells of this box owned by each rank in the target layout
+        std::map<int, amrex::Long> overlap;
+        ba_dst.intersections(bx, isects);
+        for (const auto& is : isects) {
+            overlap[dm_dst[is.first]] += is.second.numPts();
+        }
+
+        int owner = -1;
+        amrex::Long max_overlap = 0;
+        for (const auto& kv : overlap) {
+            if (kv.second > max_overlap) {
+                owner = kv.first;
+                max_overlap = kv.second;
+            }
+        }
+        if (owner < 0) {
+            owner = static_cast<int>(
+                std::min_element(load.begin(), load.end()) - load.begin());
+        }
+
+        pmap[i] = owner;
+        load[owner] += bx.numPts();
+    }
+
+    return amrex::DistributionMapping(std::move(pmap));
+}
+
 } // namespace amr_wind::ioutils
@@ -26,7 +26,7 @@ void Enstrophy::initialize()
     prepare_ascii_file();
 }
 
-amrex::Real Enstrophy::calculate_enstrophy()
+amrex::Real Enstrophy::calculate_enstrophy(const bool local)
 {
     BL_PROFILE("amr-wind::Enstrophy::calculate_enstrophy");
 
@@ -81,7 +81,9 @@ amrex::Real Enstrophy::calculate_enstrophy()
 
     total_enstrophy *= 0.5 / total_vol;
 
-    amrex::ParallelDescriptor::ReduceRealSum(total_enstrophy);
+    if (!local) {
+        amrex::ParallelDescriptor::ReduceRealSum(total_enstrophy);
+    }
 
     return total_enstrophy;
 }
@@ -89,10 +91,20 @@ amrex::Real Enstrophy::calculate_enstrophy()
 void Enstrophy::output_actions()
 {
     BL_PROFILE("amr-wind::Enstrophy::output_actions");
-    m_total_enstrophy = calculate_enstrophy();
+    update_global_reductions();
     write_ascii();
 }
 
+void Enstrophy::add_local_reductions(GlobalReductions& reductions)
+{
+    m_reduction_idx = reductions.add_sum(calculate_enstrophy(true));
+}
+
+void Enstrophy::apply_global_reductions(const GlobalReductions& reductions)
+{
+    m_total_enstrophy = reductions.sum(m_reduction_idx);
+}
+
 void Enstrophy::prepare_ascii_file()
 {
     BL_PROFILE("amr-wind::Enstrophy::prepare_ascii_file");
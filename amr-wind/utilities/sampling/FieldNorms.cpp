@@ -49,28 +49,50 @@ void FieldNorms::initialize()
     }
 
     m_fnorms.resize(m_var_names.size(), 0.0);
+    m_reduction_idx.resize(m_var_names.size(), -1);
 
     prepare_ascii_file();
 }
 
-amrex::Real FieldNorms::get_norm(
+namespace {
+
+//! Masks that zero out regions covered by finer levels (or all ones)
+amrex::Vector<amrex::MultiFab>
+level_masks(const amrex::AmrCore& mesh, const int nlevels, const bool use_mask)
+{
+    amrex::Vector<amrex::MultiFab> masks(nlevels);
+    for (int lev = 0; lev < nlevels; ++lev) {
+        if (use_mask && (lev < nlevels - 1)) {
+            masks[lev] = makeFineMask(
+                mesh.boxArray(lev), mesh.DistributionMap(lev),
+                mesh.boxArray(lev + 1), mesh.refRatio(lev), 1., 0.);
+        } else {
+            // Always on
+            masks[lev].define(
+                mesh.boxArray(lev), mesh.DistributionMap(lev), 1, 0,
+                amrex::MFInfo());
+            masks[lev].setVal(1.);
+        }
+    }
+    return masks;
+}
+
+//! Rank-local contribution to the norm of a field
+amrex::Real local_norm(
     const amr_wind::Field& field,
     const int comp,
     const int ncomp,
     const int norm_type,
-    const bool use_mask)
+    const amrex::Vector<amrex::MultiFab>& masks)
 {
     amrex::Real nrm = 0.0;
 
     AMREX_ASSERT(comp >= 0 && comp < field.num_comp());
 
-    const int finest_level = field.repo().num_active_levels() - 1;
     const auto& geom = field.repo().mesh().Geom();
     constexpr int nghost = 0;
 
-    const auto& mesh = field.repo().mesh();
-
-    for (int lev = 0; lev <= finest_level; lev++) {
+    for (int lev = 0; lev < static_cast<int>(masks.size()); lev++) {
 
         const amrex::Real cell_vol = geom[lev].CellSize()[0] *
                                      geom[lev].CellSize()[1] *
@@ -84,25 +106,7 @@ amrex::Real FieldNorms::get_norm(
             node_dir = index_type[ix] == 1 ? ix : node_dir;
         }
 
-        amrex::MultiFab level_mask;
-        if (use_mask) {
-            if (lev < finest_level) {
-                level_mask = makeFineMask(
-                    mesh.boxArray(lev), mesh.DistributionMap(lev),
-                    mesh.boxArray(lev + 1), mesh.refRatio(lev), 1., 0.);
-            } else {
-                level_mask.define(
-                    mesh.boxArray(lev), mesh.DistributionMap(lev), 1, 0,
-                    amrex::MFInfo());
-                level_mask.setVal(1.);
-            }
-        } else {
-            // Always on
-            level_mask.define(
-                mesh.boxArray(lev), mesh.DistributionMap(lev), 1, 0,
-                amrex::MFInfo());
-            level_mask.setVal(1.);
-        }
+        const auto& level_mask = masks[lev];
 
         if (norm_type > 0) {
             nrm += amrex::ReduceSum(
@@ -183,41 +187,86 @@ amrex::Real FieldNorms::get_norm(
         }
     }
 
+    return nrm;
+}
+
+//! Convert the globally reduced sum to the requested norm
+amrex::Real finalize_norm(
+    const amrex::Real nrm, const int norm_type, const amrex::Geometry& geom)
+{
+    if (norm_type < 0) {
+        return nrm;
+    }
+    const amrex::Real total_volume = geom.ProbDomain().volume();
+    const amrex::Real nrm_avg = nrm / total_volume;
+    return (norm_type == 2) ? std::sqrt(nrm_avg) : nrm_avg;
+}
+
+} // namespace
+
+amrex::Real FieldNorms::get_norm(
+    const amr_wind::Field& field,
+    const int comp,
+    const int ncomp,
+    const int norm_type,
+    const bool use_mask)
+{
+    const int nlevels = field.repo().num_active_levels();
+    const auto masks = level_masks(field.repo().mesh(), nlevels, use_mask);
+
+    amrex::Real nrm = local_norm(field, comp, ncomp, norm_type, masks);
     if (norm_type > 0) {
         amrex::ParallelDescriptor::ReduceRealSum(nrm);
-        const amrex::Real total_volume = geom[0].ProbDomain().volume();
-        nrm /= total_volume;
-        if (norm_type == 2) {
-            nrm = std::sqrt(nrm);
-        }
     } else {
         amrex::ParallelDescriptor::ReduceRealMax(nrm);
     }
 
-    return nrm;
+    return finalize_norm(nrm, norm_type, field.repo().mesh().Geom(0));
 }
 
-void FieldNorms::process_field_norms()
+void FieldNorms::add_local_reductions(GlobalReductions& reductions)
 {
+    BL_PROFILE("amr-wind::FieldNorms::add_local_reductions");
+
+    // The level masks are shared by all fields and components
+    const auto masks =
+        level_masks(m_sim.mesh(), m_sim.repo().num_active_levels(), m_use_mask);
+
+    const auto add_norm = [&](const amrex::Real nrm) {
+        return (m_norm_type > 0) ? reductions.add_sum(nrm)
+                                 : reductions.add_max(nrm);
+    };
+
     int ind = 0;
     for (const auto& fld : m_sim.io_manager().plot_fields()) {
         if (m_use_vector_magnitude) {
-            m_fnorms[ind++] =
-                get_norm(*fld, 0, fld->num_comp(), m_norm_type, m_use_mask);
+            m_reduction_idx[ind++] = add_norm(
+                local_norm(*fld, 0, fld->num_comp(), m_norm_type, masks));
         } else {
             for (int comp = 0; comp < fld->num_comp(); ++comp) {
-                m_fnorms[ind++] =
-                    get_norm(*fld, comp, 1, m_norm_type, m_use_mask);
+                m_reduction_idx[ind++] =
+                    add_norm(local_norm(*fld, comp, 1, m_norm_type, masks));
             }
         }
     }
 }
 
+void FieldNorms::apply_global_reductions(const GlobalReductions& reductions)
+{
+    const auto& geom = m_sim.mesh().Geom(0);
+    for (int i = 0; i < static_cast<int>(m_fnorms.size()); ++i) {
+        const amrex::Real nrm = (m_norm_type > 0)
+                                    ? reductions.sum(m_reduction_idx[i])
+                                    : reductions.max(m_reduction_idx[i]);
+        m_fnorms[i] = finalize_norm(nrm, m_norm_type, geom);
+    }
+}
+
 void FieldNorms::output_actions()
 {
     BL_PROFILE("amr-wind::FieldNorms::output_actions");
 
-    process_field_norms();
+    update_global_reductions();
     write_ascii();
 }
 
@@ -7,6 +7,8 @@
 
 #include "AMReX_ParmParse.H"
 
+#include <limits>
+
 namespace amr_wind::sampling {
 
 FreeSurfaceSampler::FreeSurfaceSampler(CFDSim& sim)
@@ -27,6 +29,7 @@ void FreeSurfaceSampler::initialize(const std::string& key)
         pp.query("search_direction", m_coorddir);
         pp.query("num_instances", m_ninst);
         pp.query("max_sample_points_per_cell", m_ncmax);
+        pp.query("search_window", m_search_window);
         m_use_linear = pp.contains("linear_interp_extent_from_xhi");
         if (m_use_linear) {
             pp.get("linear_interp_extent_from_xhi", m_lx_linear);
@@ -241,13 +244,14 @@ void FreeSurfaceSampler::initialize(const std::string& key)
         const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> phi =
             geom.ProbHiArray();
 #ifdef AMREX_USE_OMP
-#pragma omp parallel if (false)
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
 #endif
-        for (amrex::MFIter mfi(floc(lev)); mfi.isValid(); ++mfi) {
+        for (amrex::MFIter mfi(floc(lev), amrex::TilingIfNotGPU());
+             mfi.isValid(); ++mfi) {
             auto loc_arr = floc(lev).array(mfi);
             auto idx_arr = fidx(lev).array(mfi);
             auto mask_arr = level_mask.const_array(mfi);
-            const auto& vbx = mfi.validbox();
+            const auto& vbx = mfi.tilebox();
             amrex::ParallelFor(
                 vbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
                     // Cell location
@@ -339,6 +343,7 @@ void FreeSurfaceSampler::initialize(const std::string& key)
                 });
         }
     }
+    update_search_columns();
 }
 void FreeSurfaceSampler::check_bounds()
 {
@@ -409,24 +414,256 @@ void FreeSurfaceSampler::sampling_locations(
     }
 }
 
-bool FreeSurfaceSampler::update_sampling_locations()
+namespace {
+
+/** Height of the interface within a cell at a sample location
+ *
+ *  Returns the lower domain bound when the interface does not cross the
+ *  cell at this location.
+ */
+AMREX_GPU_DEVICE AMREX_FORCE_INLINE amrex::Real cell_interface_height(
+    const int i,
+    const int j,
+    const int k,
+    const int ni,
+    const amrex::Real loc0,
+    const amrex::Real loc1,
+    amrex::Array4<amrex::Real const> const& vof_arr,
+    const bool use_linear_interp,
+    const int dir,
+    const int gc0,
+    const int gc1,
+    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& dx,
+    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& dxi,
+    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& plo)
 {
+    // Cell location
+    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> xm;
+    xm[0] = plo[0] + (i + 0.5) * dx[0];
+    xm[1] = plo[1] + (j + 0.5) * dx[1];
+    xm[2] = plo[2] + (k + 0.5) * dx[2];
 
-    BL_PROFILE("amr-wind::FreeSurfaceSampler::update_sampling_locations");
+    // Indices and slope variables
+    // Get modified indices for checking up and down and orient normal in
+    // search direction
+    amrex::Real mx = (dir == 0) ? 1.0 : 0.0;
+    amrex::Real my = (dir == 1) ? 1.0 : 0.0;
+    amrex::Real mz = (dir == 2) ? 1.0 : 0.0;
+    amrex::Real alpha = 1.0;
+    // If cell is full of single phase (accounts for when interface is at
+    // intersection of cells but lower one is not single-phase)
+    bool calc_flag = false;
+    bool calc_flag_diffuse = false;
+    const bool single_phase_below_interface =
+        (ni % 2 == 0 && vof_arr(i, j, k) >= 1.0 - 1e-12) ||
+        (ni % 2 != 0 && vof_arr(i, j, k) <= 1e-12);
+    const bool multiphase =
+        vof_arr(i, j, k) < (1.0 - 1e-12) && vof_arr(i, j, k) > 1e-12;
+    const bool single_phase_above_interface =
+        !(multiphase || single_phase_below_interface);
+    if (single_phase_below_interface) {
+        // put bdy at top
+        alpha = 1.0;
+        if (ni % 2 != 0) {
+            mx *= -1.0;
+            my *= -1.0;
+            mz *= -1.0;
+            alpha *= -1.0;
+        }
+        calc_flag = true;
+    }
+    // Multiphase cell case
+    if (multiphase) {
+        if (!use_linear_interp) {
+            // Planar reconstruction
+            calc_flag = true;
+            multiphase::fit_plane(i, j, k, vof_arr, mx, my, mz, alpha);
+        } else {
+            // Interpolation (later)
+            calc_flag_diffuse = true;
+        }
+    }
+    // Single-phase cell bordering other phase, does not fit into other
+    // categories
+    if (single_phase_above_interface && use_linear_interp) {
+        // With linear interp, interface can show up in single-phase cell
+        const amrex::IntVect iv{i, j, k};
+        amrex::IntVect iv_p = iv;
+        amrex::IntVect iv_m = iv;
+        iv_p[dir] += 1;
+        iv_m[dir] -= 1;
+        // Check for 0.5 intersect
+        const bool intersect_above =
+            (vof_arr(iv_p) - 0.5) * (vof_arr(iv) - 0.5) <= 0;
+        const bool intersect_below =
+            (vof_arr(iv) - 0.5) * (vof_arr(iv_m) - 0.5) <= 0;
+        calc_flag_diffuse = calc_flag_diffuse || intersect_above;
+        calc_flag_diffuse = calc_flag_diffuse || intersect_below;
+    }
 
-    // Zero data in output array
-    for (int n = 0; n < m_npts * m_ninst; n++) {
-        m_out[n] = 0.0;
+    // Initialize height measurement
+    amrex::Real ht = plo[dir];
+    if (calc_flag) {
+        // Reassign slope coefficients
+        const amrex::Real mdr = (dir == 0) ? mx : ((dir == 1) ? my : mz);
+        const amrex::Real mg1 = (dir == 0) ? my : mx;
+        const amrex::Real mg2 = (dir == 2) ? my : mz;
+        // Get height of interface
+        if (mdr == 0) {
+            // If slope is undefined in z, use middle of cell
+            ht = xm[dir];
+        } else {
+            // Intersect 2D point with plane
+            ht = (xm[dir] - 0.5 * dx[dir]) +
+                 (alpha -
+                  mg1 * dxi[gc0] * (loc0 - (xm[gc0] - 0.5 * dx[gc0])) -
+                  mg2 * dxi[gc1] * (loc1 - (xm[gc1] - 0.5 * dx[gc1]))) /
+                     (mdr * dxi[dir]);
+        }
     }
-    // Set up device vector of current outputs, initialize to plo
-    const auto& plo0 = m_sim.mesh().Geom(0).ProbLoArray();
-    amrex::Gpu::DeviceVector<amrex::Real> dout(m_npts, plo0[m_coorddir]);
-    auto* dout_ptr = dout.data();
-    // Set up device vector of last outputs, initialize to above phi0
-    const auto& phi0 = m_sim.mesh().Geom(0).ProbHiArray();
-    amrex::Gpu::DeviceVector<amrex::Real> dout_last(
-        m_npts, phi0[m_coorddir] + 1.0);
-    auto* dlst_ptr = dout_last.data();
+    if (calc_flag_diffuse) {
+        const amrex::Real dv_xl = vof_arr(i, j, k) - vof_arr(i - 1, j, k);
+        const amrex::Real dv_xr = vof_arr(i + 1, j, k) - vof_arr(i, j, k);
+        const amrex::Real dv_yl = vof_arr(i, j, k) - vof_arr(i, j - 1, k);
+        const amrex::Real dv_yr = vof_arr(i, j + 1, k) - vof_arr(i, j, k);
+        const amrex::Real dv_zl = vof_arr(i, j, k) - vof_arr(i, j, k - 1);
+        const amrex::Real dv_zr = vof_arr(i, j, k + 1) - vof_arr(i, j, k);
+        // Distances from cell center to probe loc
+        const amrex::Real dist_0 = loc0 - xm[gc0];
+        const amrex::Real dist_1 = loc1 - xm[gc1];
+        // Slopes on either side
+        amrex::Real slope_dir_r = dir == 0 ? dv_xr : (dir == 1 ? dv_yr : dv_zr);
+        amrex::Real slope_dir_l = dir == 0 ? dv_xl : (dir == 1 ? dv_yl : dv_zl);
+        // One-sided slopes for when sign of distance to interface is known
+        amrex::Real slope_0 = dist_0 > 0 ? (dir == 0 ? dv_yr : dv_xr)
+                                         : (dir == 0 ? dv_yl : dv_xl);
+        amrex::Real slope_1 = dist_1 > 0 ? (dir == 2 ? dv_yr : dv_zr)
+                                         : (dir == 2 ? dv_yl : dv_zl);
+        // Turn finite differences into true slopes
+        slope_dir_r *= dxi[dir];
+        slope_dir_l *= dxi[dir];
+        slope_0 *= dxi[gc0];
+        slope_1 *= dxi[gc1];
+        // Trilinear interpolation for vof
+        const amrex::Real vof_c =
+            vof_arr(i, j, k) + slope_0 * dist_0 + slope_1 * dist_1;
+        // Extrapolate to cell edge (0.5) plus a factor of safety (0.1)
+        // because reconstruction is not identical in neighboring cells
+        const amrex::Real vof_r = vof_c + 0.6 * slope_dir_r * dx[dir];
+        const amrex::Real vof_l = vof_c - 0.6 * slope_dir_l * dx[dir];
+        // Check for intersect with 0.5
+        if ((vof_c - 0.5) * (vof_r - 0.5) <= 0.) {
+            ht = xm[dir] + (0.5 - vof_c) / (slope_dir_r + constants::EPS);
+        } else if ((vof_c - 0.5) * (vof_l - 0.5) <= 0.) {
+            ht = xm[dir] + (0.5 - vof_c) / (slope_dir_l + constants::EPS);
+        } else {
+            // Skip if no intersection
+            ht = plo[dir];
+        }
+    }
+
+    if (calc_flag || calc_flag_diffuse) {
+        // If interface is below lower bound, continue to look
+        if (ht < xm[dir] - 0.5 * dx[dir]) {
+            ht = plo[dir];
+        }
+        // If interface is above upper bound, limit it
+        if (ht > xm[dir] + 0.5 * dx[dir] * (1.0 + 1e-8)) {
+            ht = xm[dir] + 0.5 * dx[dir];
+        }
+    }
+    return ht;
+}
+
+/** Range of cell indices along one grid direction that can hold sample points
+ *
+ *  The range is padded by one cell on either side and clipped to [lo, hi];
+ *  an empty range (first > second) indicates no sample points.
+ */
+std::pair<int, int> sample_cell_range(
+    const int lo,
+    const int hi,
+    const amrex::Real start,
+    const amrex::Real dxs,
+    const int npts,
+    const amrex::Real plo,
+    const amrex::Real dx)
+{
+    int m_lo = 0;
+    int m_hi = npts - 1;
+    if (npts > 1 && dxs != 0.0) {
+        // Sample spacing can be negative when the plane end precedes start
+        const amrex::Real ma = (plo + (lo - 1) * dx - start) / dxs;
+        const amrex::Real mb = (plo + (hi + 2) * dx - start) / dxs;
+        m_lo = amrex::max(
+            m_lo, static_cast<int>(std::ceil(amrex::min(ma, mb))));
+        m_hi = amrex::min(
+            m_hi, static_cast<int>(std::floor(amrex::max(ma, mb))));
+    }
+    if (m_lo > m_hi) {
+        return {1, 0};
+    }
+    const int c_a =
+        static_cast<int>(std::floor((start + m_lo * dxs - plo) / dx));
+    const int c_b =
+        static_cast<int>(std::floor((start + m_hi * dxs - plo) / dx));
+    const int c_lo = amrex::min(c_a, c_b) - 1;
+    const int c_hi = amrex::max(c_a, c_b) + 1;
+    return {amrex::max(lo, c_lo), amrex::min(hi, c_hi)};
+}
+
+} // namespace
+
+void FreeSurfaceSampler::update_search_columns()
+{
+    BL_PROFILE("amr-wind::FreeSurfaceSampler::update_search_columns");
+
+    const amrex::Real dxs0 =
+        (m_end[m_gc0] - m_start[m_gc0]) / amrex::max(m_npts_dir[0] - 1, 1);
+    const amrex::Real dxs1 =
+        (m_end[m_gc1] - m_start[m_gc1]) / amrex::max(m_npts_dir[1] - 1, 1);
+
+    const auto& fidx = m_sim.repo().get_int_field("sample_idx_" + m_label);
+    const int nlevels = m_vof.repo().num_active_levels();
+    m_search_columns.resize(nlevels);
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto& geom = m_sim.mesh().Geom(lev);
+        auto& columns = m_search_columns[lev];
+        columns.clear();
+        columns.resize(fidx(lev).local_size());
+        for (amrex::MFIter mfi(fidx(lev)); mfi.isValid(); ++mfi) {
+            const auto& vbx = mfi.validbox();
+            const auto r0 = sample_cell_range(
+                vbx.smallEnd(m_gc0), vbx.bigEnd(m_gc0), m_start[m_gc0], dxs0,
+                m_npts_dir[0], geom.ProbLo(m_gc0), geom.CellSize(m_gc0));
+            const auto r1 = sample_cell_range(
+                vbx.smallEnd(m_gc1), vbx.bigEnd(m_gc1), m_start[m_gc1], dxs1,
+                m_npts_dir[1], geom.ProbLo(m_gc1), geom.CellSize(m_gc1));
+            // Boxes without any sample columns keep an empty footprint
+            if (r0.first > r0.second || r1.first > r1.second) {
+                continue;
+            }
+            amrex::IntVect lo = vbx.smallEnd();
+            amrex::IntVect hi = vbx.bigEnd();
+            lo[m_gc0] = r0.first;
+            hi[m_gc0] = r0.second;
+            lo[m_gc1] = r1.first;
+            hi[m_gc1] = r1.second;
+            // Columns are walked along the search direction by each thread
+            hi[m_coorddir] = lo[m_coorddir];
+            columns[mfi.LocalIndex()] = amrex::Box(lo, hi);
+        }
+    }
+}
+
+void FreeSurfaceSampler::search_columns(
+    const int ni,
+    const amrex::Real* search_lo,
+    const amrex::Real* search_hi,
+    const amrex::Real* last_ptr,
+    amrex::Real* out)
+{
+    BL_PROFILE("amr-wind::FreeSurfaceSampler::search_columns");
 
     // Get working fields
     auto& fidx = m_sim.repo().get_int_field("sample_idx_" + m_label);
@@ -439,17 +676,25 @@ bool FreeSurfaceSampler::update_sampling_locations()
     const int gc0 = m_gc0;
     const int gc1 = m_gc1;
     const int ncomp = m_ncomp;
+    const int npts = m_npts;
+    const amrex::Real plo_dir = m_sim.mesh().Geom(0).ProbLo(dir);
 
-    bool use_linear = m_use_linear;
+    const bool use_linear = m_use_linear;
     const amrex::Real lx_linear = m_lx_linear;
-    bool has_overset = m_sim.has_overset();
+    const bool has_overset = m_sim.has_overset();
     amr_wind::IntField* iblank_ptr{nullptr};
     if (has_overset) {
         iblank_ptr = &m_sim.repo().get_int_field("iblank_cell");
     }
 
-    // Loop instances
-    for (int ni = 0; ni < m_ninst; ++ni) {
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+    {
+        // Each thread keeps its own heights, combined once at the end
+        amrex::Gpu::DeviceVector<amrex::Real> tout(npts, plo_dir);
+        auto* tout_ptr = tout.data();
+
         for (int lev = 0; lev <= finest_level; lev++) {
             // Level mask info is built into idx info
 
@@ -462,245 +707,168 @@ bool FreeSurfaceSampler::update_sampling_locations()
             const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> plo =
                 geom.ProbLoArray();
             const amrex::Real xhi = geom.ProbHi(0);
-#ifdef AMREX_USE_OMP
-#pragma omp parallel if (false)
-#endif
+            const auto& columns = m_search_columns[lev];
+
             for (amrex::MFIter mfi(floc(lev)); mfi.isValid(); ++mfi) {
+                const auto& cbx = columns[mfi.LocalIndex()];
+                if (cbx.isEmpty()) {
+                    continue;
+                }
+                const auto& vbx = mfi.validbox();
+                const int kbot = vbx.smallEnd(dir);
+                const int ktop = vbx.bigEnd(dir);
                 auto loc_arr = floc(lev).const_array(mfi);
                 auto idx_arr = fidx(lev).const_array(mfi);
                 auto vof_arr = m_vof(lev).const_array(mfi);
                 auto ibl_arr = has_overset ? (*iblank_ptr)(lev).const_array(mfi)
-                                           : amrex::Array4<int>();
-                const auto& vbx = mfi.validbox();
+                                           : amrex::Array4<int const>();
                 amrex::ParallelFor(
-                    vbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                        // Cell location
-                        amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> xm;
-                        xm[0] = plo[0] + (i + 0.5) * dx[0];
-                        xm[1] = plo[1] + (j + 0.5) * dx[1];
-                        xm[2] = plo[2] + (k + 0.5) * dx[2];
-                        bool linear_on =
-                            use_linear && (xm[0] >= xhi - lx_linear);
-                        // Loop number of components
-                        for (int n = 0; n < ncomp; ++n) {
+                    cbx, ncomp,
+                    [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+                        amrex::IntVect iv{i, j, k};
+                        // Walk down the column, the first interface found is
+                        // the highest one below the previous instance
+                        for (int kk = ktop; kk >= kbot; --kk) {
+                            iv[dir] = kk;
                             // Get index of current component and cell
-                            const int idx = idx_arr(i, j, k, n);
-                            // Proceed if there is sample point at this i,j,k,n
-                            // and that cell height is below previous instance
-                            if (idx >= 0 && dlst_ptr[amrex::max(0, idx)] >
-                                                xm[dir] + 0.5 * dx[dir]) {
-                                // Get sample locations from field loc
-                                amrex::Real loc0 = loc_arr(i, j, k, 2 * n);
-                                amrex::Real loc1 = loc_arr(i, j, k, 2 * n + 1);
-
-                                // Indices and slope variables
-                                // Get modified indices for checking up
-                                // and down and orient normal in search
-                                // direction
-                                amrex::Real mx = (dir == 0) ? 1.0 : 0.0;
-                                amrex::Real my = (dir == 1) ? 1.0 : 0.0;
-                                amrex::Real mz = (dir == 2) ? 1.0 : 0.0;
-                                amrex::Real alpha = 1.0;
-                                // If cell is full of single phase
-                                // (accounts for when interface is at
-                                // intersection of cells but lower one
-                                // is not single-phase)
-                                bool calc_flag = false;
-                                bool calc_flag_diffuse = false;
-                                const bool single_phase_below_interface =
-                                    (ni % 2 == 0 &&
-                                     vof_arr(i, j, k) >= 1.0 - 1e-12) ||
-                                    (ni % 2 != 0 && vof_arr(i, j, k) <= 1e-12);
-                                const bool multiphase =
-                                    vof_arr(i, j, k) < (1.0 - 1e-12) &&
-                                    vof_arr(i, j, k) > 1e-12;
-                                const bool use_linear_interp =
-                                    (has_overset && ibl_arr(i, j, k) == -1) ||
-                                    linear_on;
-                                const bool single_phase_above_interface = !(
-                                    multiphase || single_phase_below_interface);
-                                if (single_phase_below_interface) {
-                                    // put bdy at top
-                                    alpha = 1.0;
-                                    if (ni % 2 != 0) {
-                                        mx *= -1.0;
-                                        my *= -1.0;
-                                        mz *= -1.0;
-                                        alpha *= -1.0;
-                                    }
-                                    calc_flag = true;
-                                }
-                                // Multiphase cell case
-                                if (multiphase) {
-                                    if (!use_linear_interp) {
-                                        // Planar reconstruction
-                                        calc_flag = true;
-                                        multiphase::fit_plane(
-                                            i, j, k, vof_arr, mx, my, mz,
-                                            alpha);
-                                    } else {
-                                        // Interpolation (later)
-                                        calc_flag_diffuse = true;
-                                    }
-                                }
-                                // Single-phase cell bordering other phase, does
-                                // not fit into other categories
-                                if (single_phase_above_interface &&
-                                    use_linear_interp) {
-                                    // With linear interp, interface can show up
-                                    // in single-phase cell
-                                    const amrex::IntVect iv{i, j, k};
-                                    amrex::IntVect iv_p = iv;
-                                    amrex::IntVect iv_m = iv;
-                                    iv_p[dir] += 1;
-                                    iv_m[dir] -= 1;
-                                    // Check for 0.5 intersect
-                                    const bool intersect_above =
-                                        (vof_arr(iv_p) - 0.5) *
-                                            (vof_arr(iv) - 0.5) <=
-                                        0;
-                                    const bool intersect_below =
-                                        (vof_arr(iv) - 0.5) *
-                                            (vof_arr(iv_m) - 0.5) <=
-                                        0;
-                                    calc_flag_diffuse =
-                                        calc_flag_diffuse || intersect_above;
-                                    calc_flag_diffuse =
-                                        calc_flag_diffuse || intersect_below;
-                                }
-
-                                // Initialize height measurement
-                                amrex::Real ht = plo[dir];
-                                if (calc_flag) {
-                                    // Reassign slope coefficients
-                                    const amrex::Real mdr =
-                                        (dir == 0) ? mx
-                                                   : ((dir == 1) ? my : mz);
-                                    const amrex::Real mg1 =
-                                        (dir == 0) ? my : mx;
-                                    const amrex::Real mg2 =
-                                        (dir == 2) ? my : mz;
-                                    // Get height of interface
-                                    if (mdr == 0) {
-                                        // If slope is undefined in z,
-                                        // use middle of cell
-                                        ht = xm[dir];
-                                    } else {
-                                        // Intersect 2D point with plane
-                                        ht = (xm[dir] - 0.5 * dx[dir]) +
-                                             (alpha -
-                                              mg1 * dxi[gc0] *
-                                                  (loc0 -
-                                                   (xm[gc0] - 0.5 * dx[gc0])) -
-                                              mg2 * dxi[gc1] *
-                                                  (loc1 -
-                                                   (xm[gc1] - 0.5 * dx[gc1]))) /
-                                                 (mdr * dxi[dir]);
-                                    }
-                                }
-                                if (calc_flag_diffuse) {
-                                    const amrex::Real dv_xl =
-                                        vof_arr(i, j, k) - vof_arr(i - 1, j, k);
-                                    const amrex::Real dv_xr =
-                                        vof_arr(i + 1, j, k) - vof_arr(i, j, k);
-                                    const amrex::Real dv_yl =
-                                        vof_arr(i, j, k) - vof_arr(i, j - 1, k);
-                                    const amrex::Real dv_yr =
-                                        vof_arr(i, j + 1, k) - vof_arr(i, j, k);
-                                    const amrex::Real dv_zl =
-                                        vof_arr(i, j, k) - vof_arr(i, j, k - 1);
-                                    const amrex::Real dv_zr =
-                                        vof_arr(i, j, k + 1) - vof_arr(i, j, k);
-                                    // Distances from cell center to probe loc
-                                    const amrex::Real dist_0 = loc0 - xm[gc0];
-                                    const amrex::Real dist_1 = loc1 - xm[gc1];
-                                    // Slopes on either side
-                                    amrex::Real slope_dir_r =
-                                        dir == 0 ? dv_xr
-                                                 : (dir == 1 ? dv_yr : dv_zr);
-                                    amrex::Real slope_dir_l =
-                                        dir == 0 ? dv_xl
-                                                 : (dir == 1 ? dv_yl : dv_zl);
-                                    // One-sided slopes for when sign of
-                                    // distance to interface is known
-                                    amrex::Real slope_0 =
-                                        dist_0 > 0 ? (dir == 0 ? dv_yr : dv_xr)
-                                                   : (dir == 0 ? dv_yl : dv_xl);
-                                    amrex::Real slope_1 =
-                                        dist_1 > 0 ? (dir == 2 ? dv_yr : dv_zr)
-                                                   : (dir == 2 ? dv_yl : dv_zl);
-                                    // Turn finite differences into true slopes
-                                    slope_dir_r *= dxi[dir];
-                                    slope_dir_l *= dxi[dir];
-                                    slope_0 *= dxi[gc0];
-                                    slope_1 *= dxi[gc1];
-                                    // Trilinear interpolation for vof
-                                    const amrex::Real vof_c = vof_arr(i, j, k) +
-                                                              slope_0 * dist_0 +
-                                                              slope_1 * dist_1;
-                                    // Extrapolate to cell edge (0.5) plus a
-                                    // factor of safety (0.1) because
-                                    // reconstruction is not identical in
-                                    // neighboring cells
-                                    const amrex::Real vof_r =
-                                        vof_c + 0.6 * slope_dir_r * dx[dir];
-                                    const amrex::Real vof_l =
-                                        vof_c - 0.6 * slope_dir_l * dx[dir];
-                                    // Check for intersect with 0.5
-                                    if ((vof_c - 0.5) * (vof_r - 0.5) <= 0.) {
-                                        ht = xm[dir] +
-                                             (0.5 - vof_c) /
-                                                 (slope_dir_r + constants::EPS);
-                                    } else if (
-                                        (vof_c - 0.5) * (vof_l - 0.5) <= 0.) {
-                                        ht = xm[dir] +
-                                             (0.5 - vof_c) /
-                                                 (slope_dir_l + constants::EPS);
-                                    } else {
-                                        // Skip if no intersection
-                                        ht = plo[dir];
-                                    }
-                                }
-
-                                if (calc_flag || calc_flag_diffuse) {
-                                    // If interface is below lower
-                                    // bound, continue to look
-                                    if (ht < xm[dir] - 0.5 * dx[dir]) {
-                                        ht = plo[dir];
-                                    }
-                                    // If interface is above upper
-                                    // bound, limit it
-                                    if (ht > xm[dir] +
-                                                 0.5 * dx[dir] * (1.0 + 1e-8)) {
-                                        ht = xm[dir] + 0.5 * dx[dir];
-                                    }
-                                    // Save interface location by atomic max
-                                    amrex::Gpu::Atomic::Max(&dout_ptr[idx], ht);
-                                }
+                            const int idx = idx_arr(iv, n);
+                            if (idx < 0) {
+                                continue;
+                            }
+                            const amrex::Real cell_lo = plo[dir] + kk * dx[dir];
+                            const amrex::Real cell_hi = cell_lo + dx[dir];
+                            // Cell must be below the previous instance and
+                            // overlap the search interval
+                            if (last_ptr[idx] <= cell_hi ||
+                                cell_hi < search_lo[idx] ||
+                                cell_lo > search_hi[idx]) {
+                                continue;
+                            }
+                            const amrex::Real xc =
+                                plo[0] + (iv[0] + 0.5) * dx[0];
+                            const bool use_linear_interp =
+                                (has_overset && ibl_arr(iv) == -1) ||
+                                (use_linear && (xc >= xhi - lx_linear));
+                            const amrex::Real ht = cell_interface_height(
+                                iv[0], iv[1], iv[2], ni, loc_arr(iv, 2 * n),
+                                loc_arr(iv, 2 * n + 1), vof_arr,
+                                use_linear_interp, dir, gc0, gc1, dx, dxi, plo);
+                            if (ht > plo_dir) {
+                                amrex::Gpu::Atomic::Max(&tout_ptr[idx], ht);
+                                break;
                             }
                         }
                     });
             }
         }
 
+        amrex::Gpu::streamSynchronize();
+#ifdef AMREX_USE_OMP
+#pragma omp critical(free_surface_search)
+#endif
+        {
+            amrex::ParallelFor(npts, [=] AMREX_GPU_DEVICE(int n) noexcept {
+                out[n] = amrex::max(out[n], tout_ptr[n]);
+            });
+            amrex::Gpu::streamSynchronize();
+        }
+    }
+}
+
+bool FreeSurfaceSampler::update_sampling_locations()
+{
+
+    BL_PROFILE("amr-wind::FreeSurfaceSampler::update_sampling_locations");
+
+    // Heights from the previous update seed the windowed search
+    const bool use_window = (m_search_window > 0.0) && m_has_heights;
+    const amrex::Vector<amrex::Real> prev_out = m_out;
+
+    // Set up device vector of current outputs, initialize to plo
+    const auto& plo0 = m_sim.mesh().Geom(0).ProbLoArray();
+    amrex::Gpu::DeviceVector<amrex::Real> dout(m_npts, plo0[m_coorddir]);
+    auto* dout_ptr = dout.data();
+    // Set up device vector of last outputs, initialize to above phi0
+    const auto& phi0 = m_sim.mesh().Geom(0).ProbHiArray();
+    amrex::Gpu::DeviceVector<amrex::Real> dout_last(
+        m_npts, phi0[m_coorddir] + 1.0);
+    auto* dlst_ptr = dout_last.data();
+    // Search interval in the search direction for each point
+    amrex::Gpu::DeviceVector<amrex::Real> search_lo(m_npts);
+    amrex::Gpu::DeviceVector<amrex::Real> search_hi(m_npts);
+    auto* slo_ptr = search_lo.data();
+    auto* shi_ptr = search_hi.data();
+    amrex::Vector<amrex::Real> h_slo(m_npts);
+    amrex::Vector<amrex::Real> h_shi(m_npts);
+    amrex::Vector<int> windowed(m_npts, 0);
+
+    const amrex::Real plo_dir = plo0[m_coorddir];
+    constexpr amrex::Real big = std::numeric_limits<amrex::Real>::max();
+
+    // Loop instances
+    for (int ni = 0; ni < m_ninst; ++ni) {
+        auto* ninst_out = &m_out[ni * m_npts];
+        int nwindowed = 0;
+        for (int n = 0; n < m_npts; ++n) {
+            // Only points with an interface found previously use the window
+            const amrex::Real hprev = prev_out[ni * m_npts + n];
+            windowed[n] = (use_window && hprev > plo_dir) ? 1 : 0;
+            nwindowed += windowed[n];
+            h_slo[n] = (windowed[n] != 0) ? hprev - m_search_window : -big;
+            h_shi[n] = (windowed[n] != 0) ? hprev + m_search_window : big;
+        }
+        amrex::Gpu::copy(
+            amrex::Gpu::hostToDevice, h_slo.begin(), h_slo.end(),
+            search_lo.begin());
+        amrex::Gpu::copy(
+            amrex::Gpu::hostToDevice, h_shi.begin(), h_shi.end(),
+            search_hi.begin());
+
+        search_columns(ni, slo_ptr, shi_ptr, dlst_ptr, dout_ptr);
+
         // Copy information back from device
         amrex::Gpu::copy(
-            amrex::Gpu::deviceToHost, dout.begin(), dout.end(),
-            &m_out[static_cast<long>(ni) * m_npts]);
-        // Make consistent across parallelization
-        for (int n = 0; n < m_npts; n++) {
-            amrex::ParallelDescriptor::ReduceRealMax(m_out[ni * m_npts + n]);
+            amrex::Gpu::deviceToHost, dout.begin(), dout.end(), ninst_out);
+        // Make consistent across parallelization, all points at once
+        amrex::ParallelDescriptor::ReduceRealMax(ninst_out, m_npts);
+
+        if (nwindowed > 0) {
+            // Points whose interface left the window get a full search. The
+            // reduced heights are identical on all ranks, so this decision
+            // needs no additional communication.
+            int nmissed = 0;
+            for (int n = 0; n < m_npts; ++n) {
+                const bool missed =
+                    (windowed[n] != 0) && !(ninst_out[n] > plo_dir);
+                nmissed += missed ? 1 : 0;
+                h_slo[n] = missed ? -big : big;
+                h_shi[n] = big;
+            }
+            if (nmissed > 0) {
+                amrex::Gpu::copy(
+                    amrex::Gpu::hostToDevice, h_slo.begin(), h_slo.end(),
+                    search_lo.begin());
+                amrex::Gpu::copy(
+                    amrex::Gpu::hostToDevice, h_shi.begin(), h_shi.end(),
+                    search_hi.begin());
+                search_columns(ni, slo_ptr, shi_ptr, dlst_ptr, dout_ptr);
+                amrex::Gpu::copy(
+                    amrex::Gpu::deviceToHost, dout.begin(), dout.end(),
+                    ninst_out);
+                amrex::ParallelDescriptor::ReduceRealMax(ninst_out, m_npts);
+            }
         }
+
         // Copy last m_out to device vector of results of last instance
         amrex::Gpu::copy(
-            amrex::Gpu::hostToDevice, &m_out[static_cast<long>(ni) * m_npts],
-            &m_out[(ni + 1) * m_npts - 1] + 1, dout_last.begin());
+            amrex::Gpu::hostToDevice, ninst_out, ninst_out + m_npts,
+            dout_last.begin());
         // Reset current output device vector
-        const auto coorddir = m_coorddir;
         amrex::ParallelFor(m_npts, [=] AMREX_GPU_DEVICE(int n) {
-            dout_ptr[n] = plo0[coorddir];
+            dout_ptr[n] = plo_dir;
         });
     }
+    m_has_heights = true;
 
     return true;
 }
@@ -751,13 +919,14 @@ void FreeSurfaceSampler::post_regrid_actions()
         const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> phi =
             geom.ProbHiArray();
 #ifdef AMREX_USE_OMP
-#pragma omp parallel if (false)
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
 #endif
-        for (amrex::MFIter mfi(floc(lev)); mfi.isValid(); ++mfi) {
+        for (amrex::MFIter mfi(floc(lev), amrex::TilingIfNotGPU());
+             mfi.isValid(); ++mfi) {
             auto loc_arr = floc(lev).array(mfi);
             auto idx_arr = fidx(lev).array(mfi);
             auto mask_arr = level_mask.const_array(mfi);
-            const auto& vbx = mfi.validbox();
+            const auto& vbx = mfi.tilebox();
             amrex::ParallelFor(
                 vbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
                     // Cell location
@@ -849,6 +1018,7 @@ void FreeSurfaceSampler::post_regrid_actions()
                 });
         }
     }
+    update_search_columns();
 }
 
 #ifdef AMR_WIND_USE_NETCDF
@@ -25,7 +25,7 @@ void KineticEnergy::initialize()
     prepare_ascii_file();
 }
 
-amrex::Real KineticEnergy::calculate_kinetic_energy()
+amrex::Real KineticEnergy::calculate_kinetic_energy(const bool local)
 {
     BL_PROFILE("amr-wind::KineticEnergy::calculate_kinetic_energy");
 
@@ -80,7 +80,9 @@ amrex::Real KineticEnergy::calculate_kinetic_energy()
 
     Kinetic_energy *= 0.5 / total_vol;
 
-    amrex::ParallelDescriptor::ReduceRealSum(Kinetic_energy);
+    if (!local) {
+        amrex::ParallelDescriptor::ReduceRealSum(Kinetic_energy);
+    }
 
     return Kinetic_energy;
 }
@@ -89,11 +91,22 @@ void KineticEnergy::output_actions()
 {
     BL_PROFILE("amr-wind::KineticEnergy::output_actions");
 
-    m_total_kinetic_energy = calculate_kinetic_energy();
+    update_global_reductions();
 
     write_ascii();
 }
 
+void KineticEnergy::add_local_reductions(GlobalReductions& reductions)
+{
+    m_reduction_idx = reductions.add_sum(calculate_kinetic_energy(true));
+}
+
+void KineticEnergy::apply_global_reductions(
+    const GlobalReductions& reductions)
+{
+    m_total_kinetic_energy = reductions.sum(m_reduction_idx);
+}
+
 void KineticEnergy::prepare_ascii_file()
 {
     BL_PROFILE("amr-wind::KineticEnergy::prepare_ascii_file");
@@ -0,0 +1,375 @@
+#include "amr-wind/utilities/sampling/LidarBeams.H"
+#include "amr-wind/utilities/IOManager.H"
+#include "amr-wind/utilities/linear_interpolation.H"
+#include "amr-wind/utilities/trig_ops.H"
+
+#include <AMReX_MultiFabUtil.H>
+#include <limits>
+#include <utility>
+#include "AMReX_ParmParse.H"
+
+namespace amr_wind::sampling {
+
+LidarBeams::LidarBeams(CFDSim& sim, std::string label)
+    : m_sim(sim), m_label(std::move(label))
+{}
+
+LidarBeams::~LidarBeams() = default;
+
+void LidarBeams::initialize()
+{
+    BL_PROFILE("amr-wind::LidarBeams::initialize");
+
+    {
+        amrex::ParmParse pp(m_label);
+        populate_output_parameters(pp);
+        pp.getarr("labels", m_names);
+    }
+
+    m_velocity = &m_sim.repo().get_field("velocity");
+    if (m_velocity->num_grow()[0] < 1) {
+        amrex::Abort(
+            "LidarBeams: velocity field requires at least one ghost cell");
+    }
+
+    const int nlidars = static_cast<int>(m_names.size());
+    m_origins.resize(nlidars);
+    m_time_tables.resize(nlidars);
+    m_azimuth_tables.resize(nlidars);
+    m_elevation_tables.resize(nlidars);
+    m_periodic.resize(nlidars, 0);
+    m_lengths.resize(nlidars);
+    m_num_gates.resize(nlidars);
+    m_points_per_gate.resize(nlidars, 1);
+    m_cone_angles.resize(nlidars, 0.0);
+    m_num_cone_rays.resize(nlidars, 0);
+    m_azimuth.resize(nlidars, 0.0);
+    m_elevation.resize(nlidars, 0.0);
+    m_gate_offsets.resize(nlidars + 1, 0);
+
+    for (int il = 0; il < nlidars; ++il) {
+        const std::string key = m_label + "." + m_names[il];
+        amrex::ParmParse pp(key);
+
+        amrex::Vector<amrex::Real> origin;
+        pp.getarr("origin", origin);
+        AMREX_ALWAYS_ASSERT(static_cast<int>(origin.size()) == AMREX_SPACEDIM);
+        m_origins[il] = vs::Vector(origin[0], origin[1], origin[2]);
+
+        pp.get("length", m_lengths[il]);
+        pp.get("num_gates", m_num_gates[il]);
+        pp.query("points_per_gate", m_points_per_gate[il]);
+        pp.query("cone_angle", m_cone_angles[il]);
+        pp.query("num_cone_rays", m_num_cone_rays[il]);
+        pp.getarr("time_table", m_time_tables[il]);
+        pp.getarr("azimuth_table", m_azimuth_tables[il]);
+        pp.getarr("elevation_table", m_elevation_tables[il]);
+        pp.query("periodic", m_periodic[il]);
+
+        const auto np = m_time_tables[il].size();
+        if ((m_azimuth_tables[il].size() != np) ||
+            (m_elevation_tables[il].size() != np)) {
+            amrex::Abort(
+                "LidarBeams: azimuth_table and elevation_table must have the "
+                "same number of entries as time_table for " +
+                key);
+        }
+        if ((m_num_gates[il] < 1) || (m_points_per_gate[il] < 1) ||
+            (m_num_cone_rays[il] < 0)) {
+            amrex::Abort(
+                "LidarBeams: num_gates and points_per_gate must be positive "
+                "and num_cone_rays must not be negative for " +
+                key);
+        }
+
+        m_gate_offsets[il + 1] = m_gate_offsets[il] + m_num_gates[il];
+    }
+
+    const int ngates = m_gate_offsets[nlidars];
+    m_los.resize(ngates, 0.0);
+    m_sum_idx.resize(ngates, -1);
+    m_count_idx.resize(ngates, -1);
+
+    update_level_masks();
+    prepare_ascii_file();
+}
+
+void LidarBeams::post_regrid_actions() { update_level_masks(); }
+
+void LidarBeams::update_level_masks()
+{
+    const auto& mesh = m_sim.mesh();
+    const int nlevels = m_sim.repo().num_active_levels();
+    m_level_masks.clear();
+    m_level_masks.resize(nlevels);
+    for (int lev = 0; lev < nlevels; ++lev) {
+        if (lev < nlevels - 1) {
+            m_level_masks[lev] = makeFineMask(
+                mesh.boxArray(lev), mesh.DistributionMap(lev),
+                mesh.boxArray(lev + 1), mesh.refRatio(lev), 1, 0);
+        } else {
+            m_level_masks[lev].define(
+                mesh.boxArray(lev), mesh.DistributionMap(lev), 1, 0,
+                amrex::MFInfo());
+            m_level_masks[lev].setVal(1);
+        }
+    }
+}
+
+void LidarBeams::update_rays()
+{
+    // Output is performed at the end of the time step, use the time the
+    // samples are stamped with
+    const amrex::Real time = m_sim.time().new_time();
+
+    m_rays.clear();
+    for (int il = 0; il < static_cast<int>(m_names.size()); ++il) {
+        const auto& ttable = m_time_tables[il];
+        amrex::Real ltime = time;
+        if (m_periodic[il] != 0) {
+            ltime = std::fmod(time, ttable.back() - ttable.front());
+        }
+        m_azimuth[il] =
+            ::amr_wind::interp::linear(ttable, m_azimuth_tables[il], ltime);
+        m_elevation[il] =
+            ::amr_wind::interp::linear(ttable, m_elevation_tables[il], ltime);
+
+        // Same convention as LidarSampler: the elevation is measured from the
+        // horizontal plane
+        const amrex::Real azi = utils::radians(m_azimuth[il]);
+        const amrex::Real ele = utils::radians(90.0 - m_elevation[il]);
+        const vs::Vector axis(
+            std::cos(azi) * std::sin(ele), std::sin(azi) * std::sin(ele),
+            std::cos(ele));
+
+        LidarRay ray;
+        ray.origin = m_origins[il];
+        ray.length = m_lengths[il];
+        ray.points_per_gate = m_points_per_gate[il];
+        ray.num_samples = m_num_gates[il] * m_points_per_gate[il];
+        ray.gate_offset = m_gate_offsets[il];
+
+        const int ncone = m_num_cone_rays[il];
+        if (ncone == 0) {
+            ray.dir = axis;
+            m_rays.push_back(ray);
+            continue;
+        }
+
+        // Rays evenly distributed on a cone around the beam axis
+        const vs::Vector ref = (std::abs(axis.z()) < 0.9)
+                                   ? vs::Vector::khat()
+                                   : vs::Vector::ihat();
+        const vs::Vector e1 = (axis ^ ref).unit();
+        const vs::Vector e2 = axis ^ e1;
+        const amrex::Real cone = utils::radians(m_cone_angles[il]);
+        for (int ir = 0; ir < ncone; ++ir) {
+            const amrex::Real phi = 2.0 * utils::pi() * ir / ncone;
+            ray.dir = std::cos(cone) * axis +
+                      std::sin(cone) *
+                          (std::cos(phi) * e1 + std::sin(phi) * e2);
+            m_rays.push_back(ray);
+        }
+    }
+
+    m_rays_d.resize(m_rays.size());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, m_rays.begin(), m_rays.end(),
+        m_rays_d.begin());
+}
+
+void LidarBeams::add_local_reductions(GlobalReductions& reductions)
+{
+    BL_PROFILE("amr-wind::LidarBeams::add_local_reductions");
+
+    update_rays();
+
+    const int ngates = static_cast<int>(m_los.size());
+    const int nrays = static_cast<int>(m_rays.size());
+    amrex::Gpu::DeviceVector<amrex::Real> sums_d(ngates, 0.0);
+    amrex::Gpu::DeviceVector<amrex::Real> counts_d(ngates, 0.0);
+    auto* gsum = sums_d.data();
+    auto* gcount = counts_d.data();
+    const auto* rays = m_rays_d.data();
+
+    const auto& vel_fld = *m_velocity;
+    const int nlevels = m_sim.repo().num_active_levels();
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto& geom = m_sim.mesh().Geom(lev);
+        const auto problo = geom.ProbLoArray();
+        const auto dx = geom.CellSizeArray();
+        const auto dxinv = geom.InvCellSizeArray();
+
+        for (amrex::MFIter mfi(vel_fld(lev)); mfi.isValid(); ++mfi) {
+            const auto& bx = mfi.validbox();
+            const auto& vel = vel_fld(lev).const_array(mfi);
+            const auto& mask = m_level_masks[lev].const_array(mfi);
+            const auto blo = amrex::lbound(bx);
+            const auto bhi = amrex::ubound(bx);
+            const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> xlo = {
+                problo[0] + blo.x * dx[0], problo[1] + blo.y * dx[1],
+                problo[2] + blo.z * dx[2]};
+            const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> xhi = {
+                problo[0] + (bhi.x + 1) * dx[0],
+                problo[1] + (bhi.y + 1) * dx[1],
+                problo[2] + (bhi.z + 1) * dx[2]};
+
+            amrex::ParallelFor(nrays, [=] AMREX_GPU_DEVICE(int ir) noexcept {
+                const auto& ray = rays[ir];
+
+                // Portion of the ray within this box
+                amrex::Real t0 = 0.0;
+                amrex::Real t1 = ray.length;
+                for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                    if (ray.dir[d] == 0.0) {
+                        if ((ray.origin[d] < xlo[d]) ||
+                            (ray.origin[d] > xhi[d])) {
+                            return;
+                        }
+                    } else {
+                        const amrex::Real ta =
+                            (xlo[d] - ray.origin[d]) / ray.dir[d];
+                        const amrex::Real tb =
+                            (xhi[d] - ray.origin[d]) / ray.dir[d];
+                        t0 = amrex::max(t0, amrex::min(ta, tb));
+                        t1 = amrex::min(t1, amrex::max(ta, tb));
+                    }
+                }
+                if (t0 > t1) {
+                    return;
+                }
+
+                // Samples close to the box faces are tested against the box
+                // below, so that each sample is owned by exactly one cell
+                const amrex::Real ds = ray.length / ray.num_samples;
+                const int s0 = amrex::max(
+                    0, static_cast<int>(std::floor(t0 / ds - 0.5)));
+                const int s1 = amrex::min(
+                    ray.num_samples - 1,
+                    static_cast<int>(std::ceil(t1 / ds - 0.5)));
+                for (int s = s0; s <= s1; ++s) {
+                    const vs::Vector pt =
+                        ray.origin + ((s + 0.5) * ds) * ray.dir;
+
+                    amrex::IntVect cell;
+                    amrex::IntVect idx;
+                    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> wt;
+                    for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                        const amrex::Real xi = (pt[d] - problo[d]) * dxinv[d];
+                        cell[d] = static_cast<int>(std::floor(xi));
+                        idx[d] = static_cast<int>(std::floor(xi - 0.5));
+                        wt[d] = xi - 0.5 - idx[d];
+                    }
+                    if (!bx.contains(cell) ||
+                        (mask(cell[0], cell[1], cell[2]) == 0)) {
+                        continue;
+                    }
+
+                    // Trilinear interpolation of the velocity projected on
+                    // the ray
+                    const int i = idx[0];
+                    const int j = idx[1];
+                    const int k = idx[2];
+                    amrex::Real los = 0.0;
+                    for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+                        const amrex::Real val =
+                            (1.0 - wt[0]) * (1.0 - wt[1]) * (1.0 - wt[2]) *
+                                vel(i, j, k, n) +
+                            wt[0] * (1.0 - wt[1]) * (1.0 - wt[2]) *
+                                vel(i + 1, j, k, n) +
+                            (1.0 - wt[0]) * wt[1] * (1.0 - wt[2]) *
+                                vel(i, j + 1, k, n) +
+                            wt[0] * wt[1] * (1.0 - wt[2]) *
+                                vel(i + 1, j + 1, k, n) +
+                            (1.0 - wt[0]) * (1.0 - wt[1]) * wt[2] *
+                                vel(i, j, k + 1, n) +
+                            wt[0] * (1.0 - wt[1]) * wt[2] *
+                                vel(i + 1, j, k + 1, n) +
+                            (1.0 - wt[0]) * wt[1] * wt[2] *
+                                vel(i, j + 1, k + 1, n) +
+                            wt[0] * wt[1] * wt[2] * vel(i + 1, j + 1, k + 1, n);
+                        los += val * ray.dir[n];
+                    }
+
+                    const int gate = ray.gate_offset + s / ray.points_per_gate;
+                    amrex::Gpu::Atomic::AddNoRet(&gsum[gate], los);
+                    amrex::Gpu::Atomic::AddNoRet(&gcount[gate], 1.0);
+                }
+            });
+        }
+    }
+
+    amrex::Vector<amrex::Real> sums(ngates);
+    amrex::Vector<amrex::Real> counts(ngates);
+    amrex::Gpu::copy(
+        amrex::Gpu::deviceToHost, sums_d.begin(), sums_d.end(), sums.begin());
+    amrex::Gpu::copy(
+        amrex::Gpu::deviceToHost, counts_d.begin(), counts_d.end(),
+        counts.begin());
+
+    for (int ig = 0; ig < ngates; ++ig) {
+        m_sum_idx[ig] = reductions.add_sum(sums[ig]);
+        m_count_idx[ig] = reductions.add_sum(counts[ig]);
+    }
+}
+
+void LidarBeams::apply_global_reductions(const GlobalReductions& reductions)
+{
+    for (int ig = 0; ig < static_cast<int>(m_los.size()); ++ig) {
+        const amrex::Real count = reductions.sum(m_count_idx[ig]);
+        // Gates entirely outside the domain have no samples
+        m_los[ig] = (count > 0.0)
+                        ? reductions.sum(m_sum_idx[ig]) / count
+                        : std::numeric_limits<amrex::Real>::quiet_NaN();
+    }
+}
+
+void LidarBeams::output_actions()
+{
+    BL_PROFILE("amr-wind::LidarBeams::output_actions");
+
+    update_global_reductions();
+    write_ascii();
+}
+
+void LidarBeams::prepare_ascii_file()
+{
+    BL_PROFILE("amr-wind::LidarBeams::prepare_ascii_file");
+
+    const std::string post_dir = m_sim.io_manager().post_processing_directory();
+    const std::string sname =
+        amrex::Concatenate(m_label, m_sim.time().time_index());
+
+    m_out_fname = post_dir + "/" + sname + ".txt";
+
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        std::ofstream f(m_out_fname.c_str());
+        f << "time_step time lidar azimuth elevation los_velocity"
+          << std::endl;
+        f.close();
+    }
+}
+
+void LidarBeams::write_ascii()
+{
+    BL_PROFILE("amr-wind::LidarBeams::write_ascii");
+
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        std::ofstream f(m_out_fname.c_str(), std::ios_base::app);
+        for (int il = 0; il < static_cast<int>(m_names.size()); ++il) {
+            f << m_sim.time().time_index() << std::scientific
+              << std::setprecision(m_precision) << std::setw(m_width)
+              << m_sim.time().new_time() << ' ' << m_names[il];
+            f << std::setw(m_width) << m_azimuth[il] << std::setw(m_width)
+              << m_elevation[il];
+            for (int ig = m_gate_offsets[il]; ig < m_gate_offsets[il + 1];
+                 ++ig) {
+                f << std::setw(m_width) << m_los[ig];
+            }
+            f << std::endl;
+        }
+        f.close();
+    }
+}
+
+} // namespace amr_wind::sampling
@@ -12,7 +12,7 @@ namespace amr_wind::sampling {
 
 Sampling::Sampling(CFDSim& sim, std::string label)
     : m_sim(sim)
-    , m_derived_mgr(new DerivedQtyMgr(m_sim.repo()))
+    , m_derived_mgr(new DerivedQtyMgr(m_sim.repo(), &m_sim.derived_cache()))
     , m_label(std::move(label))
 {}
 
@@ -48,6 +48,7 @@ void Sampling::initialize()
         pp.queryarr("derived_fields", derived_field_names);
         pp.query("output_format", m_out_fmt);
         pp.query("restart_sample", m_restart_sample);
+        pp.query("output_stage_size", m_stage_size);
         populate_output_parameters(pp);
     }
 
@@ -128,6 +129,28 @@ void Sampling::initialize()
     }
 #endif
 
+    if (m_stage_size > 0) {
+        const bool can_stage =
+            (m_out_fmt == "netcdf") &&
+            std::all_of(
+                m_samplers.begin(), m_samplers.end(),
+                [](const auto& obj) { return obj->allow_output_staging(); });
+        if (can_stage) {
+            const amrex::Real stage_mb =
+                static_cast<amrex::Real>(m_stage_size) * m_total_particles *
+                m_var_names.size() * sizeof(double) / (1024.0 * 1024.0);
+            amrex::Print() << "Sampling " << m_label << ": staging up to "
+                           << m_stage_size << " outputs (" << stage_mb
+                           << " MB) in memory" << std::endl;
+        } else {
+            amrex::Print()
+                << "WARNING: Sampling: output staging requires NetCDF output "
+                   "and samplers that only output the sampled values; "
+                << m_label << " will be written at every output" << std::endl;
+            m_stage_size = 0;
+        }
+    }
+
     if (m_restart_sample) {
         sampling_workflow();
         sampling_post();
@@ -180,6 +203,16 @@ void Sampling::output_actions()
 {
     BL_PROFILE("amr-wind::Sampling::output_actions");
 
+    if (m_stage_size > 0) {
+        // Only the interpolation is performed on this step, the output
+        // buffers are assembled and written when the staged outputs are
+        // flushed
+        interpolate_samples();
+        stage_samples();
+        sampling_post();
+        return;
+    }
+
     sampling_workflow();
 
     process_output();
@@ -192,6 +225,17 @@ void Sampling::sampling_workflow()
 
     BL_PROFILE("amr-wind::Sampling::sampling_workflow");
 
+    interpolate_samples();
+
+    convert_velocity_lineofsight();
+
+    create_output_buffer();
+}
+
+void Sampling::interpolate_samples()
+{
+    BL_PROFILE("amr-wind::Sampling::interpolate_samples");
+
     update_sampling_locations();
 
     m_scontainer->interpolate_fields(m_fields, 0);
@@ -202,10 +246,40 @@ void Sampling::sampling_workflow()
         *m_derived_mgr, m_sim.repo(), m_ncomp + m_nicomp);
 
     fill_buffer();
+}
 
-    convert_velocity_lineofsight();
+void Sampling::stage_samples()
+{
+    BL_PROFILE("amr-wind::Sampling::stage_samples");
 
-    create_output_buffer();
+#ifdef AMR_WIND_USE_NETCDF
+    // The samples are only gathered on the I/O processor
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        m_staged_buf.insert(
+            m_staged_buf.end(), m_sample_buf.begin(), m_sample_buf.end());
+    }
+#endif
+    m_staged_times.push_back(m_sim.time().new_time());
+
+    if (num_staged_outputs() >= m_stage_size) {
+        flush_output();
+    }
+}
+
+void Sampling::flush_output()
+{
+    BL_PROFILE("amr-wind::Sampling::flush_output");
+
+    if (m_staged_times.empty()) {
+        return;
+    }
+
+    write_staged_netcdf();
+
+    m_staged_times.clear();
+#ifdef AMR_WIND_USE_NETCDF
+    m_staged_buf.clear();
+#endif
 }
 
 void Sampling::sampling_post()
@@ -613,4 +687,42 @@ void Sampling::write_netcdf()
 #endif
 }
 
+void Sampling::write_staged_netcdf()
+{
+#ifdef AMR_WIND_USE_NETCDF
+    if (!amrex::ParallelDescriptor::IOProcessor()) {
+        return;
+    }
+    auto ncf = ncutils::NCFile::open(m_ncfile_name, NC_WRITE);
+    const std::string nt_name = "num_time_steps";
+    // Index of the first staged timestep
+    const size_t nt = ncf.dim(nt_name).len();
+    const size_t nstaged = m_staged_times.size();
+    ncf.var("time").put(m_staged_times.data(), {nt}, {nstaged});
+
+    // Each staged output holds all the variables of all the samplers. Gather
+    // the samples of a variable for a sampler from all the staged outputs so
+    // that they are written in order with a single call
+    const size_t npart = m_total_particles;
+    const size_t nvars = m_var_names.size();
+    std::vector<double> buf;
+    for (size_t iv = 0; iv < nvars; ++iv) {
+        size_t offset = iv * npart;
+        for (const auto& obj : m_samplers) {
+            const auto npts = static_cast<size_t>(obj->num_output_points());
+            buf.resize(nstaged * npts);
+            for (size_t it = 0; it < nstaged; ++it) {
+                const double* src = &m_staged_buf[it * nvars * npart + offset];
+                std::copy(src, src + npts, &buf[it * npts]);
+            }
+            auto grp = ncf.group(obj->label());
+            grp.var(m_var_names[iv]).put(buf.data(), {nt, 0}, {nstaged, npts});
+            offset += npts;
+        }
+    }
+
+    ncf.close();
+#endif
+}
+
 } // namespace amr_wind::sampling
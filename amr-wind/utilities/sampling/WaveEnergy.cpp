@@ -44,7 +44,7 @@ void WaveEnergy::initialize()
     prepare_ascii_file();
 }
 
-amrex::Real WaveEnergy::calculate_kinetic_energy()
+amrex::Real WaveEnergy::calculate_kinetic_energy(const bool local)
 {
     BL_PROFILE("amr-wind::WaveEnergy::calculate_kinetic_energy");
 
@@ -95,12 +95,14 @@ amrex::Real WaveEnergy::calculate_kinetic_energy()
             });
     }
 
-    amrex::ParallelDescriptor::ReduceRealSum(wave_ke);
+    if (!local) {
+        amrex::ParallelDescriptor::ReduceRealSum(wave_ke);
+    }
 
     return wave_ke;
 }
 
-amrex::Real WaveEnergy::calculate_potential_energy()
+amrex::Real WaveEnergy::calculate_potential_energy(const bool local)
 {
     BL_PROFILE("amr-wind::WaveEnergy::calculate_potential_energy");
 
@@ -159,7 +161,9 @@ amrex::Real WaveEnergy::calculate_potential_energy()
             });
     }
 
-    amrex::ParallelDescriptor::ReduceRealSum(wave_pe);
+    if (!local) {
+        amrex::ParallelDescriptor::ReduceRealSum(wave_pe);
+    }
 
     return wave_pe;
 }
@@ -168,12 +172,23 @@ void WaveEnergy::output_actions()
 {
     BL_PROFILE("amr-wind::WaveEnergy::output_actions");
 
-    m_wave_kinetic_energy = calculate_kinetic_energy() / m_escl;
-    m_wave_potential_energy = calculate_potential_energy() / m_escl + m_pe_off;
+    update_global_reductions();
 
     write_ascii();
 }
 
+void WaveEnergy::add_local_reductions(GlobalReductions& reductions)
+{
+    m_ke_idx = reductions.add_sum(calculate_kinetic_energy(true));
+    m_pe_idx = reductions.add_sum(calculate_potential_energy(true));
+}
+
+void WaveEnergy::apply_global_reductions(const GlobalReductions& reductions)
+{
+    m_wave_kinetic_energy = reductions.sum(m_ke_idx) / m_escl;
+    m_wave_potential_energy = reductions.sum(m_pe_idx) / m_escl + m_pe_off;
+}
+
 void WaveEnergy::prepare_ascii_file()
 {
     BL_PROFILE("amr-wind::WaveEnergy::prepare_ascii_file");
@@ -8,6 +8,10 @@
 #include "amr-wind/utilities/constants.H"
 #include <AMReX_PlotFileUtil.H>
 
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+
 namespace amr_wind {
 
 namespace {
@@ -39,6 +43,254 @@ AMREX_FORCE_INLINE std::string level_name(int lev)
 }
 #endif
 
+//! Identifier written at the start of the indexed boundary plane files
+constexpr std::int64_t indexed_magic = 0x424c4241;
+//! Version of the indexed boundary plane file layout
+constexpr std::int64_t indexed_version = 2;
+//! Number of 64-bit integers in the header of the indexed files
+constexpr int indexed_header_size = 12;
+//! Size of a time index record (time step and time)
+constexpr std::streamoff indexed_time_record =
+    sizeof(std::int64_t) + sizeof(double);
+
+using IndexedHeader = amrex::Array<std::int64_t, indexed_header_size>;
+//! Physical lower corner and cell sizes of the plane box of the indexed files
+using IndexedGeom = amrex::Array<double, 2 * AMREX_SPACEDIM>;
+
+//! Offset of the first record in the indexed files
+constexpr std::streamoff indexed_data_start =
+    sizeof(IndexedHeader) + sizeof(IndexedGeom);
+
+//! Box of the face data stored just outside the boundary
+amrex::Box plane_box(const amrex::Box& minBox, const amrex::Orientation ori)
+{
+    amrex::IntVect plo(minBox.loVect());
+    amrex::IntVect phi(minBox.hiVect());
+    const int normal = ori.coordDir();
+    plo[normal] = ori.isHigh() ? minBox.hiVect()[normal] + 1 : -1;
+    phi[normal] = ori.isHigh() ? minBox.hiVect()[normal] + 1 : -1;
+    return {plo, phi};
+}
+
+//! True if the data box covers the plane box in the directions of the plane
+bool covers_plane(
+    const amrex::Box& data, const amrex::Box& plane, const int normal)
+{
+    for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+        if ((dir != normal) && ((data.smallEnd(dir) > plane.smallEnd(dir)) ||
+                                (data.bigEnd(dir) < plane.bigEnd(dir)))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** Shift from the plane box of this mesh to a window of stored face data
+ *
+ *  The window `wbx` starts at the physical coordinates `win_lo` and has the
+ *  cell sizes `win_dx` in the directions of the face. The plane box `pbx`
+ *  must lie on the cells of the window and be covered by it, the indices of
+ *  the window are the indices of the plane box plus the returned shift.
+ */
+amrex::IntVect window_shift(
+    const amrex::Geometry& geom,
+    const amrex::Box& pbx,
+    const amrex::Orientation ori,
+    const amrex::Box& wbx,
+    const amrex::Array<amrex::Real, AMREX_SPACEDIM>& win_lo,
+    const amrex::Array<amrex::Real, AMREX_SPACEDIM>& win_dx,
+    const std::string& what)
+{
+    const int normal = ori.coordDir();
+    amrex::IntVect shift(0);
+    shift[normal] = wbx.smallEnd(normal) - pbx.smallEnd(normal);
+    for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+        if (dir == normal) {
+            continue;
+        }
+        const amrex::Real dx = geom.CellSize(dir);
+        if (std::abs(win_dx[dir] - dx) > constants::LOOSE_TOL * dx) {
+            amrex::Abort(
+                "ABLBoundaryPlane: the boundary data of " + what +
+                " does not have the cell size of the mesh");
+        }
+        const amrex::Real xlo =
+            geom.ProbLo(dir) +
+            (pbx.smallEnd(dir) - geom.Domain().smallEnd(dir)) * dx;
+        const amrex::Real ncells = (xlo - win_lo[dir]) / dx;
+        const int icells = static_cast<int>(std::round(ncells));
+        if (std::abs(ncells - icells) > constants::LOOSE_TOL) {
+            amrex::Abort(
+                "ABLBoundaryPlane: the boundary data of " + what +
+                " is not aligned with the cells of the mesh");
+        }
+        shift[dir] = wbx.smallEnd(dir) + icells - pbx.smallEnd(dir);
+    }
+
+    if (!covers_plane(wbx, amrex::Box(pbx).shift(shift), normal)) {
+        amrex::Abort(
+            "ABLBoundaryPlane: the boundary data of " + what +
+            " does not cover the boundary");
+    }
+    return shift;
+}
+
+template <typename T>
+void write_values(std::ostream& os, const amrex::Vector<amrex::Real>& data)
+{
+    const std::vector<T> buf(data.begin(), data.end());
+    os.write(
+        reinterpret_cast<const char*>(buf.data()),
+        static_cast<std::streamsize>(buf.size() * sizeof(T)));
+}
+
+template <typename T>
+void read_values(std::istream& is, amrex::Vector<amrex::Real>& data)
+{
+    std::vector<T> buf(data.size());
+    is.read(
+        reinterpret_cast<char*>(buf.data()),
+        static_cast<std::streamsize>(buf.size() * sizeof(T)));
+    std::copy(buf.begin(), buf.end(), data.begin());
+}
+
+/** Write a record of face data to an indexed boundary plane file
+ *
+ *  The file is created, with its header, when the first record is written.
+ *  Records have a fixed size, so record `irec` starts at a known offset.
+ */
+void write_indexed_record(
+    const std::string& fname,
+    const amrex::Geometry& geom,
+    const amrex::Box& pbx,
+    const amrex::Orientation ori,
+    const int ncomp,
+    const int nbytes,
+    const size_t irec,
+    const amrex::Vector<amrex::Real>& data)
+{
+    std::fstream fs;
+    if (irec == 0) {
+        fs.open(fname, std::ios::out | std::ios::binary | std::ios::trunc);
+        // magic, version, bytes per value, components, plane box,
+        // normal direction and side, followed by the physical lower corner
+        // and the cell sizes of the plane box
+        IndexedHeader hdr{indexed_magic, indexed_version, nbytes, ncomp};
+        IndexedGeom pgeom{};
+        for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+            hdr[4 + dir] = pbx.smallEnd(dir);
+            hdr[7 + dir] = pbx.bigEnd(dir);
+            pgeom[dir] = geom.ProbLo(dir) +
+                         (pbx.smallEnd(dir) - geom.Domain().smallEnd(dir)) *
+                             geom.CellSize(dir);
+            pgeom[AMREX_SPACEDIM + dir] = geom.CellSize(dir);
+        }
+        hdr[10] = ori.coordDir();
+        hdr[11] = ori.isHigh() ? 1 : 0;
+        fs.write(reinterpret_cast<const char*>(hdr.data()), sizeof(hdr));
+        fs.write(reinterpret_cast<const char*>(pgeom.data()), sizeof(pgeom));
+    } else {
+        fs.open(fname, std::ios::in | std::ios::out | std::ios::binary);
+    }
+    if (!fs.good()) {
+        amrex::FileOpenFailed(fname);
+    }
+
+    const auto rec_bytes = static_cast<std::streamoff>(data.size() * nbytes);
+    fs.seekp(
+        indexed_data_start + static_cast<std::streamoff>(irec) * rec_bytes);
+    if (nbytes == static_cast<int>(sizeof(float))) {
+        write_values<float>(fs, data);
+    } else {
+        write_values<double>(fs, data);
+    }
+    if (!fs.good()) {
+        amrex::Abort("ABLBoundaryPlane: unable to write to " + fname);
+    }
+}
+
+/** Read two consecutive records of an indexed boundary plane file
+ *
+ *  Only the requested records are read, the size of the file does not
+ *  matter. The file may hold a window of the face that is larger than the
+ *  plane box, only the data within the plane box is returned. The window is
+ *  located from its physical coordinates, so the mesh reading the file may
+ *  have a different origin than the mesh that wrote it.
+ */
+void read_indexed_records(
+    const std::string& fname,
+    const int irec,
+    const amrex::Geometry& geom,
+    const amrex::Orientation ori,
+    const amrex::Box& pbx,
+    const int ncomp,
+    amrex::Vector<amrex::Real>& data_n,
+    amrex::Vector<amrex::Real>& data_np1)
+{
+    std::ifstream ifs(fname, std::ios::in | std::ios::binary);
+    if (!ifs.good()) {
+        amrex::FileOpenFailed(fname);
+    }
+
+    IndexedHeader hdr{};
+    IndexedGeom pgeom{};
+    ifs.read(reinterpret_cast<char*>(hdr.data()), sizeof(hdr));
+    ifs.read(reinterpret_cast<char*>(pgeom.data()), sizeof(pgeom));
+    if (!ifs.good() || (hdr[0] != indexed_magic) ||
+        (hdr[1] != indexed_version)) {
+        amrex::Abort(
+            "ABLBoundaryPlane: invalid indexed boundary plane file " + fname);
+    }
+
+    const auto nbytes = static_cast<int>(hdr[2]);
+    amrex::IntVect flo;
+    amrex::IntVect fhi;
+    amrex::Array<amrex::Real, AMREX_SPACEDIM> win_lo{};
+    amrex::Array<amrex::Real, AMREX_SPACEDIM> win_dx{};
+    for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+        flo[dir] = static_cast<int>(hdr[4 + dir]);
+        fhi[dir] = static_cast<int>(hdr[7 + dir]);
+        win_lo[dir] = pgeom[dir];
+        win_dx[dir] = pgeom[AMREX_SPACEDIM + dir];
+    }
+    const amrex::Box fbx(flo, fhi);
+    if ((hdr[3] != ncomp) || (hdr[10] != ori.coordDir())) {
+        amrex::Abort(
+            "ABLBoundaryPlane: the face data in " + fname +
+            " does not match the boundary variables");
+    }
+    const amrex::IntVect shift =
+        window_shift(geom, pbx, ori, fbx, win_lo, win_dx, fname);
+
+    const auto nvals = fbx.numPts() * ncomp;
+    amrex::Vector<amrex::Real> buf_n(nvals);
+    amrex::Vector<amrex::Real> buf_np1(nvals);
+    const auto rec_bytes = static_cast<std::streamoff>(nvals * nbytes);
+    ifs.seekg(
+        indexed_data_start + static_cast<std::streamoff>(irec) * rec_bytes);
+    if (nbytes == static_cast<int>(sizeof(float))) {
+        read_values<float>(ifs, buf_n);
+        read_values<float>(ifs, buf_np1);
+    } else {
+        read_values<double>(ifs, buf_n);
+        read_values<double>(ifs, buf_np1);
+    }
+    if (!ifs.good()) {
+        amrex::Abort(
+            "ABLBoundaryPlane: unable to read records " +
+            std::to_string(irec) + " and " + std::to_string(irec + 1) +
+            " from " + fname);
+    }
+
+    const amrex::FArrayBox fab_n(fbx, ncomp, buf_n.data());
+    const amrex::FArrayBox fab_np1(fbx, ncomp, buf_np1.data());
+    amrex::FArrayBox out_n(pbx, ncomp, data_n.data());
+    amrex::FArrayBox out_np1(pbx, ncomp, data_np1.data());
+    const amrex::Box src_bx = amrex::Box(pbx).shift(shift);
+    out_n.copy<amrex::RunOn::Host>(fab_n, src_bx, 0, pbx, 0, ncomp);
+    out_np1.copy<amrex::RunOn::Host>(fab_np1, src_bx, 0, pbx, 0, ncomp);
+}
+
 } // namespace
 
 void InletData::resize(const int size)
@@ -73,7 +325,8 @@ void InletData::read_data(
     const int lev,
     const Field* fld,
     const amrex::Real time,
-    const amrex::Vector<amrex::Real>& times)
+    const amrex::Vector<amrex::Real>& times,
+    const amrex::IntVect& shift)
 {
     const size_t nc = fld->num_comp();
     const int nstart = m_components[static_cast<int>(fld->id())];
@@ -108,10 +361,14 @@ void InletData::read_data(
     const size_t n0 = bx.length(perp[0]);
     const size_t n1 = bx.length(perp[1]);
 
+    // The file may hold a window of the face that is larger than the plane
+    // of this mesh, the shift maps the plane into the window (and was checked
+    // to keep it within the window when the header was read)
+    const auto off0 = static_cast<size_t>(lo[perp[0]] + shift[perp[0]]);
+    const auto off1 = static_cast<size_t>(lo[perp[1]] + shift[perp[1]]);
+
     // start counting at zero because of netcdf indexing
-    amrex::Vector<size_t> start{
-        static_cast<size_t>(idx), static_cast<size_t>(0),
-        static_cast<size_t>(0), 0};
+    amrex::Vector<size_t> start{static_cast<size_t>(idx), off0, off1, 0};
     amrex::Vector<size_t> count{1, n0, n1, nc};
     amrex::Vector<amrex::Real> buffer(n0 * n1 * nc);
     grp.var(fld->name()).get(buffer.data(), start, count);
@@ -162,7 +419,8 @@ void InletData::read_data_native(
     const int lev,
     const Field* fld,
     const amrex::Real time,
-    const amrex::Vector<amrex::Real>& times)
+    const amrex::Vector<amrex::Real>& times,
+    const amrex::IntVect& shift)
 {
     const size_t nc = fld->num_comp();
     const int nstart =
@@ -200,10 +458,15 @@ void InletData::read_data_native(
     const int normal = ori.coordDir();
     const auto& bbx = (*m_data_n[ori])[lev].box();
     const amrex::IntVect v_offset = offset(ori.faceDir(), normal);
+    const amrex::IntVect s_offset = shift + v_offset;
 
+    // The boundary data is in the index space of the mesh that wrote it,
+    // shift it to the index space of this mesh
+    amrex::BoxArray bndry_ba(bndry_n[ori].boxArray());
+    bndry_ba.shift(-shift);
     amrex::MultiFab bndry(
-        bndry_n[ori].boxArray(), bndry_n[ori].DistributionMap(),
-        bndry_n[ori].nComp(), 0, amrex::MFInfo());
+        bndry_ba, bndry_n[ori].DistributionMap(), bndry_n[ori].nComp(), 0,
+        amrex::MFInfo());
 
 #ifdef AMREX_USE_OMP
 #pragma omp parallel if (false)
@@ -223,9 +486,9 @@ void InletData::read_data_native(
             bx, nc, [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
                 bndry_arr(i, j, k, n) =
                     0.5 *
-                    (bndry_n_arr(i, j, k, n) +
+                    (bndry_n_arr(i + shift[0], j + shift[1], k + shift[2], n) +
                      bndry_n_arr(
-                         i + v_offset[0], j + v_offset[1], k + v_offset[2], n));
+                         i + s_offset[0], j + s_offset[1], k + s_offset[2], n));
             });
     }
 
@@ -247,16 +510,41 @@ void InletData::read_data_native(
         amrex::ParallelFor(
             bx, nc, [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
                 bndry_arr(i, j, k, n) =
-                    0.5 *
-                    (bndry_np1_arr(i, j, k, n) +
-                     bndry_np1_arr(
-                         i + v_offset[0], j + v_offset[1], k + v_offset[2], n));
+                    0.5 * (bndry_np1_arr(
+                               i + shift[0], j + shift[1], k + shift[2], n) +
+                           bndry_np1_arr(
+                               i + s_offset[0], j + s_offset[1],
+                               k + s_offset[2], n));
             });
     }
 
     bndry.copyTo((*m_data_np1[ori])[lev], 0, nstart, static_cast<int>(nc));
 }
 
+void InletData::read_data_indexed(
+    const amrex::Orientation ori,
+    const int lev,
+    const amrex::Vector<amrex::Real>& data_n,
+    const amrex::Vector<amrex::Real>& data_np1,
+    const amrex::Real tn,
+    const amrex::Real tnp1)
+{
+    m_tn = tn;
+    m_tnp1 = tnp1;
+
+    auto& datn = (*m_data_n[ori])[lev];
+    auto& datnp1 = (*m_data_np1[ori])[lev];
+    AMREX_ALWAYS_ASSERT(static_cast<amrex::Long>(data_n.size()) == datn.size());
+    AMREX_ALWAYS_ASSERT(
+        static_cast<amrex::Long>(data_np1.size()) == datnp1.size());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, data_n.begin(), data_n.end(),
+        datn.dataPtr());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, data_np1.begin(), data_np1.end(),
+        datnp1.dataPtr());
+}
+
 void InletData::interpolate(const amrex::Real time)
 {
     m_tinterp = time;
@@ -327,15 +615,48 @@ ABLBoundaryPlane::ABLBoundaryPlane(CFDSim& sim)
 #endif
 
     if (!((m_out_fmt == "native") || (m_out_fmt == "netcdf") ||
-          (m_out_fmt == "erf-multiblock"))) {
+          (m_out_fmt == "erf-multiblock") || (m_out_fmt == "indexed"))) {
         amrex::Print() << "Warning: boundary output format not recognized, "
                           "changing to native format"
                        << std::endl;
         m_out_fmt = "native";
     }
 
-    // only used for native format
-    m_time_file = m_filename + "/time.dat";
+    std::string out_precision = "double";
+    pp.query("bndry_output_precision", out_precision);
+    if (out_precision == "float") {
+        m_out_value_bytes = static_cast<int>(sizeof(float));
+    } else if (out_precision != "double") {
+        amrex::Abort(
+            "ABLBoundaryPlane: bndry_output_precision must be double or "
+            "float");
+    }
+
+    // Optional output window and variables of each face
+    const auto& geom = m_mesh.Geom(0);
+    for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
+        const auto ori = oit();
+        amrex::ParmParse ppf("ABL.bndry_output." + m_plane_names[ori]);
+        amrex::Vector<amrex::Real> lo(
+            geom.ProbLo(), geom.ProbLo() + AMREX_SPACEDIM);
+        amrex::Vector<amrex::Real> hi(
+            geom.ProbHi(), geom.ProbHi() + AMREX_SPACEDIM);
+        const bool has_lo = (ppf.queryarr("lo", lo, 0, AMREX_SPACEDIM) != 0);
+        const bool has_hi = (ppf.queryarr("hi", hi, 0, AMREX_SPACEDIM) != 0);
+        m_has_window[ori] = has_lo || has_hi;
+        m_out_windows[ori] = amrex::RealBox(lo.data(), hi.data());
+        ppf.queryarr("var_names", m_out_var_names[ori]);
+
+        if ((m_out_fmt == "indexed") && (!m_out_var_names[ori].empty())) {
+            amrex::Abort(
+                "ABLBoundaryPlane: selecting the variables of a face is not "
+                "supported by the indexed format");
+        }
+    }
+
+    // only used for native and indexed formats
+    m_time_file = (m_out_fmt == "indexed") ? m_filename + "/time_index.bin"
+                                           : m_filename + "/time.dat";
 }
 
 void ABLBoundaryPlane::post_init_actions()
@@ -403,6 +724,18 @@ void ABLBoundaryPlane::write_header()
         return;
     }
 
+    for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
+        auto ori = oit();
+        const std::string plane = m_plane_names[ori];
+        if ((std::find(m_planes.begin(), m_planes.end(), plane) !=
+             m_planes.end()) &&
+            (!output_box(0, ori).ok())) {
+            amrex::Abort(
+                "ABLBoundaryPlane: the output window of " + plane +
+                " does not intersect the boundary");
+        }
+    }
+
 #ifdef AMR_WIND_USE_NETCDF
 
     if (m_out_fmt == "netcdf") {
@@ -454,10 +787,16 @@ void ABLBoundaryPlane::write_header()
                     break;
                 }
 
+                // Finer levels outside the output window are not output
+                const amrex::Box obox = output_box(lev, ori);
+                if (!obox.ok()) {
+                    break;
+                }
+
                 auto lev_grp = plane_grp.def_group(level_name(lev));
-                lev_grp.def_dim("nx", minBox.length(0));
-                lev_grp.def_dim("ny", minBox.length(1));
-                lev_grp.def_dim("nz", minBox.length(2));
+                lev_grp.def_dim("nx", obox.length(0));
+                lev_grp.def_dim("ny", obox.length(1));
+                lev_grp.def_dim("nz", obox.length(2));
 
                 lev_grp.def_var("lengths", NC_DOUBLE, {"pdim"});
                 lev_grp.def_var("lo", NC_DOUBLE, {"pdim"});
@@ -466,6 +805,9 @@ void ABLBoundaryPlane::write_header()
 
                 const amrex::Vector<std::string> dirs{"nx", "ny", "nz"};
                 for (auto* fld : m_fields) {
+                    if (!output_field(ori, *fld)) {
+                        continue;
+                    }
                     const std::string name = fld->name();
                     if (fld->num_comp() == 1) {
                         lev_grp.def_var(
@@ -480,32 +822,40 @@ void ABLBoundaryPlane::write_header()
             }
         }
         ncf.put_attr("title", m_title);
+        ncf.put_attr("write_frequency", std::vector<int>{m_write_frequency});
         ncf.exit_def_mode();
 
         // Populate coordinates
         for (auto& plane_grp : ncf.all_groups()) {
-            int normal;
+            int normal, face_dir;
             plane_grp.var("normal").get(&normal);
+            plane_grp.var("side").get(&face_dir);
             const amrex::GpuArray<int, 2> perp =
                 utils::perpendicular_idx(normal);
+            const amrex::Orientation ori(
+                normal, amrex::Orientation::Side(face_dir));
 
             const int nlevels = plane_grp.num_groups();
             for (int lev = 0; lev < nlevels; ++lev) {
                 auto lev_grp = plane_grp.group(level_name(lev));
 
+                // The window is stored in physical coordinates so that it
+                // can be read by a mesh with a different origin
                 const auto& dx = m_mesh.Geom(lev).CellSizeArray();
-                const amrex::Box& minBox = m_mesh.boxArray(lev).minimalBox();
-                const auto& lo = minBox.loVect();
-                const auto& hi = minBox.hiVect();
+                const auto& plo = m_mesh.Geom(lev).ProbLoArray();
+                const amrex::Box obox = output_box(lev, ori);
+                const auto& lo = obox.loVect();
+                const auto& hi = obox.hiVect();
                 const amrex::Vector<amrex::Real> pdx{dx[perp[0]], dx[perp[1]]};
                 const amrex::Vector<amrex::Real> los{
-                    lo[perp[0]] * dx[perp[0]], lo[perp[1]] * dx[perp[1]]};
+                    plo[perp[0]] + lo[perp[0]] * dx[perp[0]],
+                    plo[perp[1]] + lo[perp[1]] * dx[perp[1]]};
                 const amrex::Vector<amrex::Real> his{
-                    (hi[perp[0]] + 1) * dx[perp[0]],
-                    (hi[perp[1]] + 1) * dx[perp[1]]};
+                    plo[perp[0]] + (hi[perp[0]] + 1) * dx[perp[0]],
+                    plo[perp[1]] + (hi[perp[1]] + 1) * dx[perp[1]]};
                 const amrex::Vector<amrex::Real> lengths{
-                    minBox.length(perp[0]) * dx[perp[0]],
-                    minBox.length(perp[1]) * dx[perp[1]]};
+                    obox.length(perp[0]) * dx[perp[0]],
+                    obox.length(perp[1]) * dx[perp[1]]};
 
                 lev_grp.var("lengths").put(lengths.data());
                 lev_grp.var("lo").put(los.data());
@@ -526,6 +876,17 @@ void ABLBoundaryPlane::write_header()
         std::ofstream oftime(m_time_file, std::ios::out);
         oftime.close();
     }
+
+    if (m_out_fmt == "indexed") {
+        if (amrex::ParallelDescriptor::IOProcessor()) {
+            amrex::UtilCreateCleanDirectory(m_filename, false);
+            std::ofstream oftime(
+                m_time_file, std::ios::out | std::ios::binary);
+            oftime.close();
+        }
+        amrex::ParallelDescriptor::Barrier();
+        m_out_records = 0;
+    }
 }
 
 void ABLBoundaryPlane::write_bndry_native_header(const std::string& chkname)
@@ -552,8 +913,9 @@ void ABLBoundaryPlane::write_bndry_native_header(const std::string& chkname)
                 auto ori = oit();
                 const std::string plane = m_plane_names[ori];
 
-                if (std::find(m_planes.begin(), m_planes.end(), plane) ==
-                    m_planes.end()) {
+                if ((std::find(m_planes.begin(), m_planes.end(), plane) ==
+                     m_planes.end()) ||
+                    (!output_field(ori, field))) {
                     continue;
                 }
 
@@ -596,7 +958,11 @@ void ABLBoundaryPlane::write_bndry_native_header(const std::string& chkname)
                         bndry_prob.setHi(normal, phi + m_out_rad * dx[normal]);
                     }
                     bndry_geoms[lev] = amrex::Geometry(bndry_dom, &bndry_prob);
-                    amrex::Box minBox = m_mesh.boxArray(lev).minimalBox();
+                    // Levels outside the output window hold no face data
+                    amrex::Box minBox = output_box(lev, ori);
+                    if (!minBox.ok()) {
+                        minBox = m_mesh.boxArray(lev).minimalBox();
+                    }
                     if (ori.isLow()) {
                         minBox.setSmall(normal, bndry_dom.smallEnd(normal));
                     } else {
@@ -659,6 +1025,9 @@ void ABLBoundaryPlane::write_file()
 
             const int nlevels = ncf.group(plane).num_groups();
             for (auto* fld : m_fields) {
+                if (!output_field(ori, *fld)) {
+                    continue;
+                }
                 for (int lev = 0; lev < nlevels; ++lev) {
                     auto grp = ncf.group(plane).group(level_name(lev));
                     write_data(grp, ori, lev, fld);
@@ -696,22 +1065,6 @@ void ABLBoundaryPlane::write_file()
 
                 const auto& geom = field.repo().mesh().Geom();
 
-                // note: by using one box we end up using 1
-                // processor to hold all boundaries
-                const amrex::Box& minBox = m_mesh.boxArray(lev).minimalBox();
-                amrex::BoxArray ba(minBox);
-                amrex::DistributionMapping dm{ba};
-
-                amrex::BndryRegister bndry(
-                    ba, dm, m_in_rad, m_out_rad, m_extent_rad,
-                    field.num_comp());
-
-                bndry.setVal(1.0e13);
-
-                bndry.copyFrom(
-                    field(lev), 0, 0, 0, field.num_comp(),
-                    geom[lev].periodicity());
-
                 std::string filename = amrex::MultiFabFileFullPrefix(
                     lev, chkname, level_prefix, field.name());
 
@@ -720,10 +1073,33 @@ void ABLBoundaryPlane::write_file()
                     auto ori = oit();
                     const std::string plane = m_plane_names[ori];
 
-                    if (std::find(m_planes.begin(), m_planes.end(), plane) ==
-                        m_planes.end()) {
+                    if ((std::find(m_planes.begin(), m_planes.end(), plane) ==
+                         m_planes.end()) ||
+                        (!output_field(ori, field))) {
+                        continue;
+                    }
+
+                    // note: by using one box we end up using 1
+                    // processor to hold the face, which is restricted to its
+                    // output window
+                    const amrex::Box obox = output_box(lev, ori);
+                    if (!obox.ok()) {
                         continue;
                     }
+                    amrex::BoxArray ba(obox);
+                    amrex::DistributionMapping dm{ba};
+
+                    amrex::BndryRegister bndry;
+                    bndry.setBoxes(ba);
+                    bndry.define(
+                        ori, amrex::IndexType::TheCellType(), m_in_rad,
+                        m_out_rad, m_extent_rad, field.num_comp(), dm);
+
+                    bndry[ori].setVal(1.0e13);
+
+                    bndry[ori].copyFrom(
+                        field(lev), 0, 0, 0, field.num_comp(),
+                        geom[lev].periodicity());
 
                     std::string facename =
                         amrex::Concatenate(filename + '_', ori, 1);
@@ -732,6 +1108,107 @@ void ABLBoundaryPlane::write_file()
             }
         }
     }
+
+    if (m_out_fmt == "indexed") {
+        write_indexed_file();
+    }
+}
+
+void ABLBoundaryPlane::write_indexed_file()
+{
+    BL_PROFILE("amr-wind::ABLBoundaryPlane::write_indexed_file");
+    const amrex::Real time = m_time.new_time();
+    const int t_step = m_time.time_index();
+
+    amrex::Print() << "Writing ABL boundary plane records to " << m_filename
+                   << " at time " << time << std::endl;
+
+    int nc = 0;
+    for (auto* fld : m_fields) {
+        nc += fld->num_comp();
+    }
+
+    const int nlevels = m_repo.num_active_levels();
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const amrex::Box& minBox = m_mesh.boxArray(lev).minimalBox();
+        const auto& geom = m_mesh.Geom(lev);
+
+        for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
+            auto ori = oit();
+            const std::string plane = m_plane_names[ori];
+
+            if ((std::find(m_planes.begin(), m_planes.end(), plane) ==
+                 m_planes.end()) ||
+                (!box_intersects_boundary(minBox, lev, ori))) {
+                continue;
+            }
+
+            const amrex::Box obox = output_box(lev, ori);
+            if (!obox.ok()) {
+                continue;
+            }
+
+            // Gather the ghost cells and the adjacent interior cells of the
+            // face on one rank
+            const int normal = ori.coordDir();
+            const amrex::Box pbx = plane_box(obox, ori);
+            amrex::Box sbx(pbx);
+            if (ori.isLow()) {
+                sbx.growHi(normal, 1);
+            } else {
+                sbx.growLo(normal, 1);
+            }
+            const amrex::BoxArray ba(sbx);
+            const amrex::DistributionMapping dm{ba};
+            amrex::MultiFab layers(ba, dm, nc, 0);
+
+            int icomp = 0;
+            for (auto* fld : m_fields) {
+                layers.ParallelCopy(
+                    (*fld)(lev), 0, icomp, fld->num_comp(), fld->num_grow(),
+                    amrex::IntVect(0), geom.periodicity());
+                icomp += fld->num_comp();
+            }
+
+            const amrex::IntVect v_offset = offset(ori.faceDir(), normal);
+            for (amrex::MFIter mfi(layers); mfi.isValid(); ++mfi) {
+                const auto& larr = layers.const_array(mfi);
+                amrex::FArrayBox face(pbx, nc, amrex::The_Async_Arena());
+                const auto& farr = face.array();
+                amrex::ParallelFor(
+                    pbx, nc,
+                    [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+                        farr(i, j, k, n) =
+                            0.5 * (larr(i, j, k, n) +
+                                   larr(
+                                       i + v_offset[0], j + v_offset[1],
+                                       k + v_offset[2], n));
+                    });
+
+                amrex::Vector<amrex::Real> data(face.size());
+                amrex::Gpu::copy(
+                    amrex::Gpu::deviceToHost, face.dataPtr(),
+                    face.dataPtr() + face.size(), data.begin());
+                write_indexed_record(
+                    indexed_file_name(ori, lev), geom, pbx, ori, nc,
+                    m_out_value_bytes, m_out_records, data);
+            }
+        }
+    }
+
+    // The time index is updated once all the face data has been written so
+    // that readers never see a record that is not complete
+    amrex::ParallelDescriptor::Barrier();
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        std::ofstream oftime(
+            m_time_file, std::ios::out | std::ios::app | std::ios::binary);
+        const auto step = static_cast<std::int64_t>(t_step);
+        const auto dtime = static_cast<double>(time);
+        oftime.write(reinterpret_cast<const char*>(&step), sizeof(step));
+        oftime.write(reinterpret_cast<const char*>(&dtime), sizeof(dtime));
+        oftime.close();
+    }
+    m_out_records++;
 }
 
 void ABLBoundaryPlane::read_header()
@@ -780,41 +1257,38 @@ void ABLBoundaryPlane::read_header()
                 normal, amrex::Orientation::Side(face_dir));
 
             m_in_data.define_plane(ori);
+            m_in_shifts[ori].clear();
 
             const int nlevels = plane_grp.num_groups();
             for (int lev = 0; lev < nlevels; ++lev) {
                 auto lev_grp = plane_grp.group(level_name(lev));
 
-                // sanity checks to ensure grid-to-grid matching
                 const amrex::Box& minBox = m_mesh.boxArray(lev).minimalBox();
-                const auto& lo = minBox.loVect();
-                const auto& hi = minBox.hiVect();
-                const auto& dx = m_mesh.Geom(lev).CellSizeArray();
-                const amrex::Vector<amrex::Real> pdx{dx[perp[0]], dx[perp[1]]};
-                const amrex::Vector<amrex::Real> los{
-                    lo[perp[0]] * pdx[0], lo[perp[1]] * pdx[1]};
-                const amrex::Vector<amrex::Real> his{
-                    (hi[perp[0]] + 1) * pdx[0], (hi[perp[1]] + 1) * pdx[1]};
-                const amrex::Vector<amrex::Real> lengths{
-                    minBox.length(perp[0]) * pdx[0],
-                    minBox.length(perp[1]) * pdx[1]};
-
-                amrex::Vector<amrex::Real> nc_dat{0, 0};
-                lev_grp.var("lengths").get(nc_dat.data());
-                AMREX_ALWAYS_ASSERT(nc_dat == lengths);
-                lev_grp.var("lo").get(nc_dat.data());
-                AMREX_ALWAYS_ASSERT(nc_dat == los);
-                lev_grp.var("hi").get(nc_dat.data());
-                AMREX_ALWAYS_ASSERT(nc_dat == his);
-                lev_grp.var("dx").get(nc_dat.data());
-                AMREX_ALWAYS_ASSERT(nc_dat == pdx);
+                const amrex::Box pbx = plane_box(minBox, ori);
+
+                // The file may only hold a window of the face, which is
+                // located from its physical coordinates and must cover the
+                // face of this mesh
+                amrex::Vector<amrex::Real> nc_lo{0, 0};
+                amrex::Vector<amrex::Real> nc_dx{0, 0};
+                lev_grp.var("lo").get(nc_lo.data());
+                lev_grp.var("dx").get(nc_dx.data());
+                const amrex::Vector<std::string> dirs{"nx", "ny", "nz"};
+                amrex::Box wbx(pbx);
+                amrex::Array<amrex::Real, AMREX_SPACEDIM> win_lo{};
+                amrex::Array<amrex::Real, AMREX_SPACEDIM> win_dx{};
+                for (int i = 0; i < 2; ++i) {
+                    const auto len = lev_grp.dim(dirs[perp[i]]).len();
+                    wbx.setSmall(perp[i], 0);
+                    wbx.setBig(perp[i], static_cast<int>(len) - 1);
+                    win_lo[perp[i]] = nc_lo[i];
+                    win_dx[perp[i]] = nc_dx[i];
+                }
+                m_in_shifts[ori].push_back(window_shift(
+                    m_mesh.Geom(lev), pbx, ori, wbx, win_lo, win_dx,
+                    m_plane_names[ori] + " on level " + std::to_string(lev)));
 
                 // Create the data structures for the input data
-                amrex::IntVect plo(lo);
-                amrex::IntVect phi(hi);
-                plo[normal] = ori.isHigh() ? hi[normal] + 1 : -1;
-                phi[normal] = ori.isHigh() ? hi[normal] + 1 : -1;
-                const amrex::Box pbx(plo, phi);
                 size_t nc = 0;
                 for (auto* fld : m_fields) {
                     m_in_data.component(static_cast<int>(fld->id())) =
@@ -947,11 +1421,106 @@ void ABLBoundaryPlane::read_header()
             const amrex::Box pbx(plo, phi);
             m_in_data.define_level_data(ori, pbx, nc);
         }
+    } else if (m_out_fmt == "indexed") {
+        read_indexed_header();
+    }
+
+    if ((m_out_fmt != "erf-multiblock") && (m_in_times.size() > 1)) {
+        // The time interpolation of the boundary data is only as accurate as
+        // the spacing of the output times
+        amrex::Real max_interval = 0.0;
+        for (int i = 1; i < static_cast<int>(m_in_times.size()); ++i) {
+            max_interval =
+                amrex::max(max_interval, m_in_times[i] - m_in_times[i - 1]);
+        }
+        amrex::Print() << "ABLBoundaryPlane: " << m_in_times.size()
+                       << " boundary data times, largest interval = "
+                       << max_interval << std::endl;
+    }
+}
+
+void ABLBoundaryPlane::read_indexed_header()
+{
+    BL_PROFILE("amr-wind::ABLBoundaryPlane::read_indexed_header");
+
+    int ntimes = 0;
+    amrex::Vector<double> times;
+    amrex::Vector<std::int64_t> steps;
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        std::ifstream time_file(
+            m_time_file, std::ios::in | std::ios::binary | std::ios::ate);
+        if (!time_file.good()) {
+            amrex::Abort("Cannot find time file: " + m_time_file);
+        }
+        ntimes = static_cast<int>(time_file.tellg() / indexed_time_record);
+        time_file.seekg(0);
+
+        times.resize(ntimes);
+        steps.resize(ntimes);
+        for (int i = 0; i < ntimes; ++i) {
+            time_file.read(
+                reinterpret_cast<char*>(&steps[i]), sizeof(std::int64_t));
+            time_file.read(reinterpret_cast<char*>(&times[i]), sizeof(double));
+        }
+        time_file.close();
+    }
+
+    amrex::ParallelDescriptor::Bcast(
+        &ntimes, 1, amrex::ParallelDescriptor::IOProcessorNumber(),
+        amrex::ParallelDescriptor::Communicator());
+
+    m_in_times.resize(ntimes);
+    m_in_timesteps.resize(ntimes);
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        std::copy(times.begin(), times.end(), m_in_times.begin());
+        std::copy(steps.begin(), steps.end(), m_in_timesteps.begin());
+    }
+
+    amrex::ParallelDescriptor::Bcast(
+        m_in_timesteps.data(), ntimes,
+        amrex::ParallelDescriptor::IOProcessorNumber(),
+        amrex::ParallelDescriptor::Communicator());
+
+    amrex::ParallelDescriptor::Bcast(
+        m_in_times.data(), ntimes,
+        amrex::ParallelDescriptor::IOProcessorNumber(),
+        amrex::ParallelDescriptor::Communicator());
+
+    int nc = 0;
+    for (auto* fld : m_fields) {
+        m_in_data.component(static_cast<int>(fld->id())) = nc;
+        nc += fld->num_comp();
+    }
+
+    for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
+        auto ori = oit();
+
+        if (std::all_of(
+                m_fields.begin(), m_fields.end(), [ori](const auto* fld) {
+                    return (
+                        (fld->bc_type()[ori] != BC::mass_inflow) &&
+                        (fld->bc_type()[ori] != BC::mass_inflow_outflow));
+                })) {
+            continue;
+        }
+
+        m_in_data.define_plane(ori);
+
+        for (int lev = 0; lev < m_repo.num_active_levels(); ++lev) {
+            if (!amrex::FileExists(indexed_file_name(ori, lev))) {
+                break;
+            }
+            const amrex::Box& minBox = m_mesh.boxArray(lev).minimalBox();
+            m_in_data.define_level_data(ori, plane_box(minBox, ori), nc);
+        }
     }
 }
 
 amrex::Vector<amrex::BoxArray> ABLBoundaryPlane::read_bndry_native_boxarrays(
-    const std::string& chkname, const Field& field) const
+    const std::string& chkname,
+    const Field& field,
+    const amrex::Orientation face,
+    amrex::Vector<amrex::IntVect>& shifts) const
 {
     BL_PROFILE("amr-wind::ABLBoundaryPlane::read_bndry_native_boxarrays");
     AMREX_ALWAYS_ASSERT(m_io_mode == io_mode::input);
@@ -964,14 +1533,16 @@ amrex::Vector<amrex::BoxArray> ABLBoundaryPlane::read_bndry_native_boxarrays(
 
     const int max_bndry_levels = boundary_native_file_levels();
     amrex::Vector<amrex::BoxArray> bndry_bas(max_bndry_levels);
+    shifts.assign(max_bndry_levels, amrex::IntVect(0));
 
     // Check if there are any header files
     bool hdr_exists = false;
     for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
         auto ori = oit();
 
-        if ((field.bc_type()[ori] != BC::mass_inflow) &&
-            (field.bc_type()[ori] != BC::mass_inflow_outflow)) {
+        if ((ori != face) ||
+            ((field.bc_type()[ori] != BC::mass_inflow) &&
+             (field.bc_type()[ori] != BC::mass_inflow_outflow))) {
             continue;
         }
 
@@ -996,8 +1567,9 @@ amrex::Vector<amrex::BoxArray> ABLBoundaryPlane::read_bndry_native_boxarrays(
     for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
         auto ori = oit();
 
-        if ((field.bc_type()[ori] != BC::mass_inflow) &&
-            (field.bc_type()[ori] != BC::mass_inflow_outflow)) {
+        if ((ori != face) ||
+            ((field.bc_type()[ori] != BC::mass_inflow) &&
+             (field.bc_type()[ori] != BC::mass_inflow_outflow))) {
             continue;
         }
 
@@ -1052,19 +1624,6 @@ amrex::Vector<amrex::BoxArray> ABLBoundaryPlane::read_bndry_native_boxarrays(
         }
 
         const int normal = ori.coordDir();
-        const amrex::GpuArray<int, 2> perp = utils::perpendicular_idx(normal);
-        AMREX_ALWAYS_ASSERT(
-            constants::is_close(
-                prob_lo[perp[0]], m_mesh.Geom(0).ProbLo(perp[0])));
-        AMREX_ALWAYS_ASSERT(
-            constants::is_close(
-                prob_lo[perp[1]], m_mesh.Geom(0).ProbLo(perp[1])));
-        AMREX_ALWAYS_ASSERT(
-            constants::is_close(
-                prob_hi[perp[0]], m_mesh.Geom(0).ProbHi(perp[0])));
-        AMREX_ALWAYS_ASSERT(
-            constants::is_close(
-                prob_hi[perp[1]], m_mesh.Geom(0).ProbHi(perp[1])));
 
         amrex::Vector<int> ref_ratio;
         ref_ratio.resize(nlevels, 0);
@@ -1076,18 +1635,6 @@ amrex::Vector<amrex::BoxArray> ABLBoundaryPlane::read_bndry_native_boxarrays(
         amrex::Vector<amrex::Box> prob_domain(nlevels);
         for (int i = 0; i < nlevels; ++i) {
             is >> prob_domain[i];
-            AMREX_ALWAYS_ASSERT(
-                prob_domain[i].smallEnd(perp[0]) ==
-                m_mesh.Geom(i).Domain().smallEnd(perp[0]));
-            AMREX_ALWAYS_ASSERT(
-                prob_domain[i].smallEnd(perp[1]) ==
-                m_mesh.Geom(i).Domain().smallEnd(perp[1]));
-            AMREX_ALWAYS_ASSERT(
-                prob_domain[i].bigEnd(perp[0]) ==
-                m_mesh.Geom(i).Domain().bigEnd(perp[0]));
-            AMREX_ALWAYS_ASSERT(
-                prob_domain[i].bigEnd(perp[1]) ==
-                m_mesh.Geom(i).Domain().bigEnd(perp[1]));
         }
 
         amrex::Vector<int> level_steps(nlevels);
@@ -1134,6 +1681,22 @@ amrex::Vector<amrex::BoxArray> ABLBoundaryPlane::read_bndry_native_boxarrays(
             }
             AMREX_ALWAYS_ASSERT(ba.size() == 1);
             bndry_boxes[ilev].push_back(ba[0]);
+
+            // The boundary data may be a window of the face of a mesh with
+            // a different origin, locate it from its physical coordinates
+            const amrex::Box wbx = plane_box(ba[0], ori);
+            amrex::Array<amrex::Real, AMREX_SPACEDIM> win_lo{};
+            for (int idim = 0; idim < spacedim; ++idim) {
+                win_lo[idim] = prob_lo[idim] +
+                               (wbx.smallEnd(idim) -
+                                prob_domain[ilev].smallEnd(idim)) *
+                                   cell_size[ilev][idim];
+            }
+            shifts[ilev] = window_shift(
+                m_mesh.Geom(ilev),
+                plane_box(m_mesh.boxArray(ilev).minimalBox(), ori), ori, wbx,
+                win_lo, cell_size[ilev],
+                m_plane_names[ori] + " on level " + std::to_string(ilev));
         }
     }
 
@@ -1207,7 +1770,22 @@ void ABLBoundaryPlane::read_file(const bool nph_target_time)
             for (auto* fld : m_fields) {
                 for (int lev = 0; lev < nlevels; ++lev) {
                     auto grp = ncf.group(plane).group(level_name(lev));
-                    m_in_data.read_data(grp, ori, lev, fld, time, m_in_times);
+
+                    // Only the variables required by the boundary
+                    // conditions must have been output on this face
+                    if (!grp.has_var(fld->name())) {
+                        if ((fld->bc_type()[ori] == BC::mass_inflow) ||
+                            (fld->bc_type()[ori] ==
+                             BC::mass_inflow_outflow)) {
+                            amrex::Abort(
+                                "ABLBoundaryPlane: " + fld->name() +
+                                " was not output on " + plane);
+                        }
+                        continue;
+                    }
+                    m_in_data.read_data(
+                        grp, ori, lev, fld, time, m_in_times,
+                        m_in_shifts[ori][lev]);
                 }
             }
         }
@@ -1251,57 +1829,123 @@ void ABLBoundaryPlane::read_file(const bool nph_target_time)
         const std::string level_prefix = "Level_";
 
         const int nlevels = boundary_native_file_levels();
-        const auto bndry_bas =
-            read_bndry_native_boxarrays(chkname1, *(m_fields[0]));
-        for (int lev = 0; lev < nlevels; ++lev) {
-            for (auto* fld : m_fields) {
-                auto& field = *fld;
-
-                const auto& ba = bndry_bas[lev];
-                amrex::DistributionMapping dm{ba};
-
-                amrex::BndryRegister bndry1(
-                    ba, dm, m_in_rad, m_out_rad, m_extent_rad,
-                    field.num_comp());
-                amrex::BndryRegister bndry2(
-                    ba, dm, m_in_rad, m_out_rad, m_extent_rad,
-                    field.num_comp());
-
-                bndry1.setVal(1.0e13);
-                bndry2.setVal(1.0e13);
+        for (auto* fld : m_fields) {
+            auto& field = *fld;
 
-                std::string filename1 = amrex::MultiFabFileFullPrefix(
-                    lev, chkname1, level_prefix, field.name());
-                std::string filename2 = amrex::MultiFabFileFullPrefix(
-                    lev, chkname2, level_prefix, field.name());
+            for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
+                auto ori = oit();
 
-                for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
-                    auto ori = oit();
+                if ((!m_in_data.is_populated(ori)) ||
+                    ((field.bc_type()[ori] != BC::mass_inflow) &&
+                     (field.bc_type()[ori] != BC::mass_inflow_outflow))) {
+                    continue;
+                }
 
-                    if ((!m_in_data.is_populated(ori)) ||
-                        ((field.bc_type()[ori] != BC::mass_inflow) &&
-                         (field.bc_type()[ori] != BC::mass_inflow_outflow))) {
-                        continue;
-                    }
+                // The faces may have been output on different windows
+                amrex::Vector<amrex::IntVect> shifts;
+                const auto bndry_bas =
+                    read_bndry_native_boxarrays(chkname1, field, ori, shifts);
+                for (int lev = 0; lev < nlevels; ++lev) {
+                    const auto& ba = bndry_bas[lev];
+                    amrex::DistributionMapping dm{ba};
+
+                    amrex::BndryRegister bndry1;
+                    amrex::BndryRegister bndry2;
+                    bndry1.setBoxes(ba);
+                    bndry2.setBoxes(ba);
+                    bndry1.define(
+                        ori, amrex::IndexType::TheCellType(), m_in_rad,
+                        m_out_rad, m_extent_rad, field.num_comp(), dm);
+                    bndry2.define(
+                        ori, amrex::IndexType::TheCellType(), m_in_rad,
+                        m_out_rad, m_extent_rad, field.num_comp(), dm);
+
+                    bndry1[ori].setVal(1.0e13);
+                    bndry2[ori].setVal(1.0e13);
+
+                    std::string filename1 = amrex::MultiFabFileFullPrefix(
+                        lev, chkname1, level_prefix, field.name());
+                    std::string filename2 = amrex::MultiFabFileFullPrefix(
+                        lev, chkname2, level_prefix, field.name());
 
                     std::string facename1 =
                         amrex::Concatenate(filename1 + '_', ori, 1);
                     std::string facename2 =
                         amrex::Concatenate(filename2 + '_', ori, 1);
 
+                    if (!amrex::FileExists(facename1 + "_H")) {
+                        amrex::Abort(
+                            "ABLBoundaryPlane: " + field.name() +
+                            " was not output on " + m_plane_names[ori]);
+                    }
+
                     bndry1[ori].read(facename1);
                     bndry2[ori].read(facename2);
 
                     m_in_data.read_data_native(
-                        oit, bndry1, bndry2, lev, fld, time, m_in_times);
+                        oit, bndry1, bndry2, lev, fld, time, m_in_times,
+                        shifts[lev]);
                 }
             }
         }
     }
 
+    if (m_out_fmt == "indexed") {
+        read_indexed_file(time);
+    }
+
     m_in_data.interpolate(time);
 }
 
+void ABLBoundaryPlane::read_indexed_file(const amrex::Real time)
+{
+    BL_PROFILE("amr-wind::ABLBoundaryPlane::read_indexed_file");
+
+    const int index =
+        utils::closest_index(m_in_times, time, constants::LOOSE_TOL);
+    if (!(m_in_times[index] <= time + constants::LOOSE_TOL) ||
+        !(time <= m_in_times[index + 1] + constants::LOOSE_TOL)) {
+        amrex::Abort(
+            "ABLBoundaryPlane: time " + std::to_string(time) +
+            " is not between the boundary plane times " +
+            std::to_string(m_in_times[index]) + " and " +
+            std::to_string(m_in_times[index + 1]));
+    }
+
+    for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
+        auto ori = oit();
+        if (!m_in_data.is_populated(ori)) {
+            continue;
+        }
+
+        const int nlevels = m_in_data.nlevels(ori);
+        for (int lev = 0; lev < nlevels; ++lev) {
+            const auto& pfab = m_in_data.interpolate_data(ori, lev);
+            amrex::Vector<amrex::Real> data_n(pfab.size());
+            amrex::Vector<amrex::Real> data_np1(pfab.size());
+
+            // Only the two records bracketing the current time are read
+            if (amrex::ParallelDescriptor::IOProcessor()) {
+                read_indexed_records(
+                    indexed_file_name(ori, lev), index, m_mesh.Geom(lev), ori,
+                    pfab.box(), pfab.nComp(), data_n, data_np1);
+            }
+            amrex::ParallelDescriptor::Bcast(
+                data_n.data(), data_n.size(),
+                amrex::ParallelDescriptor::IOProcessorNumber(),
+                amrex::ParallelDescriptor::Communicator());
+            amrex::ParallelDescriptor::Bcast(
+                data_np1.data(), data_np1.size(),
+                amrex::ParallelDescriptor::IOProcessorNumber(),
+                amrex::ParallelDescriptor::Communicator());
+
+            m_in_data.read_data_indexed(
+                ori, lev, data_n, data_np1, m_in_times[index],
+                m_in_times[index + 1]);
+        }
+    }
+}
+
 // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
 void ABLBoundaryPlane::populate_data(
     const int lev,
@@ -1457,6 +2101,22 @@ void ABLBoundaryPlane::write_data(
     }
     amrex::ParallelDescriptor::ReduceIntMin(min_lo.begin(), min_lo.size());
 
+    // Restrict the output to the window of the face, the offsets are then
+    // relative to the window
+    const amrex::Box obox = output_box(lev, ori);
+    if (m_has_window[ori]) {
+        min_lo[perp[0]] = obox.smallEnd(perp[0]);
+        min_lo[perp[1]] = obox.smallEnd(perp[1]);
+    }
+    const auto clip_to_window = [&obox, &perp](
+                                    amrex::IntVect& lo, amrex::IntVect& hi) {
+        for (const int dir : perp) {
+            lo[dir] = amrex::max(lo[dir], obox.smallEnd(dir));
+            hi[dir] = amrex::min(hi[dir], obox.bigEnd(dir));
+        }
+        return (lo[perp[0]] <= hi[perp[0]]) && (lo[perp[1]] <= hi[perp[1]]);
+    };
+
 #ifdef AMREX_USE_OMP
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
 #endif
@@ -1471,6 +2131,9 @@ void ABLBoundaryPlane::write_data(
             amrex::IntVect hi(bhi);
             lo[normal] = dlo[normal];
             hi[normal] = dlo[normal];
+            if (!clip_to_window(lo, hi)) {
+                continue;
+            }
             const amrex::Box lbx(lo, hi);
 
             const size_t n0 = hi[perp[0]] - lo[perp[0]] + 1;
@@ -1496,6 +2159,9 @@ void ABLBoundaryPlane::write_data(
             // shift by one to reuse impl_buffer_field
             lo[normal] = dhi[normal] + 1;
             hi[normal] = dhi[normal] + 1;
+            if (!clip_to_window(lo, hi)) {
+                continue;
+            }
             const amrex::Box lbx(lo, hi);
 
             const size_t n0 = hi[perp[0]] - lo[perp[0]] + 1;
@@ -1562,6 +2228,47 @@ int ABLBoundaryPlane::boundary_native_file_levels() const
     return nlevels;
 }
 
+amrex::Box ABLBoundaryPlane::output_box(
+    const int lev, const amrex::Orientation ori) const
+{
+    amrex::Box bx = m_mesh.boxArray(lev).minimalBox();
+    if (!m_has_window[ori]) {
+        return bx;
+    }
+
+    // Cells overlapping the window in the directions of the face
+    const auto& geom = m_mesh.Geom(lev);
+    const auto& win = m_out_windows[ori];
+    for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+        if (dir == ori.coordDir()) {
+            continue;
+        }
+        const amrex::Real dx = geom.CellSize(dir);
+        const amrex::Real plo = geom.ProbLo(dir);
+        const int ilo = static_cast<int>(std::floor((win.lo(dir) - plo) / dx));
+        const int ihi =
+            static_cast<int>(std::ceil((win.hi(dir) - plo) / dx)) - 1;
+        bx.setSmall(dir, amrex::max(bx.smallEnd(dir), ilo));
+        bx.setBig(dir, amrex::min(bx.bigEnd(dir), ihi));
+    }
+    return bx;
+}
+
+bool ABLBoundaryPlane::output_field(
+    const amrex::Orientation ori, const Field& fld) const
+{
+    const auto& names = m_out_var_names[ori];
+    return names.empty() ||
+           (std::find(names.begin(), names.end(), fld.name()) != names.end());
+}
+
+std::string ABLBoundaryPlane::indexed_file_name(
+    const amrex::Orientation ori, const int lev) const
+{
+    return m_filename + "/" + m_plane_names[ori] + "_level_" +
+           std::to_string(lev) + ".bin";
+}
+
 //! True if box intersects the boundary
 bool ABLBoundaryPlane::box_intersects_boundary(
     const amrex::Box& bx, const int lev, const amrex::Orientation ori) const
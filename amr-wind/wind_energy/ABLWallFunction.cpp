@@ -199,10 +199,12 @@ ABLVelWallFunc::ABLVelWallFunc(
     pp.query("wall_shear_stress_type", m_wall_shear_stress_type);
     pp.query("wall_het_model", m_wall_het_model);
     pp.query("monin_obukhov_length", m_monin_obukhov_length);
+    pp.query("local_mo_iterations", m_local_mo_iters);
     m_wall_shear_stress_type = amrex::toLower(m_wall_shear_stress_type);
 
     if (m_wall_shear_stress_type == "constant" ||
         m_wall_shear_stress_type == "local" ||
+        m_wall_shear_stress_type == "local_mo" ||
         m_wall_shear_stress_type == "schumann" ||
         m_wall_shear_stress_type == "donelan" ||
         m_wall_shear_stress_type == "moeng") {
@@ -325,6 +327,104 @@ void ABLVelWallFunc::wall_model(
     }
 }
 
+void ABLVelWallFunc::local_mo_wall_model(
+    Field& velocity, const FieldState rho_state, const ShearStressLocalMO& tau)
+{
+    BL_PROFILE("amr-wind::ABLVelWallFunc::local_mo");
+
+    constexpr int idim = 2;
+    const auto& repo = velocity.repo();
+    amrex::Orientation zlo(amrex::Direction::z, amrex::Orientation::low);
+    amrex::Orientation zhi(amrex::Direction::z, amrex::Orientation::high);
+    if (velocity.bc_type()[zhi] == BC::wall_model) {
+        amrex::Abort("ABL wall models are not applicable to a zhi BC");
+    }
+    if (velocity.bc_type()[zlo] != BC::wall_model) {
+        return;
+    }
+
+    const auto& density = repo.get_field("density", rho_state);
+    const auto& viscosity = repo.get_field("velocity_mueff");
+    const int nlevels = repo.num_active_levels();
+    const auto& mo = m_wall_func.mo();
+    const bool has_terrain = repo.int_field_exists("terrain_blank");
+    const auto* m_terrain_blank =
+        has_terrain ? &repo.get_int_field("terrain_blank") : nullptr;
+    // Without a temperature field the solve reduces to the neutral log law
+    const bool has_temp = repo.field_exists("temperature");
+    const auto* temperature =
+        has_temp ? &repo.get_field("temperature").state(FieldState::Old)
+                 : nullptr;
+    // Heterogeneous roughness provided by the terrain physics
+    const bool has_z0 = repo.float_field_exists("terrainz0");
+    const auto* terrainz0 =
+        has_z0 ? &repo.get_float_field("terrainz0") : nullptr;
+    const amrex::Real z0_uniform = mo.z0;
+    const amrex::Real theta_ref = mo.theta_mean;
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto& geom = repo.mesh().Geom(lev);
+        const auto& domain = geom.Domain();
+        const amrex::Real z = 0.5 * geom.CellSize(idim);
+        amrex::MFItInfo mfi_info{};
+        const auto& rho_lev = density(lev);
+        const auto& vold_lev = velocity.state(FieldState::Old)(lev);
+        auto& vel_lev = velocity(lev);
+        const auto& eta_lev = viscosity(lev);
+
+        if (amrex::Gpu::notInLaunchRegion()) {
+            mfi_info.SetDynamic(true);
+        }
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+        for (amrex::MFIter mfi(vel_lev, mfi_info); mfi.isValid(); ++mfi) {
+            const auto& bx = mfi.validbox();
+            if (bx.smallEnd(idim) != domain.smallEnd(idim)) {
+                continue;
+            }
+            const auto& varr = vel_lev.array(mfi);
+            const auto& vold_arr = vold_lev.const_array(mfi);
+            const auto& den = rho_lev.const_array(mfi);
+            const auto& eta = eta_lev.const_array(mfi);
+            const auto& blank_arr =
+                has_terrain ? (*m_terrain_blank)(lev).const_array(mfi)
+                            : amrex::Array4<int>();
+            const auto& told_arr = has_temp
+                                       ? (*temperature)(lev).const_array(mfi)
+                                       : amrex::Array4<amrex::Real const>();
+            const auto& z0_arr = has_z0 ? (*terrainz0)(lev).const_array(mfi)
+                                        : amrex::Array4<float const>();
+            amrex::ParallelFor(
+                amrex::bdryLo(bx, idim),
+                [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                    const amrex::Real mu = eta(i, j, k);
+                    const amrex::Real uu = vold_arr(i, j, k, 0);
+                    const amrex::Real vv = vold_arr(i, j, k, 1);
+                    const amrex::Real wspd = std::sqrt(uu * uu + vv * vv);
+                    const amrex::Real theta =
+                        has_temp ? told_arr(i, j, k) : theta_ref;
+                    const amrex::Real z0 =
+                        has_z0 ? z0_arr(i, j, k) : z0_uniform;
+
+                    amrex::Real utau = 0.0;
+                    amrex::Real tflux = 0.0;
+                    tau.solve(z, wspd, theta, z0, utau, tflux);
+                    const amrex::Real fac = utau * utau /
+                                            amrex::max(wspd, tau.small_vel) *
+                                            den(i, j, k) / mu;
+
+                    // Dirichlet BC
+                    varr(i, j, k - 1, 2) = 0.0;
+                    const amrex::Real blankTerrain =
+                        (has_terrain) ? 1 - blank_arr(i, j, k, 0) : 1.0;
+                    // Shear stress BC
+                    varr(i, j, k - 1, 0) = blankTerrain * fac * uu;
+                    varr(i, j, k - 1, 1) = blankTerrain * fac * vv;
+                });
+        }
+    }
+}
+
 void ABLVelWallFunc::operator()(Field& velocity, const FieldState rho_state)
 {
     const auto& mo = m_wall_func.mo();
@@ -353,6 +453,11 @@ void ABLVelWallFunc::operator()(Field& velocity, const FieldState rho_state)
 
         auto tau = ShearStressDonelan(mo);
         wall_model(velocity, rho_state, tau);
+
+    } else if (m_wall_shear_stress_type == "local_mo") {
+
+        auto tau = ShearStressLocalMO(mo, m_local_mo_iters);
+        local_mo_wall_model(velocity, rho_state, tau);
     }
 }
 
@@ -364,6 +469,7 @@ ABLTempWallFunc::ABLTempWallFunc(
     pp.query("wall_shear_stress_type", m_wall_shear_stress_type);
     pp.query("wall_het_model", m_wall_het_model);
     pp.query("monin_obukhov_length", m_monin_obukhov_length);
+    pp.query("local_mo_iterations", m_local_mo_iters);
     m_wall_shear_stress_type = amrex::toLower(m_wall_shear_stress_type);
     amrex::Print() << "Heat Flux model: " << m_wall_shear_stress_type
                    << std::endl;
@@ -477,6 +583,90 @@ void ABLTempWallFunc::wall_model(
     }
 }
 
+void ABLTempWallFunc::local_mo_wall_model(
+    Field& temperature,
+    const FieldState rho_state,
+    const ShearStressLocalMO& tau)
+{
+    constexpr int idim = 2;
+    auto& repo = temperature.repo();
+
+    amrex::Orientation zlo(amrex::Direction::z, amrex::Orientation::low);
+    amrex::Orientation zhi(amrex::Direction::z, amrex::Orientation::high);
+    if (temperature.bc_type()[zhi] == BC::wall_model) {
+        amrex::Abort("ABL wall models are not applicable to a zhi BC");
+    }
+    if (temperature.bc_type()[zlo] != BC::wall_model) {
+        return;
+    }
+
+    BL_PROFILE("amr-wind::ABLTempWallFunc::local_mo");
+    auto& velocity = repo.get_field("velocity");
+    const auto& density = repo.get_field("density", rho_state);
+    const auto& alpha = repo.get_field("temperature_mueff");
+    const int nlevels = repo.num_active_levels();
+    const bool has_terrain = repo.int_field_exists("terrain_blank");
+    const auto* m_terrain_blank =
+        has_terrain ? &repo.get_int_field("terrain_blank") : nullptr;
+    const bool has_z0 = repo.float_field_exists("terrainz0");
+    const auto* terrainz0 =
+        has_z0 ? &repo.get_float_field("terrainz0") : nullptr;
+    const amrex::Real z0_uniform = m_wall_func.mo().z0;
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto& geom = repo.mesh().Geom(lev);
+        const auto& domain = geom.Domain();
+        const amrex::Real z = 0.5 * geom.CellSize(idim);
+        amrex::MFItInfo mfi_info{};
+        const auto& rho_lev = density(lev);
+        const auto& vold_lev = velocity.state(FieldState::Old)(lev);
+        const auto& told_lev = temperature.state(FieldState::Old)(lev);
+        auto& theta = temperature(lev);
+        const auto& eta_lev = alpha(lev);
+
+        if (amrex::Gpu::notInLaunchRegion()) {
+            mfi_info.SetDynamic(true);
+        }
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+        for (amrex::MFIter mfi(theta, mfi_info); mfi.isValid(); ++mfi) {
+            const auto& bx = mfi.validbox();
+            if (bx.smallEnd(idim) != domain.smallEnd(idim)) {
+                continue;
+            }
+            const auto& vold_arr = vold_lev.const_array(mfi);
+            const auto& told_arr = told_lev.const_array(mfi);
+            const auto& tarr = theta.array(mfi);
+            const auto& den = rho_lev.const_array(mfi);
+            const auto& eta = eta_lev.const_array(mfi);
+            const auto& blank_arr =
+                has_terrain ? (*m_terrain_blank)(lev).const_array(mfi)
+                            : amrex::Array4<int>();
+            const auto& z0_arr = has_z0 ? (*terrainz0)(lev).const_array(mfi)
+                                        : amrex::Array4<float const>();
+            amrex::ParallelFor(
+                amrex::bdryLo(bx, idim),
+                [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                    const amrex::Real alphaT = eta(i, j, k);
+                    const amrex::Real uu = vold_arr(i, j, k, 0);
+                    const amrex::Real vv = vold_arr(i, j, k, 1);
+                    const amrex::Real wspd = std::sqrt(uu * uu + vv * vv);
+                    const amrex::Real z0 =
+                        has_z0 ? z0_arr(i, j, k) : z0_uniform;
+
+                    amrex::Real utau = 0.0;
+                    amrex::Real tflux = 0.0;
+                    tau.solve(z, wspd, told_arr(i, j, k), z0, utau, tflux);
+
+                    const amrex::Real blankTerrain =
+                        (has_terrain) ? 1 - blank_arr(i, j, k, 0) : 1.0;
+                    tarr(i, j, k - 1) =
+                        -blankTerrain * den(i, j, k) * tflux / alphaT;
+                });
+        }
+    }
+}
+
 void ABLTempWallFunc::operator()(Field& temperature, const FieldState rho_state)
 {
 
@@ -506,6 +696,11 @@ void ABLTempWallFunc::operator()(Field& temperature, const FieldState rho_state)
 
         auto tau = ShearStressDonelan(mo);
         wall_model(temperature, rho_state, tau);
+
+    } else if (m_wall_shear_stress_type == "local_mo") {
+
+        auto tau = ShearStressLocalMO(mo, m_local_mo_iters);
+        local_mo_wall_model(temperature, rho_state, tau);
     }
 }
 
@@ -146,7 +146,6 @@ void Actuator::pre_advance_work()
 {
     BL_PROFILE("amr-wind::actuator::Actuator::pre_advance_work");
 
-    m_container->reset_container();
     update_positions();
     update_velocities();
     compute_forces();
@@ -23,27 +23,23 @@ ActuatorContainer::ActuatorContainer(
           NumPArrayInt>(&mesh)
     , m_mesh(mesh)
     , m_data(num_objects)
-    , m_proc_pos(amrex::ParallelDescriptor::NProcs(), vs::Vector::zero())
-    , m_pos_device(amrex::ParallelDescriptor::NProcs(), vs::Vector::zero())
     , m_proc_offsets(amrex::ParallelDescriptor::NProcs() + 1, 0)
     , m_proc_offsets_device(amrex::ParallelDescriptor::NProcs() + 1)
 {}
 
 /** Allocate memory and initialize the particles within the container
  *
- *  This method is only called once during the simulation. It allocates the
- *  arrays for holding the position vector and velocity data on host memory and
- *  also initializes corresponding particles within the first available particle
- *  tile within the container. It is expected that the actuator manager instance
- *  has already populated the number of points per turbine before invoking this
- *  method.
+ *  This method is called once after the container is created (during
+ *  initialization and after a regrid). It allocates the arrays for holding the
+ *  position vector and velocity data on host memory and also initializes
+ *  corresponding particles within the first available particle tile within the
+ *  container. It is expected that the actuator manager instance has already
+ *  populated the number of points per turbine before invoking this method.
  */
 void ActuatorContainer::initialize_container()
 {
     BL_PROFILE("amr-wind::actuator::ActuatorContainer::initialize_container");
 
-    compute_local_coordinates();
-
     // Initialize global data arrays
     const int total_pts =
         std::accumulate(m_data.num_pts.begin(), m_data.num_pts.end(), 0);
@@ -71,6 +67,7 @@ void ActuatorContainer::initialize_container()
             amrex::Gpu::hostToDevice, m_proc_offsets.begin(),
             m_proc_offsets.end(), m_proc_offsets_device.begin());
     }
+    m_pos_global.resize(m_proc_offsets.back());
 
     initialize_particles(total_pts);
 }
@@ -119,51 +116,59 @@ void ActuatorContainer::initialize_particles(const int total_pts)
     }
 
     // Indicate that we have initialized the containers and remaining methods
-    // are safe to use
+    // are safe to use. The first position update must scatter the particles
+    // from this rank to the rest of the domain.
     m_container_initialized = true;
     m_is_scattered = false;
-}
-
-void ActuatorContainer::reset_container()
-{
-    const int nlevels = m_mesh.finestLevel() + 1;
-    for (int lev = 0; lev < nlevels; ++lev) {
-        for (ParIterType pti(*this, lev); pti.isValid(); ++pti) {
-            const int np = pti.numParticles();
-            auto* pstruct = pti.GetArrayOfStructs()().data();
-
-            amrex::ParallelFor(np, [=] AMREX_GPU_DEVICE(const int ip) noexcept {
-                auto& pp = pstruct[ip];
-                pp.id() = -1;
-            });
-        }
-    }
-    Redistribute();
-
-    const int total_pts = static_cast<int>(m_data.velocity.size());
-    initialize_particles(total_pts);
+    m_full_redistribute = true;
 }
 
 /** Update position vectors of the particles within a container based on the
  *  data provided by actuator instances.
  *
- *  This method assumes that the particles have been restored to their
- *  originating MPI ranks after any scattering. This happens during
- *  initialization (after AcutatorContainer::initialize_particles) and after
- *  ActuatorContainer::sample_velocities.
- *
- *  After executing this method, the particles have been scattered across the
- *  domain such that each particle is contained within a tile that has the cell
- *  enclosing the particle.
- *
+ *  The particles persist between timesteps and can reside on any MPI rank.
+ *  The positions of all actuator points are gathered from the ranks that own
+ *  the actuators and the particles are updated in place. Since the actuator
+ *  points only move a fraction of a cell per timestep, a local redistribution
+ *  that only communicates with neighboring ranks is sufficient to move the
+ *  particles to the rank containing the enclosing cell. A full redistribution
+ *  is performed after (re-)initialization or if any point moved further than
+ *  the local redistribution can handle.
  */
 void ActuatorContainer::update_positions()
 {
     BL_PROFILE("amr-wind::actuator::ActuatorContainer::update_positions");
     AMREX_ALWAYS_ASSERT(m_container_initialized && !m_is_scattered);
 
-    const auto dpos = gpu::device_view(m_data.position);
-    const auto* const dptr = dpos.data();
+    const int npts = num_actuator_points();
+    bool full_redistribute = m_full_redistribute;
+    {
+        // Maximum displacement of the actuator points since the last update.
+        // Points outside the domain are shifted by periodic boundaries during
+        // redistribution, so their particles must be scattered again.
+        const auto& pdomain = m_mesh.Geom(0).ProbDomain();
+        const auto& dx = m_mesh.Geom(m_mesh.finestLevel()).CellSizeArray();
+        const amrex::Real max_local =
+            m_redist_grow * amrex::min(dx[0], amrex::min(dx[1], dx[2]));
+        amrex::Real max_disp = 0.0;
+        if (static_cast<int>(m_pos_prev.size()) == npts) {
+            for (int i = 0; i < npts; ++i) {
+                const auto& pos = m_data.position[i];
+                max_disp = amrex::max(max_disp, vs::mag(pos - m_pos_prev[i]));
+                if (!pdomain.contains(pos.data())) {
+                    max_disp = amrex::max(max_disp, max_local);
+                }
+            }
+        }
+        amrex::ParallelDescriptor::ReduceRealMax(max_disp);
+        full_redistribute = full_redistribute || (max_disp >= max_local);
+    }
+    m_pos_prev = m_data.position;
+
+    gather_positions();
+
+    const auto* gpos = m_pos_global.data();
+    const auto* offsets = m_proc_offsets_device.data();
     const int nlevels = m_mesh.finestLevel() + 1;
     for (int lev = 0; lev < nlevels; ++lev) {
         for (ParIterType pti(*this, lev); pti.isValid(); ++pti) {
@@ -172,9 +177,9 @@ void ActuatorContainer::update_positions()
 
             amrex::ParallelFor(np, [=] AMREX_GPU_DEVICE(const int ip) noexcept {
                 auto& pp = pstruct[ip];
-                const auto idx = pp.idata(0);
+                const auto idx = offsets[pp.cpu()] + pp.idata(0);
 
-                const auto& pvec = dptr[idx];
+                const auto& pvec = gpos[idx];
                 for (int n = 0; n < AMREX_SPACEDIM; ++n) {
                     pp.pos(n) = pvec[n];
                 }
@@ -183,21 +188,62 @@ void ActuatorContainer::update_positions()
     }
 
     // Scatter particles to appropriate MPI ranks
-    Redistribute();
+    if (full_redistribute) {
+        Redistribute();
+    } else {
+        Redistribute(0, -1, 0, m_redist_grow);
+    }
 
     // Indicate that it is safe to sample velocities
+    m_full_redistribute = false;
     m_is_scattered = true;
 }
 
+/** Gather the position vectors of the actuator points from all MPI ranks
+ *
+ *  The positions are stored contiguously in the order of the originating MPI
+ *  ranks, i.e., the position of a particle is at index `offset[cpu] + idx`.
+ */
+void ActuatorContainer::gather_positions()
+{
+    BL_PROFILE("amr-wind::actuator::ActuatorContainer::gather_positions");
+    const int nproc = amrex::ParallelDescriptor::NProcs();
+    const int iproc = amrex::ParallelDescriptor::MyProc();
+    amrex::Vector<vs::Vector> pos_host(m_proc_offsets.back());
+
+#ifdef AMREX_USE_MPI
+    constexpr int ncomp = vs::Vector::ncomp;
+    amrex::Vector<int> counts(nproc), displs(nproc);
+    for (int i = 0; i < nproc; ++i) {
+        counts[i] = (m_proc_offsets[i + 1] - m_proc_offsets[i]) * ncomp;
+        displs[i] = m_proc_offsets[i] * ncomp;
+    }
+    const auto mpi_real = amrex::ParallelDescriptor::Mpi_typemap<
+        amrex::Real>::type();
+    MPI_Allgatherv(
+        m_data.position.data(), counts[iproc], mpi_real, pos_host.data(),
+        counts.data(), displs.data(), mpi_real,
+        amrex::ParallelDescriptor::Communicator());
+#else
+    amrex::ignore_unused(nproc, iproc);
+    std::copy(
+        m_data.position.begin(), m_data.position.end(), pos_host.begin());
+#endif
+
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, pos_host.begin(), pos_host.end(),
+        m_pos_global.begin());
+}
+
 /** Interpolate the velocity field using a trilinear interpolation
  *
- *  This method performs three tasks:
+ *  This method performs two tasks:
  *    - Sample the velocity field and interpolate onto particle location
- *    - Restore the particles back to their original MPI rank
  *    - Copy data from particles into the buffer used by actuator instances
  *
- *  After invocation if this method, the particles are back in their original
- *  rank and the position vectors can be updated safely.
+ *  The particles remain on the MPI rank containing their enclosing cell, so
+ *  that the next position update only moves particles that crossed a box
+ *  boundary.
  */
 void ActuatorContainer::sample_fields(const Field& vel, const Field& density)
 {
@@ -207,14 +253,10 @@ void ActuatorContainer::sample_fields(const Field& vel, const Field& density)
     // Sample velocity field
     interpolate_fields(vel, density);
 
-    // Recall particles to the MPI ranks that contains their corresponding
-    // turbines
-    // Redistribute();
-
     // Populate the velocity buffer that all actuator instances can access
     populate_field_buffers();
 
-    // Indicate that the particles have been restored to their original MPI rank
+    // Indicate that the positions can be updated for the next sampling
     m_is_scattered = false;
 }
 
@@ -257,17 +299,34 @@ void ActuatorContainer::populate_field_buffers()
     amrex::Gpu::copy(
         amrex::Gpu::deviceToHost, buff_device.begin(), buff_device.end(),
         buff_host.begin());
+
+    // Each rank only needs the samples for its own actuator points, so
+    // reduce and scatter the per-rank segments instead of reducing the whole
+    // buffer on every rank
+    const int nproc = amrex::ParallelDescriptor::NProcs();
+    const int iproc = amrex::ParallelDescriptor::MyProc();
+    int ioff = m_proc_offsets[iproc];
 #ifdef AMREX_USE_MPI
-    const int num_entires = static_cast<int>(buff_host.size());
-    MPI_Allreduce(
-        MPI_IN_PLACE, buff_host.data(), num_entires, MPI_DOUBLE, MPI_SUM,
+    amrex::Vector<int> recv_counts(nproc);
+    for (int i = 0; i < nproc; ++i) {
+        recv_counts[i] =
+            (m_proc_offsets[i + 1] - m_proc_offsets[i]) * NumPStructReal;
+    }
+    amrex::Vector<amrex::Real> buff_recv(
+        amrex::max(recv_counts[iproc], 1), 0.0);
+    MPI_Reduce_scatter(
+        buff_host.data(), buff_recv.data(), recv_counts.data(),
+        amrex::ParallelDescriptor::Mpi_typemap<amrex::Real>::type(), MPI_SUM,
         amrex::ParallelDescriptor::Communicator());
+    buff_host.swap(buff_recv);
+    ioff = 0;
+#else
+    amrex::ignore_unused(nproc);
 #endif
     {
         auto& vel_arr = m_data.velocity;
         auto& den_arr = m_data.density;
         const int npts = static_cast<int>(vel_arr.size());
-        const int ioff = m_proc_offsets[amrex::ParallelDescriptor::MyProc()];
         for (int i = 0; i < npts; ++i) {
             for (int j = 0; j < AMREX_SPACEDIM; ++j) {
                 vel_arr[i][j] = buff_host[(ioff + i) * NumPStructReal + j];
@@ -281,15 +340,12 @@ void ActuatorContainer::populate_field_buffers()
 /** Helper method for ActuatorContainer::sample_fields
  *
  *  Performs a trilinear interpolation of the velocity/density field to particle
- *  locations. It also updates the particle locations such that the next
- *  Redistribute call restores the particles back to their original MPI rank
- *  where they were created.
+ *  locations.
  */
 void ActuatorContainer::interpolate_fields(
     const Field& vel, const Field& density)
 {
     BL_PROFILE("amr-wind::actuator::ActuatorContainer::interpolate_velocities");
-    auto* dptr = m_pos_device.data();
     const int nlevels = m_mesh.finestLevel() + 1;
     for (int lev = 0; lev < nlevels; ++lev) {
         const auto& geom = m_mesh.Geom(lev);
@@ -327,8 +383,6 @@ void ActuatorContainer::interpolate_fields(
                 const amrex::Real wy_lo = 1.0 - wy_hi;
                 const amrex::Real wz_lo = 1.0 - wz_hi;
 
-                const int iproc = pp.cpu();
-
                 // velocity
                 for (int ic = 0; ic < AMREX_SPACEDIM; ++ic) {
                     pp.rdata(ic) =
@@ -340,10 +394,6 @@ void ActuatorContainer::interpolate_fields(
                         wx_hi * wy_lo * wz_hi * varr(i + 1, j, k + 1, ic) +
                         wx_hi * wy_hi * wz_lo * varr(i + 1, j + 1, k, ic) +
                         wx_hi * wy_hi * wz_hi * varr(i + 1, j + 1, k + 1, ic);
-
-                    // Reset position vectors so that the particles return back
-                    // to the MPI ranks with the turbines upon redistribution
-                    pp.pos(ic) = dptr[iproc][ic];
                 }
 
                 // density
@@ -361,60 +411,4 @@ void ActuatorContainer::interpolate_fields(
     }
 }
 
-/** Determine position vector of a point within each MPI rank
- *
- *  Loops over the boxArray and determines the first patch that belongs to the
- *  current MPI rank. Uses that to generate a position vector that is known to
- *  exist in a given rank. Setting the position vectors of the particles to this
- *  know location will recall particles belonging to this rank during
- *  Redistribute.
- */
-void ActuatorContainer::compute_local_coordinates()
-{
-    BL_PROFILE(
-        "amr-wind::actuator::ActuatorContainer::compute_local_coordinates");
-    const int nprocs = amrex::ParallelDescriptor::NProcs();
-    const int iproc = amrex::ParallelDescriptor::MyProc();
-
-    // Reset position vectors to zero (required for parallel reduce sum)
-    m_proc_pos.assign(nprocs, vs::Vector::zero());
-
-    // Flag indicating whether a point within the domain belonging to this rank
-    // has been found
-    bool assigned = false;
-    const int nlevels = m_mesh.finestLevel() + 1;
-    for (int lev = 0; ((lev < nlevels) && !assigned); ++lev) {
-        const auto& ba = m_mesh.boxArray(lev);
-        const auto& dm = m_mesh.DistributionMap(lev);
-
-        const int nbx = static_cast<int>(dm.size());
-        for (int i = 0; (i < nbx) && !assigned; ++i) {
-            if (dm[i] != iproc) {
-                continue;
-            }
-
-            const auto& geom = m_mesh.Geom(lev);
-            const auto& bx = ba[i];
-            const int* lo = bx.loVect();
-
-            auto& pvec = m_proc_pos[iproc];
-            pvec.x() = geom.ProbLo()[0] + (lo[0] + 0.5) * geom.CellSize()[0];
-            pvec.y() = geom.ProbLo()[1] + (lo[1] + 0.5) * geom.CellSize()[1];
-            pvec.z() = geom.ProbLo()[2] + (lo[2] + 0.5) * geom.CellSize()[2];
-
-            // Indicate that we have found a point and it is safe to exit the
-            // loop
-            assigned = true;
-        }
-    }
-
-    // Share position vectors with every process
-    amrex::ParallelDescriptor::ReduceRealSum(
-        &(m_proc_pos[0].x()),
-        static_cast<int>(m_proc_pos.size()) * vs::Vector::ncomp);
-    amrex::Gpu::copy(
-        amrex::Gpu::hostToDevice, m_proc_pos.begin(), m_proc_pos.end(),
-        m_pos_device.begin());
-}
-
 } // namespace amr_wind::actuator
@@ -3,6 +3,7 @@
 
 #include <fstream>
 #include <algorithm>
+#include <cmath>
 
 namespace amr_wind::actuator {
 
@@ -15,8 +16,7 @@ AirfoilTable::~AirfoilTable() = default;
 void AirfoilTable::operator()(
     const amrex::Real aoa, amrex::Real& cl, amrex::Real& cd) const
 {
-    namespace interp = ::amr_wind::interp;
-    vs::Vector polar = interp::linear(m_aoa, m_polar, aoa);
+    const vs::Vector polar = host_view()(aoa);
     cl = polar.x();
     cd = polar.y();
 }
@@ -27,13 +27,47 @@ void AirfoilTable::operator()(
     amrex::Real& cd,
     amrex::Real& cm) const
 {
-    namespace interp = ::amr_wind::interp;
-    vs::Vector polar = interp::linear(m_aoa, m_polar, aoa);
+    const vs::Vector polar = host_view()(aoa);
     cl = polar.x();
     cd = polar.y();
     cm = polar.z();
 }
 
+void AirfoilTable::lookup(
+    const RealList& aoa, RealList& cl, RealList& cd) const
+{
+    AMREX_ASSERT(cl.size() == aoa.size());
+    AMREX_ASSERT(cd.size() == aoa.size());
+    const auto view = host_view();
+    for (int i = 0; i < static_cast<int>(aoa.size()); ++i) {
+        const vs::Vector polar = view(aoa[i]);
+        cl[i] = polar.x();
+        cd[i] = polar.y();
+    }
+}
+
+AirfoilTableView AirfoilTable::host_view() const
+{
+    AirfoilTableView view;
+    view.aoa = m_aoa.data();
+    view.polar = m_polar.data();
+    view.bin_index = m_bin_index.data();
+    view.num_entries = num_entries();
+    view.num_bins = num_bins();
+    view.aoa_lo = m_aoa_lo;
+    view.inv_dbin = m_inv_dbin;
+    return view;
+}
+
+AirfoilTableView AirfoilTable::device_view() const
+{
+    auto view = host_view();
+    view.aoa = m_aoa_d.data();
+    view.polar = m_polar_d.data();
+    view.bin_index = m_bin_index_d.data();
+    return view;
+}
+
 void ThinAirfoil::operator()(
     const amrex::Real aoa, amrex::Real& cl, amrex::Real& cd) const
 {
@@ -41,6 +75,15 @@ void ThinAirfoil::operator()(
     cd = m_cd_factor * std::sin(aoa);
 }
 
+void ThinAirfoil::lookup(const RealList& aoa, RealList& cl, RealList& cd) const
+{
+    AMREX_ASSERT(cl.size() == aoa.size());
+    AMREX_ASSERT(cd.size() == aoa.size());
+    for (int i = 0; i < static_cast<int>(aoa.size()); ++i) {
+        (*this)(aoa[i], cl[i], cd[i]);
+    }
+}
+
 void AirfoilTable::convert_aoa_to_radians()
 {
     std::transform(
@@ -48,6 +91,61 @@ void AirfoilTable::convert_aoa_to_radians()
         [](amrex::Real aoa_in) { return utils::radians(aoa_in); });
 }
 
+void AirfoilTable::build_lookup()
+{
+    // Maximum number of bins, limits the memory used for tables with very
+    // closely spaced (or repeated) entries
+    constexpr int max_bins = 8192;
+    const int npts = num_entries();
+
+    m_bin_index.assign(1, 0);
+    m_aoa_lo = (npts > 0) ? m_aoa.front() : 0.0;
+    m_inv_dbin = 0.0;
+    if (npts > 1) {
+        // Size the bins from the smallest spacing, so that a lookup only
+        // moves by one interval from the one stored in the bin
+        const amrex::Real range = m_aoa.back() - m_aoa.front();
+        amrex::Real min_dx = range;
+        for (int i = 0; i < npts - 1; ++i) {
+            const amrex::Real dx = m_aoa[i + 1] - m_aoa[i];
+            if (dx > 1.0e-8) {
+                min_dx = amrex::min(min_dx, dx);
+            }
+        }
+        const int nbins =
+            (min_dx > 0.0)
+                ? amrex::min(
+                      max_bins,
+                      static_cast<int>(std::ceil(range / min_dx - 1.0e-8)))
+                : 1;
+        const int num_bins = amrex::max(nbins, 1);
+        const amrex::Real dbin = range / static_cast<amrex::Real>(num_bins);
+        m_inv_dbin = (dbin > 0.0) ? 1.0 / dbin : 0.0;
+
+        m_bin_index.resize(num_bins);
+        int il = 0;
+        for (int ib = 0; ib < num_bins; ++ib) {
+            const amrex::Real xb = m_aoa_lo + ib * dbin;
+            while ((il < npts - 2) && (xb > m_aoa[il + 1])) {
+                ++il;
+            }
+            m_bin_index[ib] = il;
+        }
+    }
+
+    m_aoa_d.resize(m_aoa.size());
+    m_polar_d.resize(m_polar.size());
+    m_bin_index_d.resize(m_bin_index.size());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, m_aoa.begin(), m_aoa.end(), m_aoa_d.begin());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, m_polar.begin(), m_polar.end(),
+        m_polar_d.begin());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, m_bin_index.begin(), m_bin_index.end(),
+        m_bin_index_d.begin());
+}
+
 std::unique_ptr<AirfoilTable>
 AirfoilLoader::load_text_file(const std::string& af_file)
 {
@@ -0,0 +1,157 @@
+#include "Benchmark.H"
+
+#include <set>
+
+#include "AMReX_OpenMP.H"
+#include "AMReX_ParallelDescriptor.H"
+#include "AMReX_ParmParse.H"
+
+namespace amr_wind::bench {
+
+BenchMesh::BenchMesh(const BenchConfig& cfg)
+    : m_cfg(cfg), m_user_inputs(amrex::ParmParse::getEntries())
+{
+    // Defaults that the user can override in the input file
+    {
+        amrex::ParmParse pp("time");
+        amrex::Real stop_time = 2.0;
+        int max_step = 10;
+        amrex::Real fixed_dt = 0.1;
+        amrex::Real cfl = 0.5;
+        int verbose = -1;
+        pp.queryAdd("stop_time", stop_time);
+        pp.queryAdd("max_step", max_step);
+        pp.queryAdd("fixed_dt", fixed_dt);
+        pp.queryAdd("cfl", cfl);
+        pp.queryAdd("verbose", verbose);
+    }
+    {
+        amrex::ParmParse pp("amr");
+        int verbose = 0;
+        pp.queryAdd("verbose", verbose);
+    }
+
+    // The mesh is defined by the benchmark configuration
+    {
+        amrex::ParmParse pp("amr");
+        pp.addarr("n_cell", m_cfg.n_cell);
+        pp.add("max_level", 0);
+        pp.add("max_grid_size", m_cfg.max_grid_size);
+    }
+    {
+        amrex::ParmParse pp("geometry");
+        amrex::Vector<amrex::Real> problo{{0.0, 0.0, 0.0}};
+        amrex::Vector<amrex::Real> probhi(AMREX_SPACEDIM);
+        for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+            probhi[i] = static_cast<amrex::Real>(m_cfg.n_cell[i]);
+        }
+        amrex::Vector<int> periodic{{1, 1, 1}};
+        pp.addarr("prob_lo", problo);
+        pp.addarr("prob_hi", probhi);
+        pp.addarr("is_periodic", periodic);
+    }
+}
+
+BenchMesh::~BenchMesh()
+{
+    // Remove the inputs added for this benchmark so that they do not affect
+    // the next one, the user inputs are left untouched
+    const std::set<std::string> user_inputs(
+        m_user_inputs.begin(), m_user_inputs.end());
+    amrex::ParmParse pp;
+    for (const auto& name : amrex::ParmParse::getEntries()) {
+        if (user_inputs.count(name) == 0) {
+            pp.remove(name);
+        }
+    }
+}
+
+void BenchMesh::reset_prob_domain()
+{
+    amrex::Vector<amrex::Real> problo(AMREX_SPACEDIM);
+    amrex::Vector<amrex::Real> probhi(AMREX_SPACEDIM);
+    amrex::Vector<int> periodic(AMREX_SPACEDIM);
+    {
+        amrex::ParmParse pp("geometry");
+        pp.getarr("prob_lo", problo, 0, AMREX_SPACEDIM);
+        pp.getarr("prob_hi", probhi, 0, AMREX_SPACEDIM);
+        pp.getarr("is_periodic", periodic, 0, AMREX_SPACEDIM);
+    }
+
+    // The default geometry persists between meshes, reset it for this one
+    if (amrex::AMReX::top()->getDefaultGeometry() != nullptr) {
+        amrex::RealBox rb(problo.data(), probhi.data());
+        amrex::Geometry::ResetDefaultProbDomain(rb);
+        amrex::Geometry::ResetDefaultPeriodicity(
+            {{periodic[0], periodic[1], periodic[2]}});
+    }
+}
+
+void BenchMesh::initialize_mesh()
+{
+    reset_prob_domain();
+    m_mesh = std::make_unique<amr_wind_tests::AmrTestMesh>();
+    m_mesh->initialize_mesh(0.0);
+}
+
+long BenchMesh::num_cells() const
+{
+    long ncells = 0;
+    for (int lev = 0; lev < m_mesh->num_levels(); ++lev) {
+        ncells += m_mesh->boxArray(lev).numPts();
+    }
+    return ncells;
+}
+
+amrex::Real
+time_kernel(const BenchConfig& cfg, const std::function<void()>& kernel)
+{
+    for (int n = 0; n < cfg.nwarmup; ++n) {
+        kernel();
+    }
+    amrex::Gpu::streamSynchronize();
+    amrex::ParallelDescriptor::Barrier();
+
+    const amrex::Real start = amrex::second();
+    for (int n = 0; n < cfg.niters; ++n) {
+        kernel();
+    }
+    amrex::Gpu::streamSynchronize();
+    amrex::Real elapsed = amrex::second() - start;
+
+    amrex::ParallelDescriptor::ReduceRealMax(elapsed);
+    return elapsed;
+}
+
+void write_json(
+    std::ostream& out,
+    const BenchConfig& cfg,
+    const amrex::Vector<BenchResult>& results)
+{
+    out << "{\n"
+        << "  \"nprocs\": " << amrex::ParallelDescriptor::NProcs() << ",\n"
+        << "  \"nthreads\": " << amrex::OpenMP::get_max_threads() << ",\n"
+        << "  \"n_cell\": [" << cfg.n_cell[0] << ", " << cfg.n_cell[1] << ", "
+        << cfg.n_cell[2] << "],\n"
+        << "  \"max_grid_size\": " << cfg.max_grid_size << ",\n"
+        << "  \"benchmarks\": [";
+
+    for (int i = 0; i < static_cast<int>(results.size()); ++i) {
+        const auto& res = results[i];
+        const amrex::Real tpi =
+            res.elapsed / static_cast<amrex::Real>(amrex::max(res.niters, 1));
+        const amrex::Real cells_per_sec =
+            (tpi > 0.0) ? static_cast<amrex::Real>(res.ncells) / tpi : 0.0;
+        out << ((i > 0) ? ",\n" : "\n") << "    {\"name\": \"" << res.name
+            << "\", \"cells\": " << res.ncells
+            << ", \"iterations\": " << res.niters
+            << ", \"seconds_per_iteration\": " << tpi
+            << ", \"cells_per_second\": " << cells_per_sec
+            << ", \"bytes_per_second\": "
+            << cells_per_sec * static_cast<amrex::Real>(res.bytes_per_cell)
+            << "}";
+    }
+    out << "\n  ]\n}" << std::endl;
+}
+
+} // namespace amr_wind::bench
@@ -0,0 +1,443 @@
+#include "Benchmark.H"
+
+#include "amr-wind/incflo.H"
+#include "amr-wind/CFDSim.H"
+#include "amr-wind/equation_systems/PDEBase.H"
+#include "amr-wind/equation_systems/SchemeTraits.H"
+#include "amr-wind/equation_systems/temperature/temperature.H"
+#include "amr-wind/equation_systems/vof/vof.H"
+#include "amr-wind/turbulence/TurbulenceModel.H"
+#include "amr-wind/utilities/FieldPlaneAveraging.H"
+#include "amr-wind/utilities/sampling/SamplingContainer.H"
+#include "amr-wind/utilities/sampling/SamplerBase.H"
+#include "amr-wind/wind_energy/actuator/Actuator.H"
+#include "amr-wind/wind_energy/actuator/ActuatorContainer.H"
+#include "amr-wind/wind_energy/actuator/ActuatorModel.H"
+#include "AMReX_ParmParse.H"
+
+namespace amr_wind::bench {
+
+namespace {
+
+constexpr long real_bytes = sizeof(amrex::Real);
+
+//! Smooth, periodic velocity field including ghost cells
+void init_velocity(amr_wind::Field& vel)
+{
+    const auto& mesh = vel.repo().mesh();
+    for (int lev = 0; lev < vel.repo().num_active_levels(); ++lev) {
+        const auto& dx = mesh.Geom(lev).CellSizeArray();
+        const auto& problo = mesh.Geom(lev).ProbLoArray();
+        const auto& probhi = mesh.Geom(lev).ProbHiArray();
+        const auto& varrs = vel(lev).arrays();
+        amrex::ParallelFor(
+            vel(lev), vel.num_grow(),
+            [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
+                const amrex::Real kx =
+                    2.0 * M_PI / (probhi[0] - problo[0]) *
+                    (problo[0] + (i + 0.5) * dx[0]);
+                const amrex::Real ky =
+                    2.0 * M_PI / (probhi[1] - problo[1]) *
+                    (problo[1] + (j + 0.5) * dx[1]);
+                const amrex::Real kz =
+                    2.0 * M_PI / (probhi[2] - problo[2]) *
+                    (problo[2] + (k + 0.5) * dx[2]);
+                varrs[nbx](i, j, k, 0) =
+                    1.0 + 0.1 * std::sin(kx) * std::cos(ky) * std::cos(kz);
+                varrs[nbx](i, j, k, 1) =
+                    0.5 - 0.1 * std::cos(kx) * std::sin(ky) * std::cos(kz);
+                varrs[nbx](i, j, k, 2) = 0.1 * std::sin(kz);
+            });
+    }
+    amrex::Gpu::streamSynchronize();
+}
+
+//! Gaussian blob scalar field (used for temperature and volume fraction)
+void init_scalar(
+    amr_wind::Field& fld, const amrex::Real lo, const amrex::Real hi)
+{
+    const auto& mesh = fld.repo().mesh();
+    for (int lev = 0; lev < fld.repo().num_active_levels(); ++lev) {
+        const auto& dx = mesh.Geom(lev).CellSizeArray();
+        const auto& problo = mesh.Geom(lev).ProbLoArray();
+        const auto& probhi = mesh.Geom(lev).ProbHiArray();
+        const auto& farrs = fld(lev).arrays();
+        amrex::ParallelFor(
+            fld(lev), fld.num_grow(),
+            [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
+                amrex::Real r2 = 0.0;
+                const amrex::IntVect iv(i, j, k);
+                for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                    const amrex::Real x =
+                        (iv[d] + 0.5) * dx[d] / (probhi[d] - problo[d]) - 0.5;
+                    r2 += x * x;
+                }
+                farrs[nbx](i, j, k) = lo + (hi - lo) * std::exp(-50.0 * r2);
+            });
+    }
+    amrex::Gpu::streamSynchronize();
+}
+
+void set_godunov_inputs()
+{
+    amrex::ParmParse pp("incflo");
+    pp.add("use_godunov", 1);
+    amrex::ParmParse pp_trans("transport");
+    pp_trans.add("viscosity", 1.0e-2);
+}
+
+//! Register ICNS and a temperature equation with initialized fields
+amr_wind::pde::PDEBase& setup_temperature(BenchMesh& bm)
+{
+    auto& sim = bm.sim();
+    auto& icns = sim.pde_manager().register_icns();
+    icns.initialize();
+    sim.init_physics();
+
+    auto& teqn = sim.pde_manager().register_transport_pde(
+        amr_wind::pde::Temperature::pde_name());
+    teqn.initialize();
+
+    init_velocity(sim.repo().get_field("velocity"));
+    init_scalar(teqn.fields().field, 300.0, 310.0);
+    sim.repo().get_field("density").setVal(1.0);
+    sim.pde_manager().advance_states();
+    sim.repo()
+        .get_field("density")
+        .state(amr_wind::FieldState::NPH)
+        .setVal(1.0);
+    if (!sim.repo().int_field_exists("mask_cell")) {
+        sim.repo().declare_int_field("mask_cell", 1, 1).setVal(1);
+    }
+
+    // MAC velocities for the advection of the scalar
+    icns.pre_advection_actions(amr_wind::FieldState::Old);
+    return teqn;
+}
+
+BenchResult godunov_advection(const BenchConfig& cfg)
+{
+    BenchMesh bm(cfg);
+    set_godunov_inputs();
+    bm.initialize_mesh();
+    auto& teqn = setup_temperature(bm);
+
+    BenchResult res;
+    res.name = "godunov_advection";
+    res.ncells = bm.num_cells();
+    // Scalar, face velocities, and advection term
+    res.bytes_per_cell = (1 + AMREX_SPACEDIM + 1) * real_bytes;
+    res.niters = cfg.niters;
+    res.elapsed = time_kernel(cfg, [&]() {
+        teqn.compute_advection_term(amr_wind::FieldState::Old);
+    });
+    return res;
+}
+
+BenchResult diffusion_solve(const BenchConfig& cfg)
+{
+    BenchMesh bm(cfg);
+    set_godunov_inputs();
+    bm.initialize_mesh();
+    auto& teqn = setup_temperature(bm);
+    teqn.compute_advection_term(amr_wind::FieldState::Old);
+    teqn.compute_mueff(amr_wind::FieldState::Old);
+    teqn.compute_source_term(amr_wind::FieldState::NPH);
+    const amrex::Real dt = bm.sim().time().delta_t();
+
+    BenchResult res;
+    res.name = "diffusion_solve";
+    res.ncells = bm.num_cells();
+    // Solution, right-hand side, and viscosity
+    res.bytes_per_cell = 3 * real_bytes;
+    res.niters = cfg.niters;
+    res.elapsed = time_kernel(cfg, [&]() {
+        teqn.compute_diffusion_term(amr_wind::FieldState::New);
+        teqn.compute_predictor_rhs(DiffusionType::Crank_Nicolson);
+        teqn.solve(0.5 * dt);
+    });
+    return res;
+}
+
+BenchResult vof_advection(const BenchConfig& cfg)
+{
+    BenchMesh bm(cfg);
+    set_godunov_inputs();
+    {
+        amrex::ParmParse pp("incflo");
+        amrex::Vector<std::string> physics{"MultiPhase"};
+        pp.addarr("physics", physics);
+    }
+    {
+        amrex::ParmParse pp("VOF");
+        pp.add("remove_debris", 0);
+    }
+    bm.initialize_mesh();
+
+    auto& sim = bm.sim();
+    auto& repo = sim.repo();
+    sim.pde_manager().register_icns();
+    sim.init_physics();
+
+    auto& vof = repo.get_field("vof");
+    init_scalar(vof, 0.0, 1.0);
+    for (const auto& name : {"u_mac", "v_mac", "w_mac"}) {
+        repo.get_field(name).setVal(0.5);
+    }
+
+    auto& seqn = sim.pde_manager()(
+        amr_wind::pde::VOF::pde_name() + "-" +
+        amr_wind::fvm::Godunov::scheme_name());
+    seqn.initialize();
+
+    BenchResult res;
+    res.name = "vof_advection";
+    res.ncells = bm.num_cells();
+    // Volume fraction (old and new) and face velocities
+    res.bytes_per_cell = (2 + AMREX_SPACEDIM) * real_bytes;
+    res.niters = cfg.niters;
+    res.elapsed = time_kernel(cfg, [&]() {
+        for (int lev = 0; lev < repo.num_active_levels(); ++lev) {
+            amrex::MultiFab::Copy(
+                vof.state(amr_wind::FieldState::Old)(lev), vof(lev), 0, 0,
+                vof.num_comp(), vof.num_grow());
+        }
+        seqn.compute_advection_term(amr_wind::FieldState::Old);
+        seqn.post_solve_actions();
+    });
+    return res;
+}
+
+BenchResult les_viscosity(const BenchConfig& cfg)
+{
+    BenchMesh bm(cfg);
+    {
+        amrex::ParmParse pp("turbulence");
+        pp.add("model", cfg.les_model);
+    }
+    {
+        amrex::ParmParse pp("transport");
+        pp.add("viscosity", 1.0e-5);
+    }
+    bm.initialize_mesh();
+
+    auto& sim = bm.sim();
+    sim.pde_manager().register_icns();
+    sim.init_physics();
+    sim.create_turbulence_model();
+    init_velocity(sim.repo().get_field("velocity"));
+    sim.repo().get_field("density").setVal(1.0);
+    auto& tmodel = sim.turbulence_model();
+
+    BenchResult res;
+    res.name = "les_viscosity_" + cfg.les_model;
+    res.ncells = bm.num_cells();
+    // Velocity, density, and turbulent viscosity
+    res.bytes_per_cell = (AMREX_SPACEDIM + 2) * real_bytes;
+    res.niters = cfg.niters;
+    res.elapsed = time_kernel(cfg, [&]() {
+        tmodel.update_turbulent_viscosity(
+            amr_wind::FieldState::New, DiffusionType::Crank_Nicolson);
+    });
+    return res;
+}
+
+BenchResult plane_averaging(const BenchConfig& cfg)
+{
+    BenchMesh bm(cfg);
+    bm.initialize_mesh();
+
+    auto& sim = bm.sim();
+    auto& vel = sim.repo().declare_field("velocity", AMREX_SPACEDIM, 3);
+    init_velocity(vel);
+    amr_wind::FieldPlaneAveraging pa(vel, sim.time(), 2);
+
+    BenchResult res;
+    res.name = "plane_averaging";
+    res.ncells = bm.num_cells();
+    res.bytes_per_cell = AMREX_SPACEDIM * real_bytes;
+    res.niters = cfg.niters;
+    res.elapsed = time_kernel(cfg, [&]() { pa(); });
+    return res;
+}
+
+BenchResult sampling_interpolation(const BenchConfig& cfg)
+{
+    BenchMesh bm(cfg);
+    const int npts = 4 * amrex::max(cfg.n_cell[0], cfg.n_cell[1]);
+    {
+        amrex::ParmParse pp("bench_sampling.plane");
+        pp.addarr(
+            "axis1", amrex::Vector<amrex::Real>{
+                         static_cast<amrex::Real>(cfg.n_cell[0]) - 1.0, 0.0,
+                         0.0});
+        pp.addarr(
+            "axis2", amrex::Vector<amrex::Real>{
+                         0.0, static_cast<amrex::Real>(cfg.n_cell[1]) - 1.0,
+                         0.0});
+        pp.addarr(
+            "origin", amrex::Vector<amrex::Real>{
+                          0.5, 0.5, 0.5 * static_cast<amrex::Real>(
+                                              cfg.n_cell[2])});
+        pp.addarr("num_points", amrex::Vector<int>{npts, npts});
+    }
+    bm.initialize_mesh();
+
+    auto& sim = bm.sim();
+    auto& vel = sim.repo().declare_field("velocity", AMREX_SPACEDIM, 3);
+    init_velocity(vel);
+
+    amrex::Vector<std::unique_ptr<amr_wind::sampling::SamplerBase>> samplers;
+    samplers.emplace_back(
+        amr_wind::sampling::SamplerBase::create("PlaneSampler", sim));
+    samplers[0]->label() = "plane";
+    samplers[0]->sampletype() = "PlaneSampler";
+    samplers[0]->id() = 0;
+    samplers[0]->initialize("bench_sampling.plane");
+
+    amr_wind::sampling::SamplingContainer scontainer(bm.mesh());
+    scontainer.setup_container(AMREX_SPACEDIM);
+    scontainer.initialize_particles(samplers);
+    scontainer.Redistribute();
+    const amrex::Vector<amr_wind::Field*> fields{&vel};
+
+    BenchResult res;
+    res.name = "sampling_interpolation";
+    res.ncells = samplers[0]->num_points();
+    // Trilinear stencil for each velocity component
+    res.bytes_per_cell = 8 * AMREX_SPACEDIM * real_bytes;
+    res.niters = cfg.niters;
+    res.elapsed = time_kernel(
+        cfg, [&]() { scontainer.interpolate_fields(fields, 0); });
+    return res;
+}
+
+BenchResult nodal_projection(const BenchConfig& cfg)
+{
+    BenchMesh bm(cfg);
+    set_godunov_inputs();
+    bm.reset_prob_domain();
+
+    incflo solver;
+    solver.init_mesh();
+    auto& repo = solver.sim().repo();
+    auto& density = repo.get_field("density");
+    auto& velocity = repo.get_field("velocity");
+    density.setVal(1.0);
+    repo.get_field("gp").setVal(0.0);
+
+    long ncells = 0;
+    for (int lev = 0; lev <= solver.finestLevel(); ++lev) {
+        ncells += solver.boxArray(lev).numPts();
+    }
+
+    BenchResult res;
+    res.name = "nodal_projection";
+    res.ncells = ncells;
+    // Velocity, density, pressure, and pressure gradient
+    res.bytes_per_cell = (2 * AMREX_SPACEDIM + 2) * real_bytes;
+    res.niters = cfg.niters;
+    res.elapsed = time_kernel(cfg, [&]() {
+        // Restore the divergent velocity so that every projection iterates
+        init_velocity(velocity);
+        solver.ApplyProjection(density.vec_const_ptrs(), 1.0, 1.0, false);
+    });
+    return res;
+}
+
+//! Actuator physics without the output files
+class BenchActuator : public amr_wind::actuator::Actuator
+{
+public:
+    explicit BenchActuator(amr_wind::CFDSim& sim)
+        : amr_wind::actuator::Actuator(sim)
+    {}
+
+protected:
+    void prepare_outputs() override {}
+};
+
+BenchResult actuator_source(const BenchConfig& cfg)
+{
+    BenchMesh bm(cfg);
+    const auto nx = static_cast<amrex::Real>(cfg.n_cell[0]);
+    const auto ny = static_cast<amrex::Real>(cfg.n_cell[1]);
+    const auto nz = static_cast<amrex::Real>(cfg.n_cell[2]);
+    const amrex::Vector<std::string> labels{"P1", "P2"};
+    {
+        amrex::ParmParse pp("Actuator");
+        pp.addarr("labels", labels);
+        pp.add("type", std::string("FlatPlateLine"));
+    }
+    {
+        amrex::ParmParse pp("Actuator.FlatPlateLine");
+        pp.add("num_points", cfg.n_cell[1] / 2 + 1);
+        pp.addarr("epsilon", amrex::Vector<amrex::Real>{2.0, 2.0, 2.0});
+        pp.add("pitch", 6.0);
+    }
+    for (int i = 0; i < 2; ++i) {
+        const amrex::Real xloc = (0.25 + 0.5 * i) * nx;
+        amrex::ParmParse pp("Actuator." + labels[i]);
+        pp.addarr(
+            "start", amrex::Vector<amrex::Real>{xloc, 0.25 * ny, 0.5 * nz});
+        pp.addarr(
+            "end", amrex::Vector<amrex::Real>{xloc, 0.75 * ny, 0.5 * nz});
+    }
+    bm.initialize_mesh();
+
+    auto& sim = bm.sim();
+    auto& repo = sim.repo();
+    auto& vel = repo.declare_field("velocity", AMREX_SPACEDIM, 3);
+    repo.declare_field("density", 1, 3).setVal(1.0);
+    init_velocity(vel);
+    amr_wind::actuator::ActuatorContainer::ParticleType::NextID(1U);
+
+    BenchActuator act(sim);
+    act.pre_init_actions();
+    act.post_init_actions();
+
+    auto& src = repo.get_field("actuator_src_term");
+    const int nact = static_cast<int>(labels.size());
+
+    BenchResult res;
+    res.name = "actuator_source";
+    res.ncells = bm.num_cells();
+    // Actuator source term
+    res.bytes_per_cell = AMREX_SPACEDIM * real_bytes;
+    res.niters = cfg.niters;
+    // Same loops as Actuator::compute_source_term, without the ghost fill
+    res.elapsed = time_kernel(cfg, [&]() {
+        src.setVal(0.0);
+        for (int lev = 0; lev < repo.num_active_levels(); ++lev) {
+            const auto& geom = sim.mesh().Geom(lev);
+            for (amrex::MFIter mfi(src(lev)); mfi.isValid(); ++mfi) {
+                for (int ia = 0; ia < nact; ++ia) {
+                    auto& model = act.get_act(ia);
+                    if (model.info().actuator_in_proc) {
+                        model.compute_source_term(lev, mfi, geom);
+                    }
+                }
+            }
+        }
+    });
+    return res;
+}
+
+} // namespace
+
+const std::map<std::string, BenchFunc>& benchmark_registry()
+{
+    static const std::map<std::string, BenchFunc> registry{
+        {"godunov_advection", godunov_advection},
+        {"diffusion_solve", diffusion_solve},
+        {"vof_advection", vof_advection},
+        {"les_viscosity", les_viscosity},
+        {"plane_averaging", plane_averaging},
+        {"sampling_interpolation", sampling_interpolation},
+        {"nodal_projection", nodal_projection},
+        {"actuator_source", actuator_source},
+    };
+    return registry;
+}
+
+} // namespace amr_wind::bench
@@ -0,0 +1,104 @@
+/** \file bench_main.cpp
+ *  Entry point for the AMR-Wind kernel micro-benchmarks
+ */
+
+#include <fstream>
+#include <iostream>
+
+#include "Benchmark.H"
+#include "AMReX.H"
+#include "AMReX_ParmParse.H"
+
+#ifdef AMREX_USE_OMP
+#include <omp.h>
+#endif
+
+int main(int argc, char* argv[])
+{
+#ifdef AMREX_USE_MPI
+    MPI_Init(&argc, &argv);
+#endif
+
+    using namespace amrex::mpidatatypes;
+
+    amrex::Initialize(argc, argv, true, MPI_COMM_WORLD, []() {
+        amrex::ParmParse pp("amrex");
+        if (!(pp.contains("v") || pp.contains("verbose"))) {
+            pp.add("verbose", -1);
+            pp.add("v", -1);
+        }
+        if (!pp.contains("throw_exception")) {
+            pp.add("throw_exception", 1);
+        }
+        if (!pp.contains("signal_handling")) {
+            pp.add("signal_handling", 0);
+        }
+    });
+
+    {
+        BL_PROFILE("amr-wind-bench::main");
+        amr_wind::bench::BenchConfig cfg;
+        amrex::Vector<std::string> kernels;
+        std::string output{"amr_wind_bench.json"};
+        {
+            amrex::ParmParse pp("bench");
+            // Accept either a single size for a cube or one per direction
+            if (pp.countval("n_cell") == 1) {
+                int ncell = 0;
+                pp.get("n_cell", ncell);
+                cfg.n_cell = {ncell, ncell, ncell};
+            } else {
+                pp.queryarr("n_cell", cfg.n_cell, 0, AMREX_SPACEDIM);
+            }
+            pp.query("max_grid_size", cfg.max_grid_size);
+            pp.query("niters", cfg.niters);
+            pp.query("nwarmup", cfg.nwarmup);
+            pp.query("les_model", cfg.les_model);
+            pp.queryarr("kernels", kernels);
+            pp.query("output", output);
+
+            int nthreads = 0;
+            pp.query("nthreads", nthreads);
+#ifdef AMREX_USE_OMP
+            if (nthreads > 0) {
+                omp_set_num_threads(nthreads);
+            }
+#else
+            amrex::ignore_unused(nthreads);
+#endif
+        }
+
+        const auto& registry = amr_wind::bench::benchmark_registry();
+        if (kernels.empty()) {
+            for (const auto& kv : registry) {
+                kernels.push_back(kv.first);
+            }
+        }
+
+        amrex::Vector<amr_wind::bench::BenchResult> results;
+        for (const auto& name : kernels) {
+            const auto it = registry.find(name);
+            if (it == registry.end()) {
+                amrex::Print() << "WARNING: unknown benchmark " << name
+                               << std::endl;
+                continue;
+            }
+            amrex::Print() << "Running benchmark: " << name << std::endl;
+            results.push_back(it->second(cfg));
+        }
+
+        if (amrex::ParallelDescriptor::IOProcessor()) {
+            amr_wind::bench::write_json(std::cout, cfg, results);
+            std::ofstream ofh(output);
+            amr_wind::bench::write_json(ofh, cfg, results);
+        }
+    }
+
+    amrex::Finalize();
+
+#ifdef AMREX_USE_MPI
+    MPI_Finalize();
+#endif
+
+    return 0;
+}
@@ -1,5 +1,4 @@
 #include "AmrTestMesh.H"
-#include "gtest/gtest.h"
 #include "AMReX_MultiFab.H"
 
 namespace amr_wind_tests {
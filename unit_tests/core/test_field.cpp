@@ -367,6 +367,47 @@ TEST_F(FieldRepoTest, int_fields)
     }
 }
 
+TEST_F(FieldRepoTest, float_fields)
+{
+    initialize_mesh();
+
+    auto& frepo = mesh().field_repo();
+    auto& ffield = frepo.declare_float_field("aux_field", 2, 1);
+    EXPECT_TRUE(frepo.float_field_exists("aux_field"));
+    EXPECT_FALSE(frepo.field_exists("aux_field"));
+    EXPECT_EQ(&ffield, &frepo.get_float_field("aux_field"));
+
+    auto& ref = frepo.declare_field("aux_ref", 2, 1);
+    auto& widened = frepo.declare_field("aux_widened", 2, 1);
+    const int nlevels = frepo.num_active_levels();
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto& farrs = ref(lev).arrays();
+        amrex::ParallelFor(
+            ref(lev), amrex::IntVect(1), 2,
+            [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k, int n) noexcept {
+                farrs[nbx](i, j, k, n) =
+                    1.0 / 3.0 + 1.0e-3 * (i + 2 * j + 3 * k) + 1.0e2 * n;
+            });
+        ffield.copy_from(lev, ref(lev), 0, 1);
+        ffield.copy_to(lev, widened(lev), 0, 1);
+    }
+
+    // Storage is half of the double-precision field
+    for (int lev = 0; lev < nlevels; ++lev) {
+        for (amrex::MFIter mfi(ref(lev)); mfi.isValid(); ++mfi) {
+            EXPECT_EQ(2 * ffield(lev)[mfi].nBytes(), ref(lev)[mfi].nBytes());
+        }
+    }
+
+    // Round trip is within single-precision accuracy
+    constexpr amrex::Real rel_tol = 1.0e-7;
+    for (int lev = 0; lev < nlevels; ++lev) {
+        amrex::MultiFab::Subtract(widened(lev), ref(lev), 0, 0, 2, 1);
+        EXPECT_LT(widened(lev).norm0(0, 1), rel_tol * ref(lev).norm0(0, 1));
+        EXPECT_LT(widened(lev).norm0(1, 1), rel_tol * ref(lev).norm0(1, 1));
+    }
+}
+
 TEST_F(FieldRepoTest, default_fillpatch_op)
 {
     initialize_mesh();
@@ -0,0 +1,35 @@
+#include "aw_test_utils/AmrexTest.H"
+#include "amr-wind/core/MeshMap.H"
+
+namespace amr_wind_tests {
+
+class MeshMapTest : public AmrexTest
+{};
+
+TEST_F(MeshMapTest, separable_view)
+{
+    // Domain spans indices [0, 3] with one ghost cell on each side
+    const amrex::Vector<amrex::Real> fx{0.5, 1.0, 2.0, 3.0, 4.0, 0.5};
+    const amrex::Vector<amrex::Real> fy{0.5, 1.5, 1.5, 1.5, 1.5, 0.5};
+    const amrex::Vector<amrex::Real> fz{0.5, 2.0, 2.0, 2.0, 2.0, 0.5};
+
+    amr_wind::SeparableMapView view;
+    view.fac = {fx.data(), fy.data(), fz.data()};
+    view.offset = {-1, -1, -1};
+    view.lo = {0, 0, 0};
+    view.hi = {3, 3, 3};
+
+    constexpr amrex::Real tol = 1.0e-12;
+    EXPECT_NEAR(view(2, 0, 0, 0), 3.0, tol);
+    EXPECT_NEAR(view(2, 0, 0, 1), 1.5, tol);
+    EXPECT_NEAR(view(2, 0, 0, 2), 2.0, tol);
+    EXPECT_NEAR(view.det_j(2, 0, 0), 9.0, tol);
+    EXPECT_NEAR(view.det_j(0, 3, 1), 3.0, tol);
+
+    // Identity mapping outside the domain, including ghost corners
+    EXPECT_NEAR(view(-1, 1, 1, 0), 1.0, tol);
+    EXPECT_NEAR(view(1, 4, 1, 0), 1.0, tol);
+    EXPECT_NEAR(view.det_j(1, 1, -1), 1.0, tol);
+}
+
+} // namespace amr_wind_tests
@@ -0,0 +1,165 @@
+#include "aw_test_utils/MeshTest.H"
+#include "aw_test_utils/test_utils.H"
+#include "amr-wind/incflo_enums.H"
+#include "amr-wind/core/field_ops.H"
+#include "amr-wind/equation_systems/PDEBase.H"
+
+namespace amr_wind_tests {
+
+namespace {
+
+//! Initialize the tracers with data that depends on the global tracer index
+void init_tracers(amr_wind::Field& fld, const int comp0)
+{
+    const int ncomp = fld.num_comp();
+    for (int lev = 0; lev < fld.repo().num_active_levels(); ++lev) {
+        const auto& farrs = fld(lev).arrays();
+        amrex::ParallelFor(
+            fld(lev), fld.num_grow(), ncomp,
+            [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k, int n) {
+                const int m = comp0 + n;
+                farrs[nbx](i, j, k, n) =
+                    1.0 + m + std::sin(0.7 * i + 0.3 * m) *
+                                  std::cos(0.4 * j - 0.2 * k + 0.5 * m);
+            });
+    }
+    amrex::Gpu::streamSynchronize();
+}
+
+} // namespace
+
+class PassiveScalarNcompTest : public MeshTest
+{
+protected:
+    void populate_parameters() override
+    {
+        MeshTest::populate_parameters();
+        {
+            amrex::ParmParse pp("amr");
+            pp.add("max_grid_size", 4);
+            pp.add("blocking_factor", 4);
+        }
+        {
+            amrex::ParmParse pp("incflo");
+            pp.add("use_godunov", 1);
+        }
+    }
+
+    /** Advance the passive scalar with `ncomp` tracers over one time step
+     *
+     *  The tracers are initialized with the data of the tracers `comp0` to
+     *  `comp0 + ncomp - 1`. The steps mimic the scalar predictor in
+     *  incflo::ApplyPredictor. A new mesh is created for every call and the
+     *  new state of the tracers is returned.
+     */
+    std::unique_ptr<amrex::MultiFab>
+    advance(const int ncomp, const int comp0, const DiffusionType difftype)
+    {
+        m_mesh.reset();
+        {
+            amrex::ParmParse pp("PassiveScalar");
+            pp.add("num_components", ncomp);
+        }
+        initialize_mesh();
+
+        auto& repo = sim().repo();
+        auto& pde_mgr = sim().pde_manager();
+        pde_mgr.register_icns();
+        sim().create_turbulence_model();
+        sim().init_physics();
+        auto& eqn = pde_mgr.register_transport_pde("PassiveScalar");
+        auto& mask_cell = repo.declare_int_field("mask_cell", 1, 1);
+        mask_cell.setVal(1);
+
+        auto& density = repo.get_field("density");
+        density.setVal(1.2);
+        density.state(amr_wind::FieldState::Old).setVal(1.2);
+        density.state(amr_wind::FieldState::NPH).setVal(1.2);
+        repo.get_field("u_mac").setVal(1.0);
+        repo.get_field("v_mac").setVal(-0.5);
+        repo.get_field("w_mac").setVal(0.25);
+
+        auto& fld = eqn.fields().field;
+        EXPECT_EQ(fld.num_comp(), ncomp);
+        init_tracers(fld, comp0);
+        init_tracers(fld.state(amr_wind::FieldState::Old), comp0);
+        eqn.fields().mueff.setVal(0.1);
+        eqn.initialize();
+
+        // Godunov forcing includes the explicit diffusion of the old state
+        eqn.compute_diffusion_term(amr_wind::FieldState::Old);
+        eqn.fields().src_term.setVal(0.0);
+        amr_wind::field_ops::add(
+            eqn.fields().src_term, eqn.fields().diff_term, 0, 0, ncomp, 0);
+        eqn.fields().src_term.fillpatch(time().current_time());
+
+        eqn.compute_advection_term(amr_wind::FieldState::Old);
+        eqn.compute_source_term(amr_wind::FieldState::NPH);
+        eqn.compute_predictor_rhs(difftype);
+
+        if (difftype == DiffusionType::Implicit) {
+            eqn.solve(time().delta_t());
+        } else {
+            // explicit RK2 correction
+            auto diff_old = repo.create_scratch_field(ncomp, 0);
+            auto& diff_new =
+                eqn.fields().diff_term.state(amr_wind::FieldState::New);
+            amr_wind::field_ops::copy(*diff_old, diff_new, 0, 0, ncomp, 0);
+            eqn.compute_diffusion_term(amr_wind::FieldState::New);
+            amr_wind::field_ops::saxpy(
+                diff_new, -1.0, *diff_old, 0, 0, ncomp, 0);
+            eqn.improve_explicit_diffusion(time().delta_t());
+        }
+        eqn.post_solve_actions();
+
+        // The tracers must have been changed by the update
+        auto change = repo.create_scratch_field(ncomp, 0);
+        amr_wind::field_ops::copy(*change, fld, 0, 0, ncomp, 0);
+        amr_wind::field_ops::saxpy(
+            *change, -1.0, fld.state(amr_wind::FieldState::Old), 0, 0, ncomp,
+            0);
+        for (int n = 0; n < ncomp; ++n) {
+            EXPECT_GT(
+                amrex::max(
+                    -utils::field_min(*change, n),
+                    utils::field_max(*change, n)),
+                1.0e-6);
+        }
+
+        const auto& mf = fld(0);
+        auto result = std::make_unique<amrex::MultiFab>(
+            mf.boxArray(), mf.DistributionMap(), ncomp, 0);
+        amrex::MultiFab::Copy(*result, mf, 0, 0, ncomp, 0);
+        return result;
+    }
+
+    //! Compare every tracer of the group against a single-tracer solution
+    void check_components(const DiffusionType difftype, const amrex::Real tol)
+    {
+        const int ncomp = 3;
+        const auto group = advance(ncomp, 0, difftype);
+
+        for (int n = 0; n < ncomp; ++n) {
+            const auto single = advance(1, n, difftype);
+
+            amrex::MultiFab diff(
+                group->boxArray(), group->DistributionMap(), 1, 0);
+            diff.ParallelCopy(*single, 0, 0, 1);
+            amrex::MultiFab::Subtract(diff, *group, n, 0, 1, 0);
+            EXPECT_NEAR(diff.norm0(0), 0.0, tol) << "tracer " << n;
+        }
+    }
+};
+
+TEST_F(PassiveScalarNcompTest, explicit_matches_single_component)
+{
+    check_components(DiffusionType::Explicit, 1.0e-12);
+}
+
+TEST_F(PassiveScalarNcompTest, implicit_matches_single_component)
+{
+    // The linear solver only converges the group to its tolerance
+    check_components(DiffusionType::Implicit, 1.0e-8);
+}
+
+} // namespace amr_wind_tests
@@ -38,4 +38,33 @@ TEST_F(PDETest, test_pde_create_mol)
     EXPECT_EQ(mesh().field_repo().num_fields(), 26);
 }
 
+TEST_F(PDETest, test_pde_passive_scalar_ncomp)
+{
+    {
+        amrex::ParmParse pp("incflo");
+        pp.add("use_godunov", 1);
+    }
+    {
+        amrex::ParmParse pp("PassiveScalar");
+        pp.add("num_components", 3);
+    }
+
+    initialize_mesh();
+
+    auto& pde_mgr = mesh().sim().pde_manager();
+    pde_mgr.register_icns();
+    auto& eqn = pde_mgr.register_transport_pde("PassiveScalar");
+
+    EXPECT_EQ(pde_mgr.scalar_eqns().size(), 1);
+
+    // All tracers are carried by the same set of fields
+    const auto& fields = eqn.fields();
+    EXPECT_EQ(fields.field.num_comp(), 3);
+    EXPECT_EQ(fields.src_term.num_comp(), 3);
+    EXPECT_EQ(fields.diff_term.num_comp(), 3);
+    EXPECT_EQ(fields.conv_term.num_comp(), 3);
+    EXPECT_EQ(fields.mueff.num_comp(), 1);
+    EXPECT_EQ(mesh().field_repo().num_fields(), 22);
+}
+
 } // namespace amr_wind_tests
@@ -0,0 +1,106 @@
+#include "aw_test_utils/MeshTest.H"
+#include "aw_test_utils/test_utils.H"
+#include "amr-wind/core/field_ops.H"
+#include "amr-wind/equation_systems/PDEBase.H"
+
+namespace amr_wind_tests {
+
+namespace {
+
+void init_scalar(amr_wind::Field& fld, const amrex::Real shift)
+{
+    const int ncomp = fld.num_comp();
+    for (int lev = 0; lev < fld.repo().num_active_levels(); ++lev) {
+        const auto& farrs = fld(lev).arrays();
+        amrex::ParallelFor(
+            fld(lev), fld.num_grow(), ncomp,
+            [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k, int n) {
+                farrs[nbx](i, j, k, n) =
+                    shift + n + std::sin(0.7 * i + 0.3 * n) *
+                                    std::cos(0.4 * j - 0.2 * k);
+            });
+    }
+    amrex::Gpu::streamSynchronize();
+}
+
+} // namespace
+
+class ScalarAdvectionGroupTest : public MeshTest
+{
+protected:
+    void populate_parameters() override
+    {
+        MeshTest::populate_parameters();
+        {
+            amrex::ParmParse pp("amr");
+            pp.add("max_grid_size", 4);
+            pp.add("blocking_factor", 4);
+        }
+        {
+            amrex::ParmParse pp("incflo");
+            pp.add("use_godunov", 1);
+        }
+        {
+            amrex::ParmParse pp("PassiveScalar");
+            pp.add("num_components", 2);
+        }
+    }
+};
+
+TEST_F(ScalarAdvectionGroupTest, matches_separate_advection)
+{
+    initialize_mesh();
+    auto& repo = sim().repo();
+    auto& pde_mgr = sim().pde_manager();
+    pde_mgr.register_icns();
+    sim().create_turbulence_model();
+    sim().init_physics();
+    auto& teqn = pde_mgr.register_transport_pde("Temperature");
+    auto& seqn = pde_mgr.register_transport_pde("PassiveScalar");
+    auto& mask_cell = repo.declare_int_field("mask_cell", 1, 1);
+    mask_cell.setVal(1);
+
+    auto& density = repo.get_field("density");
+    density.setVal(1.2);
+    density.state(amr_wind::FieldState::Old).setVal(1.2);
+    density.state(amr_wind::FieldState::NPH).setVal(1.2);
+    repo.get_field("u_mac").setVal(1.0);
+    repo.get_field("v_mac").setVal(-0.5);
+    repo.get_field("w_mac").setVal(0.25);
+
+    amrex::Vector<amr_wind::pde::PDEBase*> eqns{&teqn, &seqn};
+    for (auto* eqn : eqns) {
+        auto& fld = eqn->fields().field;
+        init_scalar(fld.state(amr_wind::FieldState::Old), 300.0);
+        init_scalar(fld.state(amr_wind::FieldState::NPH), 300.5);
+        eqn->fields().src_term.setVal(0.1);
+        eqn->initialize();
+    }
+
+    // Reference advection terms computed one equation at a time
+    amrex::Vector<std::unique_ptr<amr_wind::ScratchField>> ref;
+    for (auto* eqn : eqns) {
+        auto& conv = eqn->fields().conv_term;
+        eqn->compute_advection_term(amr_wind::FieldState::Old);
+        ref.emplace_back(repo.create_scratch_field(conv.num_comp(), 0));
+        amr_wind::field_ops::copy(*ref.back(), conv, 0, 0, conv.num_comp(), 0);
+        conv.setVal(0.0);
+    }
+
+    pde_mgr.init_advection_groups();
+    EXPECT_TRUE(pde_mgr.has_advection_groups());
+    pde_mgr.compute_scalar_advection(amr_wind::FieldState::Old);
+
+    for (int ieq = 0; ieq < static_cast<int>(eqns.size()); ++ieq) {
+        auto& conv = eqns[ieq]->fields().conv_term;
+        for (int n = 0; n < conv.num_comp(); ++n) {
+            // The reference terms must not be trivial
+            EXPECT_GT(utils::field_max(*ref[ieq], n), 1.0e-6);
+            amr_wind::field_ops::saxpy(conv, -1.0, *ref[ieq], n, n, 1, 0);
+            EXPECT_NEAR(utils::field_min(conv, n), 0.0, 1.0e-12);
+            EXPECT_NEAR(utils::field_max(conv, n), 0.0, 1.0e-12);
+        }
+    }
+}
+
+} // namespace amr_wind_tests
@@ -1121,4 +1121,302 @@ TEST_F(VOFOversetOps, projection_masks)
     EXPECT_NEAR(error_cell, 0.0, 1e-10);
 }
 
+TEST_F(VOFOversetOps, fringe_boxes)
+{
+    populate_parameters();
+    initialize_mesh();
+
+    auto& repo = sim().repo();
+    const int nghost = 3;
+    auto& iblank_cell = repo.declare_int_field("iblank_cell", 1, nghost);
+    auto& flux_x =
+        repo.declare_field("flux_x", 1, 0, 1, amr_wind::FieldLoc::XFACE);
+    auto& flux_y =
+        repo.declare_field("flux_y", 1, 0, 1, amr_wind::FieldLoc::YFACE);
+    auto& flux_z =
+        repo.declare_field("flux_z", 1, 0, 1, amr_wind::FieldLoc::ZFACE);
+
+    // Fringe cells span two boxes in x (8^3 mesh with boxes of 4^3)
+    iblank_cell.setVal(1);
+    run_algorithm(iblank_cell, [&](const int lev, const amrex::MFIter& mfi) {
+        const auto& ib = iblank_cell(lev).array(mfi);
+        amrex::ParallelFor(
+            mfi.growntilebox(),
+            [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                if (i >= 0 && i <= 4 && j >= 0 && j <= 1 && k >= 0 && k <= 1) {
+                    ib(i, j, k) = -1;
+                }
+            });
+    });
+
+    const auto active =
+        amr_wind::overset_ops::fringe_box_flags(iblank_cell(0), 1);
+    const auto& ba = iblank_cell(0).boxArray();
+    ASSERT_EQ(active.size(), ba.size());
+    int nactive = 0;
+    for (int i = 0; i < static_cast<int>(ba.size()); ++i) {
+        const bool expected =
+            (ba[i].smallEnd(1) == 0) && (ba[i].smallEnd(2) == 0);
+        EXPECT_EQ(active[i] != 0, expected);
+        nactive += active[i];
+    }
+    EXPECT_EQ(nactive, 2);
+
+    // Only the fluxes in the active boxes contribute to the convergence
+    flux_x.setVal(0.0);
+    flux_y.setVal(0.0);
+    flux_z.setVal(0.0);
+    run_algorithm(flux_x, [&](const int lev, const amrex::MFIter& mfi) {
+        const auto& f = flux_x(lev).array(mfi);
+        const amrex::Real fval = (active[mfi.index()] != 0) ? 1.0 : 2.0;
+        amrex::ParallelFor(
+            mfi.tilebox(), [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                f(i, j, k) = fval;
+            });
+    });
+    amrex::Real err = amr_wind::overset_ops::measure_convergence(
+        flux_x(0), flux_y(0), flux_z(0), active);
+    amrex::ParallelDescriptor::ReduceRealMax(err);
+    EXPECT_DOUBLE_EQ(err, 1.0);
+    err = amr_wind::overset_ops::measure_convergence(
+        flux_x(0), flux_y(0), flux_z(0));
+    amrex::ParallelDescriptor::ReduceRealMax(err);
+    EXPECT_DOUBLE_EQ(err, 2.0);
+}
+
+namespace {
+constexpr amrex::Real sharpen_rho1 = 1000.0;
+constexpr amrex::Real sharpen_rho2 = 1.0;
+constexpr amrex::Real sharpen_vof_tol = 1e-12;
+
+void set_density_via_vof(amr_wind::Field& rho, const amr_wind::Field& vof)
+{
+    run_algorithm(rho, [&](const int lev, const amrex::MFIter& mfi) {
+        const auto& rho_arr = rho(lev).array(mfi);
+        const auto& vof_arr = vof(lev).const_array(mfi);
+        amrex::ParallelFor(
+            mfi.growntilebox(),
+            [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                rho_arr(i, j, k) = sharpen_rho1 * vof_arr(i, j, k) +
+                                   sharpen_rho2 * (1.0 - vof_arr(i, j, k));
+            });
+    });
+}
+
+// Diffuse interface normal to x crossing the fringe, with a sharper target
+void init_sharpen_fields(amr_wind::FieldRepo& repo)
+{
+    auto& vof = repo.get_field("vof");
+    auto& tg_vof = repo.get_field("target_vof");
+    auto& velocity = repo.get_field("velocity");
+    auto& gp = repo.get_field("gp");
+    const auto& iblank = repo.get_int_field("iblank_cell");
+    const auto& geom = repo.mesh().Geom();
+
+    run_algorithm(vof, [&](const int lev, const amrex::MFIter& mfi) {
+        const auto& vof_arr = vof(lev).array(mfi);
+        const auto& tg_arr = tg_vof(lev).array(mfi);
+        const auto& vel_arr = velocity(lev).array(mfi);
+        const auto& gp_arr = gp(lev).array(mfi);
+        const auto problo = geom[lev].ProbLoArray();
+        const auto dx = geom[lev].CellSizeArray();
+        amrex::ParallelFor(
+            mfi.tilebox(), [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                const amrex::Real x = problo[0] + (i + 0.5) * dx[0];
+                const amrex::Real y = problo[1] + (j + 0.5) * dx[1];
+                const amrex::Real z = problo[2] + (k + 0.5) * dx[2];
+                vof_arr(i, j, k) = 0.5 * (1.0 + std::tanh((x - 0.45) / 0.2));
+                tg_arr(i, j, k) = 0.5 * (1.0 + std::tanh((x - 0.45) / 0.02));
+                // Values within the tolerance away from the fringe
+                if (i == 1 && j == 6 && k == 6) {
+                    vof_arr(i, j, k) = 0.1 * sharpen_vof_tol;
+                }
+                if (i == 6 && j == 6 && k == 6) {
+                    vof_arr(i, j, k) = 1.0 - 0.1 * sharpen_vof_tol;
+                }
+                vel_arr(i, j, k, 0) = 1.0 + x;
+                vel_arr(i, j, k, 1) = y * z;
+                vel_arr(i, j, k, 2) = -z;
+                gp_arr(i, j, k, 0) = 0.1 * x;
+                gp_arr(i, j, k, 1) = 0.2 * y;
+                gp_arr(i, j, k, 2) = -9.81 * (1.0 + z);
+            });
+    });
+
+    for (int lev = 0; lev < repo.num_active_levels(); ++lev) {
+        amr_wind::overset_ops::harmonize_vof(
+            tg_vof(lev), vof(lev), iblank(lev));
+    }
+    for (int lev = 0; lev < repo.num_active_levels(); ++lev) {
+        vof(lev).FillBoundary(geom[lev].periodicity());
+        tg_vof(lev).FillBoundary(geom[lev].periodicity());
+        velocity(lev).FillBoundary(geom[lev].periodicity());
+        gp(lev).FillBoundary(geom[lev].periodicity());
+    }
+    set_density_via_vof(repo.get_field("density"), vof);
+    repo.get_field("p").setVal(0.0);
+    repo.get_field("p_src").setVal(0.0);
+    repo.get_field("int_normal").setVal(0.0);
+    repo.get_field("flux_x").setVal(0.0);
+    repo.get_field("flux_y").setVal(0.0);
+    repo.get_field("flux_z").setVal(0.0);
+}
+
+// Pseudo-time loop of OversetOps::sharpen_nalu_data on a single level,
+// returning the convergence error of the last iteration
+amrex::Real run_sharpening(
+    amr_wind::FieldRepo& repo,
+    const amrex::Vector<int>& active,
+    const int n_iterations)
+{
+    constexpr amrex::Real margin = 0.1;
+    constexpr amrex::Real convg_tol = 1e-12;
+    constexpr amrex::Real pCFL = 0.5;
+    const int lev = 0;
+    const auto& geom = repo.mesh().Geom(lev);
+    const auto dx = geom.CellSizeArray();
+    auto& vof = repo.get_field("vof");
+    auto& rho = repo.get_field("density");
+    auto& velocity = repo.get_field("velocity");
+    auto& gp = repo.get_field("gp");
+    auto& p = repo.get_field("p");
+    auto& p_src = repo.get_field("p_src");
+    auto& norm = repo.get_field("int_normal");
+    auto& flux_x = repo.get_field("flux_x");
+    auto& flux_y = repo.get_field("flux_y");
+    auto& flux_z = repo.get_field("flux_z");
+    const auto& tg_vof = repo.get_field("target_vof");
+    const auto& iblank = repo.get_int_field("iblank_cell");
+
+    amrex::Real pvscale = std::min(std::min(dx[0], dx[1]), dx[2]);
+    pvscale = amr_wind::overset_ops::calculate_pseudo_velocity_scale(
+        iblank(lev), dx, pvscale);
+    amrex::ParallelDescriptor::ReduceRealMin(pvscale);
+
+    amr_wind::overset_ops::process_vof_inactive(
+        vof(lev), sharpen_vof_tol, active);
+
+    amrex::Real err = 0.0;
+    for (int n = 0; n < n_iterations; ++n) {
+        amr_wind::overset_ops::populate_normal_vector(
+            norm(lev), vof(lev), iblank(lev), active);
+        amr_wind::overset_ops::populate_sharpen_fluxes(
+            flux_x(lev), flux_y(lev), flux_z(lev), vof(lev), tg_vof(lev),
+            norm(lev), velocity(lev), gp(lev), rho(lev), pvscale, margin,
+            sharpen_rho1, sharpen_rho2, active);
+        amr_wind::overset_ops::process_fluxes_calc_src(
+            flux_x(lev), flux_y(lev), flux_z(lev), p_src(lev), vof(lev),
+            iblank(lev), active);
+        err = amr_wind::overset_ops::measure_convergence(
+                  flux_x(lev), flux_y(lev), flux_z(lev), active) /
+              pvscale;
+        amrex::ParallelDescriptor::ReduceRealMax(err);
+
+        amrex::Real ptfac = 1.0;
+        ptfac = amrex::min(
+            ptfac, amr_wind::overset_ops::calculate_pseudo_dt_flux(
+                       flux_x(lev), flux_y(lev), flux_z(lev), vof(lev), dx,
+                       convg_tol, active));
+        amrex::ParallelDescriptor::ReduceRealMin(ptfac);
+        ptfac *= pCFL;
+
+        amr_wind::overset_ops::apply_fluxes(
+            flux_x(lev), flux_y(lev), flux_z(lev), p_src(lev), vof(lev),
+            rho(lev), velocity(lev), gp(lev), p(lev), dx, ptfac,
+            sharpen_vof_tol, active);
+        vof(lev).FillBoundary(geom.periodicity());
+        velocity(lev).FillBoundary(geom.periodicity());
+        gp(lev).FillBoundary(geom.periodicity());
+        set_density_via_vof(rho, vof);
+    }
+    return err;
+}
+} // namespace
+
+TEST_F(VOFOversetOps, restricted_sharpening)
+{
+    populate_parameters();
+    initialize_mesh();
+
+    auto& repo = sim().repo();
+    const int nghost = 3;
+    auto& vof = repo.declare_field("vof", 1, nghost);
+    repo.declare_field("target_vof", 1, nghost);
+    auto& rho = repo.declare_field("density", 1, nghost);
+    auto& velocity = repo.declare_field("velocity", 3, nghost);
+    auto& gp = repo.declare_field("gp", 3, 2);
+    auto& p = repo.declare_field("p", 1, 0, 1, amr_wind::FieldLoc::NODE);
+    repo.declare_field("p_src", 1, 0, 1, amr_wind::FieldLoc::NODE);
+    repo.declare_field("int_normal", 3, nghost - 1);
+    repo.declare_field("flux_x", 9, 1, 1, amr_wind::FieldLoc::XFACE);
+    repo.declare_field("flux_y", 9, 1, 1, amr_wind::FieldLoc::YFACE);
+    repo.declare_field("flux_z", 9, 1, 1, amr_wind::FieldLoc::ZFACE);
+    auto& iblank_cell = repo.declare_int_field("iblank_cell", 1, nghost);
+
+    // Fringe cells across the interface, spanning two boxes in x
+    iblank_cell.setVal(1);
+    run_algorithm(iblank_cell, [&](const int lev, const amrex::MFIter& mfi) {
+        const auto& ib = iblank_cell(lev).array(mfi);
+        amrex::ParallelFor(
+            mfi.growntilebox(),
+            [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                if (i >= 2 && i <= 5 && j >= 1 && j <= 2 && k >= 1 && k <= 2) {
+                    ib(i, j, k) = -1;
+                }
+            });
+    });
+    const auto active =
+        amr_wind::overset_ops::fringe_box_flags(iblank_cell(0), 1);
+    int nactive = 0;
+    for (const int flag : active) {
+        nactive += flag;
+    }
+    ASSERT_EQ(nactive, 2);
+
+    // Sharpen only in the fringe boxes and keep the results
+    constexpr int n_iterations = 10;
+    init_sharpen_fields(repo);
+    const amrex::Real err_restricted =
+        run_sharpening(repo, active, n_iterations);
+    const auto& ba = vof(0).boxArray();
+    const auto& dm = vof(0).DistributionMap();
+    amrex::MultiFab vof_r(ba, dm, 1, 0);
+    amrex::MultiFab rho_r(ba, dm, 1, 0);
+    amrex::MultiFab vel_r(ba, dm, 3, 0);
+    amrex::MultiFab gp_r(ba, dm, 3, 0);
+    amrex::MultiFab p_r(p(0).boxArray(), dm, 1, 0);
+    amrex::MultiFab::Copy(vof_r, vof(0), 0, 0, 1, 0);
+    amrex::MultiFab::Copy(rho_r, rho(0), 0, 0, 1, 0);
+    amrex::MultiFab::Copy(vel_r, velocity(0), 0, 0, 3, 0);
+    amrex::MultiFab::Copy(gp_r, gp(0), 0, 0, 3, 0);
+    amrex::MultiFab::Copy(p_r, p(0), 0, 0, 1, 0);
+
+    // Sharpen the same fields over the full domain
+    init_sharpen_fields(repo);
+    const amrex::Real err_full = run_sharpening(repo, {}, n_iterations);
+
+    // The fluxes must be nonzero for a meaningful comparison
+    EXPECT_GT(err_full, 0.0);
+    const amrex::Real tol = 1e-12;
+    EXPECT_NEAR(err_restricted, err_full, tol * err_full);
+
+    const auto max_diff = [](amrex::MultiFab& ref, const amrex::MultiFab& mf) {
+        amrex::MultiFab::Subtract(ref, mf, 0, 0, ref.nComp(), 0);
+        amrex::Real diff = 0.0;
+        for (int n = 0; n < ref.nComp(); ++n) {
+            diff = std::max(diff, ref.norm0(n));
+        }
+        return diff;
+    };
+    EXPECT_NEAR(max_diff(vof_r, vof(0)), 0.0, tol);
+    EXPECT_NEAR(max_diff(rho_r, rho(0)), 0.0, tol * sharpen_rho1);
+    EXPECT_NEAR(max_diff(vel_r, velocity(0)), 0.0, tol);
+    EXPECT_NEAR(max_diff(gp_r, gp(0)), 0.0, tol);
+    EXPECT_NEAR(max_diff(p_r, p(0)), 0.0, tol);
+
+    // Values within the tolerance are bounded in either path
+    EXPECT_DOUBLE_EQ(vof(0).min(0), 0.0);
+    EXPECT_DOUBLE_EQ(vof(0).max(0), 1.0);
+}
+
 } // namespace amr_wind_tests
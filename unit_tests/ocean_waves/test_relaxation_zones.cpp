@@ -3,6 +3,7 @@
 #include "aw_test_utils/test_utils.H"
 #include "amr-wind/ocean_waves/utils/wave_utils_K.H"
 #include "amr-wind/ocean_waves/OceanWaves.H"
+#include "amr-wind/ocean_waves/relaxation_zones/relaxation_zones_ops.H"
 #include "amr-wind/utilities/constants.H"
 #include "amr-wind/physics/multiphase/MultiPhase.H"
 #include "amr-wind/equation_systems/icns/icns_advection.H"
@@ -376,6 +377,41 @@ TEST_F(OceanWavesOpTest, gas_phase)
     EXPECT_NEAR(error_total, 0.0, tol);
 }
 
+TEST_F(OceanWavesOpTest, target_box_masks)
+{
+    const amrex::Box domain(
+        amrex::IntVect{0, 0, 0}, amrex::IntVect{63, 15, 15});
+    const amrex::RealBox rbox({0.0, -1.0, -1.0}, {8.0, 1.0, 1.0});
+    const amrex::Array<int, AMREX_SPACEDIM> periodic{0, 0, 0};
+    const amrex::Geometry geom(domain, rbox, 0, periodic);
+
+    amr_wind::ocean_waves::RelaxZonesBaseData wdata;
+    wdata.gen_length = 2.0;
+    wdata.beach_length = 4.0;
+    wdata.has_beach = true;
+
+    const int ng = 3;
+    const auto make_box = [ng](int ilo, int ihi, int klo) {
+        return amrex::grow(
+            amrex::Box(
+                amrex::IntVect{ilo, 4, klo}, amrex::IntVect{ihi, 11, klo + 7}),
+            ng);
+    };
+    namespace rz = amr_wind::ocean_waves::relaxation_zones;
+
+    // Interior box away from zones and boundaries
+    EXPECT_FALSE(rz::box_needs_target_fields(make_box(20, 27, 4), geom, wdata));
+    // Generation zone
+    EXPECT_TRUE(rz::box_needs_target_fields(make_box(12, 19, 4), geom, wdata));
+    // Numerical beach
+    EXPECT_TRUE(rz::box_needs_target_fields(make_box(30, 37, 4), geom, wdata));
+    // Ghost cells outside the domain
+    EXPECT_TRUE(rz::box_needs_target_fields(make_box(20, 27, 0), geom, wdata));
+    // Lateral zones
+    wdata.zone_length_y = 0.5;
+    EXPECT_TRUE(rz::box_needs_target_fields(make_box(20, 27, 4), geom, wdata));
+}
+
 TEST_F(OceanWavesOpTest, boundary_fill)
 {
 
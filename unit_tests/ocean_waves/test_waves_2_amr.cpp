@@ -312,4 +312,83 @@ TEST_F(OceanWavesW2ATest, time_interp)
     EXPECT_NEAR(fmin2, 0.5, 1e-10);
 }
 
+TEST_F(OceanWavesW2ATest, mode_prefetch)
+{
+    amr_wind::ocean_waves::W2AWaves::MetaType wdata;
+    wdata.is_ocean = true;
+    ASSERT_TRUE(wdata.c_rmodes.initialize(AMR_WIND_W2A_TEST_MODES, true));
+    const int vsize = wdata.c_rmodes.get_vector_size();
+    const std::complex<double> initval{0.0, 0.0};
+    wdata.c_mX.resize(vsize, initval);
+    wdata.c_mY.resize(vsize, initval);
+    wdata.c_mZ.resize(vsize, initval);
+    wdata.c_mFS.resize(vsize, initval);
+    wdata.dt_modes = wdata.c_rmodes.get_dtout();
+
+    // Reference modes read synchronously by a separate reader
+    ReadModes<std::complex<double>> ref_rmodes;
+    ASSERT_TRUE(ref_rmodes.initialize(AMR_WIND_W2A_TEST_MODES, true));
+    std::vector<std::complex<double>> mX(vsize), mY(vsize), mZ(vsize),
+        mFS(vsize);
+    const auto check_modes = [&](const int nstep) {
+        ASSERT_TRUE(ref_rmodes.get_data(nstep, mX, mY, mZ, mFS));
+        for (int n = 0; n < vsize; ++n) {
+            EXPECT_EQ(wdata.c_mX[n], mX[n]);
+            EXPECT_EQ(wdata.c_mY[n], mY[n]);
+            EXPECT_EQ(wdata.c_mZ[n], mZ[n]);
+            EXPECT_EQ(wdata.c_mFS[n], mFS[n]);
+        }
+    };
+
+    // Prefetch the next step and look up a step while the read is running
+    const int nstep = 1;
+    launch_mode_prefetch(wdata, nstep);
+    EXPECT_TRUE(wdata.prefetch_status.valid());
+    const amrex::Real time = nstep * wdata.dt_modes;
+    EXPECT_EQ(time_to_step(wdata, time), ref_rmodes.time2step(time, 0));
+    EXPECT_TRUE(get_mode_data(wdata, nstep));
+    EXPECT_FALSE(wdata.prefetch_status.valid());
+    check_modes(nstep);
+
+    // Modes prefetched for another step are discarded
+    launch_mode_prefetch(wdata, nstep + 2);
+    EXPECT_TRUE(get_mode_data(wdata, nstep + 1));
+    check_modes(nstep + 1);
+
+    // Disabled prefetch reads synchronously
+    wdata.prefetch_modes = false;
+    launch_mode_prefetch(wdata, nstep + 2);
+    EXPECT_FALSE(wdata.prefetch_status.valid());
+    EXPECT_TRUE(get_mode_data(wdata, nstep + 2));
+    check_modes(nstep + 2);
+}
+
+TEST_F(OceanWavesW2ATest, step_lookup_during_prefetch)
+{
+    amr_wind::ocean_waves::W2AWaves::MetaType wdata;
+    wdata.is_ocean = true;
+    ASSERT_TRUE(wdata.c_rmodes.initialize(AMR_WIND_W2A_TEST_MODES, true));
+    wdata.dt_modes = wdata.c_rmodes.get_dtout();
+    ReadModes<std::complex<double>> ref_rmodes;
+    ASSERT_TRUE(ref_rmodes.initialize(AMR_WIND_W2A_TEST_MODES, true));
+
+    // Stand-in for a background read that has not completed; a lookup that
+    // waits for it would never return
+    std::promise<bool> pending_read;
+    wdata.prefetch_status = pending_read.get_future();
+
+    // Times on and in the middle of the output intervals of the modes
+    for (const amrex::Real fac : {0.0, 0.5, 1.0, 1.25, 2.0, 2.999, 3.0}) {
+        const amrex::Real time = fac * wdata.dt_modes;
+        EXPECT_EQ(time_to_step(wdata, time), ref_rmodes.time2step(time, 0));
+    }
+    EXPECT_TRUE(wdata.prefetch_status.valid());
+
+    // The pending read is only joined when modes are read
+    pending_read.set_value(false);
+    EXPECT_EQ(
+        wdata.prefetch_status.wait_for(std::chrono::seconds(0)),
+        std::future_status::ready);
+}
+
 } // namespace amr_wind_tests
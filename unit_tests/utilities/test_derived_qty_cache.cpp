@@ -0,0 +1,100 @@
+#include "aw_test_utils/MeshTest.H"
+#include "amr-wind/utilities/DerivedQuantity.H"
+
+namespace amr_wind_tests {
+
+namespace {
+
+void init_velocity(amr_wind::Field& vel, const amrex::Real slope)
+{
+    const auto& geom = vel.repo().mesh().Geom();
+    const int nlevels = vel.repo().num_active_levels();
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto& dx = geom[lev].CellSizeArray();
+        const auto& problo = geom[lev].ProbLoArray();
+        const auto& varrs = vel(lev).arrays();
+        amrex::ParallelFor(
+            vel(lev), vel.num_grow(),
+            [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
+                const amrex::Real y = problo[1] + (j + 0.5) * dx[1];
+                varrs[nbx](i, j, k, 0) = slope * y;
+                varrs[nbx](i, j, k, 1) = 0.0;
+                varrs[nbx](i, j, k, 2) = 0.0;
+            });
+    }
+    amrex::Gpu::streamSynchronize();
+}
+
+amrex::Real
+max_error(const amr_wind::ScratchField& fld, const amrex::Real expected)
+{
+    amrex::Real err = 0.0;
+    for (int lev = 0; lev < fld.repo().num_active_levels(); ++lev) {
+        const auto& farrs = fld(lev).const_arrays();
+        err = amrex::max(
+            err,
+            amrex::ParReduce(
+                amrex::TypeList<amrex::ReduceOpMax>{},
+                amrex::TypeList<amrex::Real>{}, fld(lev), amrex::IntVect(0),
+                [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k)
+                    -> amrex::GpuTuple<amrex::Real> {
+                    return std::abs(farrs[nbx](i, j, k, 0) - expected);
+                }));
+    }
+    amrex::ParallelDescriptor::ReduceRealMax(err);
+    return err;
+}
+
+} // namespace
+
+class DerivedQtyCacheTest : public MeshTest
+{};
+
+TEST_F(DerivedQtyCacheTest, shared_quantities)
+{
+    constexpr amrex::Real tol = 1.0e-12;
+    initialize_mesh();
+    auto& repo = sim().repo();
+    auto& vel = repo.declare_field("velocity", AMREX_SPACEDIM, 1);
+    init_velocity(vel, 2.0);
+
+    auto& cache = sim().derived_cache();
+    amr_wind::DerivedQtyMgr mgr1(repo, &cache);
+    mgr1.create("mag_vorticity");
+    auto fld1 = repo.create_scratch_field(mgr1.num_comp(), 1);
+
+    // A quantity with a single consumer is not cached
+    mgr1(*fld1, 0);
+    EXPECT_EQ(cache.num_entries(), 0);
+    EXPECT_NEAR(max_error(*fld1, 2.0), 0.0, tol);
+
+    amr_wind::DerivedQtyMgr mgr2(repo, &cache);
+    mgr2.create("mag_vorticity");
+    mgr2.create("grad(velocity)");
+    auto fld2 = repo.create_scratch_field(mgr2.num_comp(), 1);
+    mgr1(*fld1, 0);
+    mgr2(*fld2, 0);
+    EXPECT_EQ(cache.num_entries(), 1);
+    EXPECT_NEAR(max_error(*fld2, 2.0), 0.0, tol);
+
+    // The cached value is reused within the same time index
+    init_velocity(vel, 3.0);
+    mgr2(*fld2, 0);
+    EXPECT_NEAR(max_error(*fld2, 2.0), 0.0, tol);
+
+    // and recomputed for a new time index
+    ++sim().time().time_index();
+    mgr2(*fld2, 0);
+    EXPECT_NEAR(max_error(*fld2, 3.0), 0.0, tol);
+
+    cache.clear();
+    EXPECT_EQ(cache.num_entries(), 0);
+
+    // Removing a consumer stops the caching
+    mgr2.filter(amrex::Vector<std::string>{"mag_vorticity"});
+    mgr1(*fld1, 0);
+    EXPECT_EQ(cache.num_entries(), 0);
+    EXPECT_EQ(mgr2.num_comp(), AMREX_SPACEDIM * AMREX_SPACEDIM);
+}
+
+} // namespace amr_wind_tests
@@ -301,6 +301,16 @@ TEST_F(FieldNormsTest, levelmask_on)
         std::sqrt((m_ncell0 * 8.) * (m_cv0 / 8.) * m_w * m_w / m_dv);
     tool.check_output(unorm, vnorm, wnorm);
 
+    // Reductions batched by the post-processing manager give the same result
+    amr_wind::GlobalReductions reductions;
+    tool.add_local_reductions(reductions);
+    EXPECT_EQ(reductions.num_sums(), 3);
+    EXPECT_EQ(reductions.num_maxs(), 0);
+    reductions.reduce();
+    tool.apply_batched_reductions(reductions);
+    tool.output_actions();
+    tool.check_output(unorm, vnorm, wnorm);
+
     // Change scalar for determining refinement - no fine level
     flag.setVal(0.0);
 
@@ -832,4 +832,78 @@ TEST_F(FreeSurfaceTest, point_diffuse_in_single_phase)
     EXPECT_NEAR(ht, ht_est, 5e-2);
 }
 
+TEST_F(FreeSurfaceTest, search_window)
+{
+    populate_parameters();
+    {
+        // Columns span several boxes in the search direction
+        amrex::ParmParse pp("amr");
+        pp.add("max_grid_size", 16);
+    }
+    initialize_mesh();
+    auto& repo = sim().repo();
+    auto& vof = repo.declare_field("vof", 1, 2);
+
+    // Identical samplers, one of them searching around the previous heights
+    const amrex::Real window = 3.0;
+    for (const auto* key : {"fsfull", "fswindow"}) {
+        amrex::ParmParse pp(key);
+        pp.add("num_instances", 3);
+        pp.addarr("plane_num_points", amrex::Vector<int>{npts, npts});
+        pp.addarr("plane_start", m_pl_start);
+        pp.addarr("plane_end", m_pl_end);
+    }
+    {
+        amrex::ParmParse pp("fswindow");
+        pp.add("search_window", window);
+    }
+    FreeSurfaceImpl full(sim());
+    full.label() = "full";
+    full.initialize("fsfull");
+    FreeSurfaceImpl windowed(sim());
+    windowed.label() = "window";
+    windowed.initialize("fswindow");
+
+    // The windowed search must find the heights of the full search
+    auto update_and_compare = [&](const std::string& state) {
+        full.update_sampling_locations();
+        windowed.update_sampling_locations();
+        const auto hfull = full.heights();
+        const auto hwin = windowed.heights();
+        ASSERT_EQ(hwin.size(), hfull.size());
+        for (int n = 0; n < static_cast<int>(hfull.size()); ++n) {
+            EXPECT_EQ(hwin[n], hfull[n]) << state << ", point " << n;
+        }
+    };
+
+    // Interfaces moving within the window, exactly to its upper and lower
+    // edges and down beyond it, sometimes onto cell faces. An interface
+    // moving up beyond the window is not supported by the windowed search.
+    const amrex::Real wl0 = m_probhi[2] * 2 / 3;
+    const amrex::Real wl1 = m_probhi[2] / 2;
+    const amrex::Real wl2 = m_probhi[2] / 5;
+    for (const amrex::Real shift : {0.0, 1.0, 1.0 + window, 1.0, -6.0}) {
+        init_vof_multival(vof, wl0 + shift, wl1 + shift, wl2 + shift);
+        update_and_compare("shift " + std::to_string(shift));
+        EXPECT_EQ(full.check_output(0, "~", wl0 + shift), npts * npts);
+        EXPECT_EQ(full.check_output(1, "~", wl1 + shift), npts * npts);
+        EXPECT_EQ(full.check_output(2, "~", wl2 + shift), npts * npts);
+    }
+
+    // The upper interface leaves the window and the lower instances vanish
+    init_vof(vof, wl1);
+    update_and_compare("single interface");
+    EXPECT_EQ(full.check_output(0, "~", wl1), npts * npts);
+    EXPECT_EQ(full.check_output(1, "=", m_problo[2]), npts * npts);
+    EXPECT_EQ(full.check_output(2, "=", m_problo[2]), npts * npts);
+
+    // The lower instances reappear while the upper one stays in the window
+    const amrex::Real wl0_new = wl1 + 1.0;
+    init_vof_multival(vof, wl0_new, wl2 + 20.0, wl2);
+    update_and_compare("instances restored");
+    EXPECT_EQ(full.check_output(0, "~", wl0_new), npts * npts);
+    EXPECT_EQ(full.check_output(1, "~", wl2 + 20.0), npts * npts);
+    EXPECT_EQ(full.check_output(2, "~", wl2), npts * npts);
+}
+
 } // namespace amr_wind_tests
@@ -0,0 +1,78 @@
+#include "aw_test_utils/AmrexTest.H"
+
+#include "amr-wind/utilities/io_utils.H"
+#include "AMReX_MultiFab.H"
+
+namespace amr_wind_tests {
+
+namespace {
+
+amrex::BoxArray make_box_array(const int max_grid_size)
+{
+    const amrex::Box domain(
+        amrex::IntVect(0), amrex::IntVect(AMREX_D_DECL(47, 31, 15)));
+    amrex::BoxArray ba(domain);
+    ba.maxSize(max_grid_size);
+    return ba;
+}
+
+} // namespace
+
+TEST(IOUtils, overlap_distribution_map_same_layout)
+{
+    const auto ba = make_box_array(16);
+    const amrex::DistributionMapping dm(ba);
+    const auto dm_ovlp =
+        amr_wind::ioutils::overlap_distribution_map(ba, ba, dm);
+    EXPECT_EQ(dm_ovlp, dm);
+}
+
+TEST(IOUtils, overlap_distribution_map_repartition)
+{
+    // Checkpoint written with larger grids than the new layout
+    const auto ba_src = make_box_array(16);
+    const auto ba_dst = make_box_array(8);
+    const amrex::DistributionMapping dm_dst(ba_dst);
+    const auto dm_src =
+        amr_wind::ioutils::overlap_distribution_map(ba_src, ba_dst, dm_dst);
+    ASSERT_EQ(dm_src.size(), ba_src.size());
+
+    // Each source box is owned by the rank with the largest overlap
+    std::vector<std::pair<int, amrex::Box>> isects;
+    for (int i = 0; i < static_cast<int>(ba_src.size()); ++i) {
+        amrex::Vector<amrex::Long> overlap(
+            amrex::ParallelDescriptor::NProcs(), 0);
+        ba_dst.intersections(ba_src[i], isects);
+        for (const auto& is : isects) {
+            overlap[dm_dst[is.first]] += is.second.numPts();
+        }
+        for (const auto novlp : overlap) {
+            EXPECT_LE(novlp, overlap[dm_src[i]]);
+        }
+    }
+
+    // Data read on the source layout is recovered on the new layout
+    amrex::MultiFab src(ba_src, dm_src, 1, 0);
+    amrex::MultiFab dst(ba_dst, dm_dst, 1, 0);
+    const auto& sarrs = src.arrays();
+    amrex::ParallelFor(
+        src, [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
+            sarrs[nbx](i, j, k) = i + 100.0 * j + 10000.0 * k;
+        });
+    dst.setVal(-1.0);
+    dst.ParallelCopy(src);
+
+    const auto& darrs = dst.const_arrays();
+    amrex::Real err = amrex::ParReduce(
+        amrex::TypeList<amrex::ReduceOpMax>{}, amrex::TypeList<amrex::Real>{},
+        dst, amrex::IntVect(0),
+        [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k)
+            -> amrex::GpuTuple<amrex::Real> {
+            return std::abs(
+                darrs[nbx](i, j, k) - (i + 100.0 * j + 10000.0 * k));
+        });
+    amrex::ParallelDescriptor::ReduceRealMax(err);
+    EXPECT_NEAR(err, 0.0, 1.0e-12);
+}
+
+} // namespace amr_wind_tests
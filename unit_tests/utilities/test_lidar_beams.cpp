@@ -0,0 +1,182 @@
+#include "aw_test_utils/MeshTest.H"
+#include "amr-wind/utilities/sampling/LidarBeams.H"
+
+namespace amr_wind_tests {
+
+namespace {
+
+//! Velocity field (x, y, 0) including the ghost cells
+void init_velocity(amr_wind::Field& vel)
+{
+    const auto& geom = vel.repo().mesh().Geom();
+    for (int lev = 0; lev < vel.repo().num_active_levels(); ++lev) {
+        const auto& dx = geom[lev].CellSizeArray();
+        const auto& problo = geom[lev].ProbLoArray();
+        const auto& farrs = vel(lev).arrays();
+        amrex::ParallelFor(
+            vel(lev), vel.num_grow(),
+            [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
+                farrs[nbx](i, j, k, 0) = problo[0] + (i + 0.5) * dx[0];
+                farrs[nbx](i, j, k, 1) = problo[1] + (j + 0.5) * dx[1];
+                farrs[nbx](i, j, k, 2) = 0.0;
+            });
+    }
+    amrex::Gpu::streamSynchronize();
+}
+
+class LidarBeamsImpl : public amr_wind::sampling::LidarBeams
+{
+public:
+    LidarBeamsImpl(amr_wind::CFDSim& sim, const std::string& label)
+        : amr_wind::sampling::LidarBeams(sim, label)
+    {}
+
+protected:
+    // No file output during test
+    void prepare_ascii_file() override {}
+    void write_ascii() override {}
+};
+
+void add_lidar(
+    const std::string& key,
+    const amrex::Vector<amrex::Real>& origin,
+    const amrex::Real azimuth,
+    const amrex::Real length,
+    const int num_gates,
+    const int points_per_gate)
+{
+    amrex::ParmParse pp(key);
+    pp.addarr("origin", origin);
+    pp.add("length", length);
+    pp.add("num_gates", num_gates);
+    pp.add("points_per_gate", points_per_gate);
+    pp.addarr("time_table", amrex::Vector<amrex::Real>{0.0, 10.0});
+    pp.addarr("azimuth_table", amrex::Vector<amrex::Real>{azimuth, azimuth});
+    pp.addarr("elevation_table", amrex::Vector<amrex::Real>{0.0, 0.0});
+}
+
+} // namespace
+
+class LidarBeamsTest : public MeshTest
+{
+protected:
+    void populate_parameters() override
+    {
+        MeshTest::populate_parameters();
+        amrex::ParmParse pp("amr");
+        pp.add("max_grid_size", 4);
+        pp.add("blocking_factor", 4);
+    }
+};
+
+TEST_F(LidarBeamsTest, range_gates)
+{
+    initialize_mesh();
+    auto& vel = sim().repo().declare_field("velocity", 3, 1);
+    init_velocity(vel);
+
+    {
+        amrex::ParmParse pp("lidar");
+        pp.addarr(
+            "labels", amrex::Vector<std::string>{"xbeam", "ybeam", "far"});
+    }
+    add_lidar("lidar.xbeam", {0.0, 4.1, 4.3}, 0.0, 8.0, 4, 2);
+    add_lidar("lidar.ybeam", {2.3, 0.0, 4.3}, 90.0, 6.0, 3, 1);
+    add_lidar("lidar.far", {0.0, 4.1, 4.3}, 0.0, 16.0, 2, 4);
+
+    LidarBeamsImpl tool(sim(), "lidar");
+    tool.initialize();
+    tool.output_actions();
+
+    const auto& los = tool.los_velocity();
+    ASSERT_EQ(los.size(), 9U);
+    const amrex::Real tol = 1.0e-12;
+
+    // The line-of-sight velocity of the linear field averaged over each gate
+    // is the position of the gate center along the beam
+    const int xoff = tool.gate_offset(0);
+    for (int ig = 0; ig < 4; ++ig) {
+        EXPECT_NEAR(los[xoff + ig], 2.0 * ig + 1.0, tol);
+    }
+    const int yoff = tool.gate_offset(1);
+    for (int ig = 0; ig < 3; ++ig) {
+        EXPECT_NEAR(los[yoff + ig], 2.0 * ig + 1.0, tol);
+    }
+
+    // Gates beyond the domain have no samples
+    const int foff = tool.gate_offset(2);
+    EXPECT_NEAR(los[foff], 4.0, tol);
+    EXPECT_TRUE(std::isnan(los[foff + 1]));
+}
+
+TEST_F(LidarBeamsTest, cone_rays)
+{
+    initialize_mesh();
+    auto& vel = sim().repo().declare_field("velocity", 3, 1);
+    vel.setVal(1.0, 0, 1, 1);
+    vel.setVal(0.5, 1, 1, 1);
+    vel.setVal(0.0, 2, 1, 1);
+
+    const amrex::Real cone_angle = 10.0;
+    {
+        amrex::ParmParse pp("lidar");
+        pp.addarr("labels", amrex::Vector<std::string>{"cone"});
+    }
+    add_lidar("lidar.cone", {0.5, 4.0, 4.0}, 0.0, 6.0, 3, 2);
+    {
+        amrex::ParmParse pp("lidar.cone");
+        pp.add("cone_angle", cone_angle);
+        pp.add("num_cone_rays", 4);
+    }
+
+    LidarBeamsImpl tool(sim(), "lidar");
+    tool.initialize();
+    tool.output_actions();
+
+    // The transverse velocity cancels out between opposite rays of the cone
+    const auto& los = tool.los_velocity();
+    ASSERT_EQ(los.size(), 3U);
+    const amrex::Real expected = std::cos(cone_angle * M_PI / 180.0);
+    for (const auto val : los) {
+        EXPECT_NEAR(val, expected, 1.0e-12);
+    }
+}
+
+TEST_F(LidarBeamsTest, scan_time)
+{
+    {
+        amrex::ParmParse pp("time");
+        pp.add("fixed_dt", 2.5);
+    }
+    initialize_mesh();
+    auto& vel = sim().repo().declare_field("velocity", 3, 1);
+    vel.setVal(1.0, 0, 1, 1);
+    vel.setVal(0.0, 1, 2, 1);
+
+    {
+        amrex::ParmParse pp("lidar");
+        pp.addarr("labels", amrex::Vector<std::string>{"scan"});
+    }
+    add_lidar("lidar.scan", {0.5, 0.5, 4.0}, 0.0, 4.0, 2, 2);
+    {
+        amrex::ParmParse pp("lidar.scan");
+        pp.addarr("azimuth_table", amrex::Vector<amrex::Real>{0.0, 90.0});
+    }
+
+    LidarBeamsImpl tool(sim(), "lidar");
+    tool.initialize();
+
+    // The beams are positioned at the end of the step, when output happens
+    time().new_timestep();
+    time().advance_time();
+    tool.output_actions();
+
+    const auto& los = tool.los_velocity();
+    ASSERT_EQ(los.size(), 2U);
+    const amrex::Real expected = std::cos(22.5 * M_PI / 180.0);
+    for (const auto val : los) {
+        EXPECT_NEAR(val, expected, 1.0e-12);
+    }
+}
+
+} // namespace amr_wind_tests
@@ -60,6 +60,38 @@ TEST(LinearInterpolation, bisection_search)
     }
 }
 
+TEST(LinearInterpolation, uniform_search)
+{
+    namespace interp = amr_wind::interp;
+    std::vector<amrex::Real> xvec(10);
+    std::iota(xvec.begin(), xvec.end(), 0.0);
+
+    const auto* start = xvec.data();
+    const auto* end = xvec.data() + xvec.size();
+    {
+        const auto idx = interp::uniform_search(start, end, 5.0);
+        EXPECT_EQ(idx.idx, 4);
+        EXPECT_EQ(idx.lim, interp::Limits::VALID);
+    }
+    {
+        const auto idx = interp::uniform_search(start, end, -1.0);
+        EXPECT_EQ(idx.idx, 0);
+        EXPECT_EQ(idx.lim, interp::Limits::LOWLIM);
+    }
+    {
+        const auto idx = interp::uniform_search(start, end, 9.1);
+        EXPECT_EQ(idx.idx, 9);
+        EXPECT_EQ(idx.lim, interp::Limits::UPLIM);
+    }
+    for (int n = 0; n < 100; ++n) {
+        const amrex::Real xinp = 9.0 * amrex::Random();
+        const auto idx = interp::uniform_search(start, end, xinp);
+        const auto ref = interp::bisection_search(start, end, xinp);
+        EXPECT_EQ(idx.idx, ref.idx);
+        EXPECT_EQ(idx.lim, ref.lim);
+    }
+}
+
 TEST(LinearInterpolation, nearest_search)
 {
     namespace interp = amr_wind::interp;
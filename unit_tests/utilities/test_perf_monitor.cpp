@@ -0,0 +1,165 @@
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include "aw_test_utils/MeshTest.H"
+#include "amr-wind/CFDSim.H"
+#include "amr-wind/utilities/PerfMonitor.H"
+
+namespace amr_wind_tests {
+
+namespace {
+
+//! Deactivate the shared timer registry when the test exits
+struct RegistryGuard
+{
+    explicit RegistryGuard(const bool active)
+    {
+        amr_wind::perf::TimerRegistry::instance().set_active(active);
+    }
+
+    ~RegistryGuard()
+    {
+        amr_wind::perf::TimerRegistry::instance().set_active(false);
+    }
+
+    RegistryGuard(const RegistryGuard&) = delete;
+    RegistryGuard& operator=(const RegistryGuard&) = delete;
+    RegistryGuard(RegistryGuard&&) = delete;
+    RegistryGuard& operator=(RegistryGuard&&) = delete;
+};
+
+} // namespace
+
+class PerfMonitorTest : public MeshTest
+{};
+
+TEST_F(PerfMonitorTest, scoped_timer_accumulation)
+{
+    const RegistryGuard guard(true);
+    auto& registry = amr_wind::perf::TimerRegistry::instance();
+    const std::string name = "test_perf::accumulation";
+
+    for (int i = 0; i < 3; ++i) {
+        const amr_wind::perf::ScopedTimer timer(name);
+    }
+    ASSERT_EQ(registry.timers().count(name), 1);
+    const auto& timer = registry.timers().at(name);
+    EXPECT_EQ(timer.step_calls, 3);
+    EXPECT_GE(timer.step_time, 0.0);
+    EXPECT_DOUBLE_EQ(timer.total_time, timer.step_time);
+
+    // The step is moved to the summary window and the total is kept
+    const amrex::Real step1 = timer.step_time;
+    registry.end_step();
+    EXPECT_EQ(timer.step_calls, 0);
+    EXPECT_DOUBLE_EQ(timer.step_time, 0.0);
+    EXPECT_DOUBLE_EQ(timer.window_time, step1);
+    EXPECT_DOUBLE_EQ(timer.window_max, step1);
+
+    {
+        const amr_wind::perf::ScopedTimer second(name);
+    }
+    const amrex::Real step2 = timer.step_time;
+    registry.end_step();
+    EXPECT_DOUBLE_EQ(timer.window_time, step1 + step2);
+    EXPECT_DOUBLE_EQ(timer.window_max, amrex::max(step1, step2));
+    EXPECT_DOUBLE_EQ(timer.total_time, step1 + step2);
+
+    registry.reset_window();
+    EXPECT_DOUBLE_EQ(timer.window_time, 0.0);
+    EXPECT_DOUBLE_EQ(timer.window_max, 0.0);
+    EXPECT_DOUBLE_EQ(timer.total_time, step1 + step2);
+}
+
+TEST_F(PerfMonitorTest, timer_label)
+{
+    auto& registry = amr_wind::perf::TimerRegistry::instance();
+    const std::string name = "test_perf::label";
+    int nlabels = 0;
+    const auto label = [&]() {
+        ++nlabels;
+        return name;
+    };
+
+    // The label is not built and nothing is recorded when inactive
+    {
+        const RegistryGuard guard(false);
+        AMR_WIND_PERF_TIMER(label());
+    }
+    EXPECT_EQ(nlabels, 0);
+    EXPECT_EQ(registry.timers().count(name), 0);
+
+    {
+        const RegistryGuard guard(true);
+        AMR_WIND_PERF_TIMER(label());
+    }
+    EXPECT_EQ(nlabels, 1);
+    ASSERT_EQ(registry.timers().count(name), 1);
+    EXPECT_EQ(registry.timers().at(name).step_calls, 1);
+    registry.end_step();
+}
+
+TEST_F(PerfMonitorTest, reduced_csv_record)
+{
+    populate_parameters();
+    {
+        amrex::ParmParse pp("perf");
+        pp.add("enabled", true);
+        pp.add("format", (std::string) "csv");
+        pp.add("output_file", (std::string) "perf_monitor_test");
+        pp.add("track_memory", false);
+        pp.add("summary_interval", 1);
+    }
+    initialize_mesh();
+
+    const std::string name = "test_perf::record";
+    {
+        amr_wind::PerfMonitor monitor(sim());
+        monitor.initialize();
+        ASSERT_TRUE(monitor.enabled());
+        {
+            AMR_WIND_PERF_TIMER(name);
+        }
+        {
+            AMR_WIND_PERF_TIMER(name);
+        }
+        monitor.end_step(1.0);
+    }
+    EXPECT_FALSE(amr_wind::perf::TimerRegistry::instance().active());
+
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        std::ifstream ifh("perf_monitor_test.csv");
+        ASSERT_TRUE(ifh.good());
+        std::string line;
+        std::getline(ifh, line);
+        EXPECT_EQ(
+            line, "step,time,wall_time,region,step_time_max,step_time_min,"
+                  "calls");
+
+        int nfound = 0;
+        while (std::getline(ifh, line)) {
+            std::istringstream iss(line);
+            amrex::Vector<std::string> cols;
+            std::string col;
+            while (std::getline(iss, col, ',')) {
+                cols.push_back(col);
+            }
+            ASSERT_EQ(cols.size(), 7);
+            if (cols[3] != name) {
+                continue;
+            }
+            ++nfound;
+            const amrex::Real tmax = std::stod(cols[4]);
+            const amrex::Real tmin = std::stod(cols[5]);
+            EXPECT_GE(tmin, 0.0);
+            EXPECT_GE(tmax, tmin);
+            EXPECT_EQ(std::stoi(cols[6]), 2);
+        }
+        EXPECT_EQ(nfound, 1);
+        ifh.close();
+        std::remove("perf_monitor_test.csv");
+    }
+}
+
+} // namespace amr_wind_tests
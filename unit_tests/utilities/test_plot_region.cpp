@@ -0,0 +1,94 @@
+#include "aw_test_utils/MeshTest.H"
+#include "amr-wind/utilities/PlotRegion.H"
+
+#include "AMReX_FileSystem.H"
+#include "AMReX_PlotFileUtil.H"
+
+namespace amr_wind_tests {
+
+namespace {
+
+void init_field(amr_wind::Field& fld)
+{
+    const auto& geom = fld.repo().mesh().Geom();
+    const int nlevels = fld.repo().num_active_levels();
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto& dx = geom[lev].CellSizeArray();
+        const auto& problo = geom[lev].ProbLoArray();
+        const auto& farrs = fld(lev).arrays();
+        amrex::ParallelFor(
+            fld(lev),
+            [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
+                farrs[nbx](i, j, k, 0) = problo[0] + (i + 0.5) * dx[0];
+                farrs[nbx](i, j, k, 1) = problo[1] + (j + 0.5) * dx[1];
+            });
+    }
+    amrex::Gpu::streamSynchronize();
+}
+
+} // namespace
+
+class PlotRegionTest : public MeshTest
+{};
+
+TEST_F(PlotRegionTest, coarsened_sub_volume)
+{
+    initialize_mesh();
+    auto& repo = sim().repo();
+    auto& fld = repo.declare_field("coords", 2, 0);
+    repo.declare_field("unused", 1, 0);
+    init_field(fld);
+
+    {
+        amrex::ParmParse pp("io.box");
+        pp.addarr("lo", amrex::Vector<amrex::Real>{3.2, 2.0, 2.0});
+        pp.addarr("hi", amrex::Vector<amrex::Real>{5.5, 6.0, 6.0});
+        pp.add("coarsen", 2);
+        pp.addarr("outputs", amrex::Vector<std::string>{"coords"});
+    }
+
+    const std::string plt_prefix = "plt_region_test";
+    amr_wind::PlotRegion region(sim(), "box");
+    region.initialize(plt_prefix, {}, {}, {}, {});
+
+    // The region is extended to full coarse cells
+    const amrex::Box expected(amrex::IntVect(2), amrex::IntVect(5));
+    EXPECT_EQ(region.region_box(), expected);
+    ASSERT_EQ(region.var_names().size(), 2U);
+    EXPECT_EQ(region.var_names()[0], "coords0");
+
+    region.write_plot_file();
+    amrex::ParallelDescriptor::Barrier();
+
+    const std::string plt_file = amrex::Concatenate(
+        plt_prefix + "_box", sim().time().time_index());
+    {
+        amrex::PlotFileData pdata(plt_file);
+        EXPECT_EQ(pdata.finestLevel(), 0);
+        EXPECT_EQ(pdata.nComp(), 2);
+        EXPECT_EQ(pdata.probDomain(0), amrex::coarsen(expected, 2));
+        EXPECT_NEAR(pdata.probLo()[0], 2.0, 1.0e-12);
+        EXPECT_NEAR(pdata.probHi()[0], 6.0, 1.0e-12);
+
+        // Averages of the linear profiles are the coarse cell centers
+        const auto mf = pdata.get(0, "coords0");
+        const auto& farrs = mf.const_arrays();
+        amrex::Real err = amrex::ParReduce(
+            amrex::TypeList<amrex::ReduceOpMax>{},
+            amrex::TypeList<amrex::Real>{}, mf, amrex::IntVect(0),
+            [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k)
+                -> amrex::GpuTuple<amrex::Real> {
+                return std::abs(farrs[nbx](i, j, k) - (i + 0.5) * 2.0);
+            });
+        amrex::ParallelDescriptor::ReduceRealMax(err);
+        EXPECT_NEAR(err, 0.0, 1.0e-12);
+        EXPECT_EQ(mf.boxArray().numPts(), 8);
+    }
+
+    amrex::ParallelDescriptor::Barrier();
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        amrex::FileSystem::RemoveAll(plt_file);
+    }
+}
+
+} // namespace amr_wind_tests
@@ -9,6 +9,7 @@
 #include "amr-wind/utilities/sampling/DTUSpinnerSampler.H"
 #include "amr-wind/utilities/sampling/RadarSampler.H"
 #include "amr-wind/utilities/sampling/SamplingUtils.H"
+#include "amr-wind/utilities/ncutils/nc_interface.H"
 #include "AMReX_Vector.H"
 #include "amr-wind/core/vs/vector_space.H"
 #include "amr-wind/utilities/tensor_ops.H"
@@ -95,6 +96,34 @@ protected:
     }
 };
 
+class SamplingStageImpl : public amr_wind::sampling::Sampling
+{
+public:
+    SamplingStageImpl(amr_wind::CFDSim& sim, const std::string& label)
+        : amr_wind::sampling::Sampling(sim, label)
+    {}
+
+    //! Samples gathered directly from the container
+    std::vector<double> current_samples()
+    {
+        std::vector<double> buf(
+            num_total_particles() * var_names().size(), 0.0);
+        sampling_container().populate_buffer(buf);
+        return buf;
+    }
+
+    int num_writes{0};
+    int num_written{0};
+
+protected:
+    void prepare_netcdf_file() override {}
+    void write_staged_netcdf() override
+    {
+        ++num_writes;
+        num_written += num_staged_outputs();
+    }
+};
+
 } // namespace
 
 class SamplingTest : public MeshTest
@@ -284,6 +313,173 @@ TEST_F(SamplingTest, sampling_timing)
     EXPECT_TRUE(probes.write_flag);
 }
 
+#ifdef AMR_WIND_USE_NETCDF
+TEST_F(SamplingTest, output_staging)
+{
+    initialize_mesh();
+    auto& repo = sim().repo();
+    auto& vel = repo.declare_field("velocity", 3, 2);
+    init_field(vel);
+
+    {
+        amrex::ParmParse pp("sampling");
+        pp.add("output_interval", 1);
+        pp.add("output_stage_size", 2);
+        pp.addarr("labels", amrex::Vector<std::string>{"line1", "line2"});
+        pp.addarr("fields", amrex::Vector<std::string>{"velocity"});
+    }
+    {
+        amrex::ParmParse pp("sampling.line1");
+        pp.add("type", std::string("LineSampler"));
+        pp.add("num_points", 16);
+        pp.addarr("start", amrex::Vector<amrex::Real>{66.0, 66.0, 1.0});
+        pp.addarr("end", amrex::Vector<amrex::Real>{66.0, 66.0, 127.0});
+    }
+    {
+        amrex::ParmParse pp("sampling.line2");
+        pp.add("type", std::string("LineSampler"));
+        pp.add("num_points", 8);
+        pp.addarr("start", amrex::Vector<amrex::Real>{1.0, 60.0, 20.0});
+        pp.addarr("end", amrex::Vector<amrex::Real>{127.0, 60.0, 20.0});
+    }
+
+    SamplingStageImpl probes(sim(), "sampling");
+    probes.initialize();
+
+    // The first output is kept in memory
+    probes.output_actions();
+    EXPECT_EQ(probes.num_staged_outputs(), 1);
+    EXPECT_EQ(probes.num_writes, 0);
+    const auto ref = probes.current_samples();
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        const auto& staged = probes.staged_samples();
+        ASSERT_EQ(staged.size(), ref.size());
+        for (size_t i = 0; i < ref.size(); ++i) {
+            EXPECT_EQ(staged[i], ref[i]);
+        }
+    }
+
+    // Reaching the stage size writes all the staged outputs in order
+    sim().time().new_timestep();
+    probes.output_actions();
+    EXPECT_EQ(probes.num_writes, 1);
+    EXPECT_EQ(probes.num_written, 2);
+    EXPECT_EQ(probes.num_staged_outputs(), 0);
+
+    // Partially filled stages are written when flushed, and only once
+    sim().time().new_timestep();
+    probes.output_actions();
+    EXPECT_EQ(probes.num_staged_outputs(), 1);
+    EXPECT_EQ(probes.staged_times()[0], sim().time().new_time());
+    probes.flush_output();
+    probes.flush_output();
+    EXPECT_EQ(probes.num_writes, 2);
+    EXPECT_EQ(probes.num_written, 3);
+    EXPECT_EQ(probes.num_staged_outputs(), 0);
+}
+
+TEST_F(SamplingTest, output_staging_netcdf)
+{
+    {
+        amrex::ParmParse pp("time");
+        pp.add("fixed_dt", 0.5);
+    }
+    initialize_mesh();
+    auto& repo = sim().repo();
+    auto& vel = repo.declare_field("velocity", 3, 2);
+    init_field(vel);
+
+    // The same samplers are written every step and staged two at a time
+    const amrex::Vector<std::string> labels{"direct", "staged"};
+    for (const auto& label : labels) {
+        amrex::ParmParse pp(label);
+        pp.add("output_interval", 1);
+        pp.add("output_stage_size", label == "staged" ? 2 : 0);
+        pp.addarr("labels", amrex::Vector<std::string>{"line1", "line2"});
+        pp.addarr("fields", amrex::Vector<std::string>{"velocity"});
+    }
+    for (const auto& label : labels) {
+        {
+            amrex::ParmParse pp(label + ".line1");
+            pp.add("type", std::string("LineSampler"));
+            pp.add("num_points", 16);
+            pp.addarr("start", amrex::Vector<amrex::Real>{66.0, 66.0, 1.0});
+            pp.addarr("end", amrex::Vector<amrex::Real>{66.0, 66.0, 127.0});
+        }
+        {
+            amrex::ParmParse pp(label + ".line2");
+            pp.add("type", std::string("LineSampler"));
+            pp.add("num_points", 8);
+            pp.addarr("start", amrex::Vector<amrex::Real>{1.0, 60.0, 20.0});
+            pp.addarr("end", amrex::Vector<amrex::Real>{127.0, 60.0, 20.0});
+        }
+    }
+
+    amr_wind::sampling::Sampling direct(sim(), "direct");
+    amr_wind::sampling::Sampling staged(sim(), "staged");
+    direct.initialize();
+    staged.initialize();
+
+    // Three outputs of a field that changes every step: one full stage and
+    // one partially filled stage that is written when flushed
+    constexpr int nsteps = 3;
+    for (int step = 0; step < nsteps; ++step) {
+        time().new_timestep();
+        time().advance_time();
+        for (int lev = 0; lev < repo.num_active_levels(); ++lev) {
+            vel(lev).mult(2.0, 0, vel.num_comp(), vel.num_grow());
+        }
+        direct.output_actions();
+        staged.output_actions();
+    }
+    EXPECT_EQ(staged.num_staged_outputs(), 1);
+    staged.flush_output();
+    EXPECT_EQ(staged.num_staged_outputs(), 0);
+
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        const std::string post_dir =
+            sim().io_manager().post_processing_directory();
+        const std::string direct_name =
+            post_dir + "/" + amrex::Concatenate("direct", 0) + ".nc";
+        const std::string staged_name =
+            post_dir + "/" + amrex::Concatenate("staged", 0) + ".nc";
+        {
+            auto ref = ncutils::NCFile::open(direct_name, NC_NOWRITE);
+            auto ncf = ncutils::NCFile::open(staged_name, NC_NOWRITE);
+            const size_t nt = ncf.dim("num_time_steps").len();
+            ASSERT_EQ(nt, static_cast<size_t>(nsteps));
+            ASSERT_EQ(ref.dim("num_time_steps").len(), nt);
+
+            std::vector<double> ref_times(nt);
+            std::vector<double> times(nt);
+            ref.var("time").get(ref_times.data());
+            ncf.var("time").get(times.data());
+            for (size_t it = 0; it < nt; ++it) {
+                EXPECT_EQ(times[it], ref_times[it]);
+            }
+
+            for (const auto* line : {"line1", "line2"}) {
+                auto ref_grp = ref.group(line);
+                auto grp = ncf.group(line);
+                const size_t npts = grp.dim("num_points").len();
+                for (const auto& vname : staged.var_names()) {
+                    std::vector<double> ref_vals(nt * npts);
+                    std::vector<double> vals(nt * npts);
+                    ref_grp.var(vname).get(ref_vals.data());
+                    grp.var(vname).get(vals.data());
+                    for (size_t i = 0; i < vals.size(); ++i) {
+                        EXPECT_EQ(vals[i], ref_vals[i])
+                            << line << " " << vname << " at " << i;
+                    }
+                }
+            }
+        }
+        std::remove(direct_name.c_str());
+        std::remove(staged_name.c_str());
+    }
+}
+#endif
+
 TEST_F(SamplingTest, probe_sampler)
 {
     initialize_mesh();
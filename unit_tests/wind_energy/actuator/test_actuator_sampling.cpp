@@ -122,31 +122,23 @@ TEST_F(ActuatorTest, act_container)
     }
 
     ac.sample_fields(vel, density);
-    ac.Redistribute();
 
-    // Check to make sure that the velocity sampling gathered the particles back
-    // to their original MPI ranks
+    // Particles persist between position updates; move the points by a
+    // fraction of a cell so that only a local redistribution is performed
+    {
+        const amrex::Real dz = mesh().Geom(0).CellSize(2);
+        for (auto& pos : data.position) {
+            pos.z() += 0.25 * dz;
+        }
+    }
+    ac.update_positions();
+    ac.sample_fields(vel, density);
+
+    // Check that the particles were neither lost nor duplicated
 #ifndef AMREX_USE_GPU
     ASSERT_EQ(
         ac.num_actuator_points() * nprocs, ac.NumberOfParticlesAtLevel(0));
 #endif
-    {
-        using ParIter = amr_wind::actuator::ActuatorContainer::ParIterType;
-        int counter = 0;
-        int total_particles = 0;
-        const int lev = 0;
-        for (ParIter pti(ac, lev); pti.isValid(); ++pti) {
-            ++counter;
-            total_particles += pti.numParticles();
-        }
-
-        // All particles should have been recalled back to the same patch within
-        // each MPI rank
-        ASSERT_EQ(counter, 1);
-        // Total number of particles should be the same as what this MPI rank
-        // created
-        ASSERT_EQ(num_turbines * num_nodes, total_particles);
-    }
 
     // Check the interpolated velocity field
     {
@@ -2,6 +2,7 @@
 
 #include "amr-wind/wind_energy/actuator/aero/AirfoilTable.H"
 #include "amr-wind/utilities/trig_ops.H"
+#include "amr-wind/utilities/linear_interpolation.H"
 
 #include <string>
 
@@ -92,4 +93,47 @@ TEST(Airfoil, airfoil_lookup)
     }
 }
 
+TEST(Airfoil, airfoil_binned_lookup)
+{
+    using AirfoilLoader = ::amr_wind::actuator::AirfoilLoader;
+    auto ss = generate_openfast_airfoil();
+    auto af = AirfoilLoader::load_openfast_airfoil(ss);
+    EXPECT_GE(af->num_bins(), af->num_entries() - 1);
+
+    // Sample within, at the edges of, and outside the table range
+    const int npts = 97;
+    const amrex::Real aoa_lo = af->aoa().front() - 0.1;
+    const amrex::Real aoa_hi = af->aoa().back() + 0.1;
+    amrex::Vector<amrex::Real> aoa(npts);
+    for (int i = 0; i < npts; ++i) {
+        aoa[i] = aoa_lo + (aoa_hi - aoa_lo) * i / (npts - 1);
+    }
+    aoa.insert(aoa.end(), af->aoa().begin(), af->aoa().end());
+    const int ntot = static_cast<int>(aoa.size());
+
+    amrex::Vector<amrex::Real> cl(ntot), cd(ntot);
+    af->lookup(aoa, cl, cd);
+
+    amrex::Gpu::DeviceVector<amrex::Real> aoa_d(ntot), cm_d(ntot);
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, aoa.begin(), aoa.end(), aoa_d.begin());
+    const auto view = af->device_view();
+    const auto* aoa_ptr = aoa_d.data();
+    auto* cm_ptr = cm_d.data();
+    amrex::ParallelFor(ntot, [=] AMREX_GPU_DEVICE(int i) {
+        cm_ptr[i] = view(aoa_ptr[i]).z();
+    });
+    amrex::Vector<amrex::Real> cm(ntot);
+    amrex::Gpu::copy(
+        amrex::Gpu::deviceToHost, cm_d.begin(), cm_d.end(), cm.begin());
+
+    namespace interp = ::amr_wind::interp;
+    for (int i = 0; i < ntot; ++i) {
+        const auto polar = interp::linear(af->aoa(), af->polars(), aoa[i]);
+        EXPECT_NEAR(cl[i], polar.x(), 1.0e-12);
+        EXPECT_NEAR(cd[i], polar.y(), 1.0e-12);
+        EXPECT_NEAR(cm[i], polar.z(), 1.0e-12);
+    }
+}
+
 } // namespace amr_wind_tests
@@ -1,5 +1,6 @@
 #include "abl_test_utils.H"
 #include "amr-wind/utilities/trig_ops.H"
+#include "amr-wind/wind_energy/ShearStress.H"
 #include "aw_test_utils/iter_tools.H"
 #include "aw_test_utils/test_utils.H"
 #include "amr-wind/incflo.H"
@@ -165,6 +166,149 @@ TEST_F(ABLMeshTest, abl_local_wall_model)
     EXPECT_NEAR(vexpct, vbase, tol);
 }
 
+TEST_F(ABLMeshTest, abl_local_mo_wall_model)
+{
+    constexpr amrex::Real tol = 1.0e-12;
+    constexpr amrex::Real mu = 0.01;
+    constexpr amrex::Real vval = 5.0;
+    constexpr amrex::Real dt = 0.1;
+    constexpr amrex::Real kappa = 0.4;
+    constexpr amrex::Real z0 = 0.11;
+    int dir = 0;
+    populate_parameters();
+    {
+        amrex::ParmParse pp("geometry");
+        amrex::Vector<int> periodic{{1, 1, 0}};
+        pp.addarr("is_periodic", periodic);
+    }
+    {
+        amrex::ParmParse pp("zlo");
+        pp.add("type", (std::string) "wall_model");
+    }
+    {
+        amrex::ParmParse pp("zhi");
+        pp.add("type", (std::string) "slip_wall");
+    }
+    {
+        amrex::ParmParse pp("incflo");
+        pp.add("diffusion_type", 0);
+    }
+    {
+        amrex::ParmParse pp("transport");
+        pp.add("viscosity", mu);
+    }
+    {
+        amrex::ParmParse pp("time");
+        pp.add("fixed_dt", dt);
+    }
+    {
+        amrex::ParmParse pp("ABL");
+        pp.add("wall_shear_stress_type", (std::string) "local_mo");
+        pp.add("kappa", kappa);
+        pp.add("surface_roughness_z0", z0);
+    }
+    initialize_mesh();
+
+    // Set up solver-related routines
+    auto& pde_mgr = sim().pde_manager();
+    pde_mgr.register_icns();
+    sim().create_turbulence_model();
+    sim().init_physics();
+
+    // Specify velocity as uniform in x direction
+    auto& velocity = sim().repo().get_field("velocity");
+    init_velocity(velocity, vval, dir);
+    // Specify density as unity
+    auto& density = sim().repo().get_field("density");
+    density.setVal(1.0);
+    // Perform post init for physics: turns on wall model
+    for (auto& pp : sim().physics()) {
+        pp->post_init_actions();
+    }
+
+    // Advance states to prepare for time step
+    pde_mgr.advance_states();
+
+    // Initialize icns pde
+    auto& icns_eq = pde_mgr.icns();
+    icns_eq.initialize();
+    // Initialize viscosity
+    sim().turbulence_model().update_turbulent_viscosity(
+        amr_wind::FieldState::Old, DiffusionType::Crank_Nicolson);
+    icns_eq.compute_mueff(amr_wind::FieldState::Old);
+
+    // Check test setup by verifying mu
+    const auto& viscosity = sim().repo().get_field("velocity_mueff");
+    EXPECT_NEAR(mu, utils::field_max(viscosity), tol);
+    EXPECT_NEAR(mu, utils::field_min(viscosity), tol);
+
+    // Zero source term and convection term to focus on diffusion
+    auto& src = icns_eq.fields().src_term;
+    auto& adv = icns_eq.fields().conv_term;
+    src.setVal(0.0);
+    adv.setVal(0.0);
+
+    // Calculate diffusion term
+    icns_eq.compute_diffusion_term(amr_wind::FieldState::Old);
+    // Setup mask_cell array to avoid errors in solve
+    auto& mask_cell = sim().repo().declare_int_field("mask_cell", 1, 1);
+    mask_cell.setVal(1);
+    // Compute result with just diffusion term
+    icns_eq.compute_predictor_rhs(DiffusionType::Explicit);
+
+    // Get resulting velocity in first cell
+    const amrex::Real vbase = get_val_at_kindex(velocity, dir, 0) / 8 / 8;
+
+    // Calculate expected velocity after one step, the neutral local solve
+    // reduces to the log law
+    const amrex::Real dz = sim().mesh().Geom(0).CellSizeArray()[2];
+    const amrex::Real zref = 0.5 * dz;
+    const amrex::Real utau = kappa * vval / (std::log(zref / z0));
+    const amrex::Real tau_wall = std::pow(utau, 2);
+    const amrex::Real vexpct = vval + dt * (0.0 - tau_wall) / dz;
+    EXPECT_NEAR(vexpct, vbase, tol);
+}
+
+TEST(ABLWallModel, local_mo_solver)
+{
+    constexpr amrex::Real tol = 1.0e-4;
+    amr_wind::MOData mo;
+    mo.zref = 5.0;
+    mo.z0 = 0.1;
+    mo.z0t = 0.1;
+    mo.vmag_mean = 8.0;
+    mo.theta_mean = 300.0;
+
+    // Compare with the plane-averaged solve for unstable, stable and
+    // surface-temperature conditions
+    const amrex::Vector<amrex::Real> fluxes{0.1, -0.01, 0.0};
+    for (const auto flux : fluxes) {
+        const bool temp_mode = (flux == 0.0);
+        mo.alg_type = temp_mode
+                          ? amr_wind::MOData::ThetaCalcType::SURFACE_TEMPERATURE
+                          : amr_wind::MOData::ThetaCalcType::HEAT_FLUX;
+        mo.surf_temp_flux = flux;
+        mo.surf_temp = 302.0;
+        mo.update_fluxes(50);
+
+        const amr_wind::ShearStressLocalMO tau(mo, 50);
+        const amrex::Real zref = mo.zref;
+        const amrex::Real wspd = mo.vmag_mean;
+        const amrex::Real theta = mo.theta_mean;
+        const amrex::Real z0 = mo.z0;
+        amrex::Gpu::DeviceScalar<amrex::Real> utau_d(0.0);
+        amrex::Gpu::DeviceScalar<amrex::Real> tflux_d(0.0);
+        auto* utau_ptr = utau_d.dataPtr();
+        auto* tflux_ptr = tflux_d.dataPtr();
+        amrex::ParallelFor(1, [=] AMREX_GPU_DEVICE(int /*unused*/) noexcept {
+            tau.solve(zref, wspd, theta, z0, *utau_ptr, *tflux_ptr);
+        });
+
+        EXPECT_NEAR(utau_d.dataValue(), mo.utau, tol);
+        EXPECT_NEAR(tflux_d.dataValue(), mo.surf_temp_flux, tol);
+    }
+}
+
 TEST_F(ABLMeshTest, abl_donelan_wall_model)
 {
     constexpr amrex::Real tol = 1.0e-12;
@@ -0,0 +1,403 @@
+#include "aw_test_utils/MeshTest.H"
+#include "amr-wind/wind_energy/ABLBoundaryPlane.H"
+#include "AMReX_FileSystem.H"
+
+namespace amr_wind_tests {
+
+namespace {
+
+/** Boundary data that is linear in time and varies along the x faces
+ *
+ *  The data depends on the physical coordinates of the cell centers, so
+ *  meshes with different origins see the same data.
+ */
+AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE amrex::Real bndry_value(
+    const int j,
+    const int k,
+    const int n,
+    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& problo,
+    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& dx,
+    const amrex::Real time,
+    const amrex::Real offset)
+{
+    const amrex::Real y = problo[1] + (j + 0.5) * dx[1];
+    const amrex::Real z = problo[2] + (k + 0.5) * dx[2];
+    return offset + (n + 1) * time + std::sin(0.5 * y) +
+           std::cos(0.3 * z + n);
+}
+
+//! Initialize a field, including its ghost cells, with the boundary data
+void init_field(
+    amr_wind::Field& fld, const amrex::Real time, const amrex::Real offset)
+{
+    for (int lev = 0; lev < fld.repo().num_active_levels(); ++lev) {
+        const auto& geom = fld.repo().mesh().Geom(lev);
+        const auto problo = geom.ProbLoArray();
+        const auto dx = geom.CellSizeArray();
+        const auto& farrs = fld(lev).arrays();
+        amrex::ParallelFor(
+            fld(lev), fld.num_grow(), fld.num_comp(),
+            [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k, int n) noexcept {
+                farrs[nbx](i, j, k, n) =
+                    bndry_value(j, k, n, problo, dx, time, offset);
+            });
+    }
+    amrex::Gpu::streamSynchronize();
+}
+
+//! Ghost cells of the domain just outside a face
+amrex::Box face_cells(const amrex::Box& domain, const amrex::Orientation ori)
+{
+    const int normal = ori.coordDir();
+    amrex::Box bx(domain);
+    if (ori.isLow()) {
+        bx.setRange(normal, domain.smallEnd(normal) - 1);
+    } else {
+        bx.setRange(normal, domain.bigEnd(normal) + 1);
+    }
+    return bx;
+}
+
+//! Maximum error of the data in the ghost cells just outside the faces
+amrex::Real bndry_error(
+    const amrex::MultiFab& data,
+    const amrex::Geometry& geom,
+    const amrex::Vector<amrex::Orientation>& faces,
+    const amrex::Real time,
+    const amrex::Real offset)
+{
+    const auto& domain = geom.Domain();
+    const auto problo = geom.ProbLoArray();
+    const auto dx = geom.CellSizeArray();
+    const int nc = data.nComp();
+    amrex::Real err = 0.0;
+    for (const auto& ori : faces) {
+        const amrex::Box fbx = face_cells(domain, ori);
+        err = amrex::max(
+            err,
+            amrex::ReduceMax(
+                data, 1,
+                [=] AMREX_GPU_HOST_DEVICE(
+                    amrex::Box const& bx,
+                    amrex::Array4<amrex::Real const> const& arr)
+                    -> amrex::Real {
+                    amrex::Real err_fab = 0.0;
+                    amrex::Loop(
+                        bx & fbx, nc,
+                        [=, &err_fab](int i, int j, int k, int n) noexcept {
+                            err_fab = amrex::max(
+                                err_fab,
+                                std::abs(
+                                    arr(i, j, k, n) -
+                                    bndry_value(
+                                        j, k, n, problo, dx, time, offset)));
+                        });
+                    return err_fab;
+                }));
+    }
+    amrex::ParallelDescriptor::ReduceRealMax(err);
+    return err;
+}
+
+} // namespace
+
+class ABLBoundaryPlaneTest : public MeshTest
+{
+protected:
+    //! Faces on which the inflow data of a field is checked
+    struct InflowCheck
+    {
+        std::string name;
+        amrex::Real offset;
+        amrex::Vector<amrex::Orientation> faces;
+    };
+
+    void populate_parameters() override
+    {
+        MeshTest::populate_parameters();
+        {
+            amrex::ParmParse pp("amr");
+            pp.add("max_grid_size", 4);
+            pp.add("blocking_factor", 4);
+        }
+        {
+            amrex::ParmParse pp("geometry");
+            pp.addarr("is_periodic", amrex::Vector<int>{0, 1, 1});
+        }
+        for (const auto* face : {"xlo", "xhi"}) {
+            amrex::ParmParse pp(face);
+            pp.add("type", std::string("mass_inflow"));
+        }
+        {
+            amrex::ParmParse pp("ABL");
+            pp.addarr("bndry_planes", amrex::Vector<std::string>{"xlo", "xhi"});
+            pp.addarr(
+                "bndry_var_names",
+                amrex::Vector<std::string>{"velocity", "temperature"});
+        }
+    }
+
+    //! Declare the boundary plane fields on the current mesh
+    void declare_fields()
+    {
+        auto& repo = sim().repo();
+        auto& vel = repo.declare_field("velocity", 3, 1);
+        auto& temp = repo.declare_field("temperature", 1, 1);
+        vel.set_default_fillpatch_bc(time(), amrex::BCType::foextrap);
+        temp.set_default_fillpatch_bc(time(), amrex::BCType::foextrap);
+    }
+
+    //! Restrict the output of a face to the cells overlapping a window
+    static void set_window(
+        const std::string& plane,
+        const amrex::Vector<amrex::Real>& lo,
+        const amrex::Vector<amrex::Real>& hi)
+    {
+        amrex::ParmParse pp("ABL.bndry_output." + plane);
+        pp.addarr("lo", lo);
+        pp.addarr("hi", hi);
+    }
+
+    //! Create boundary planes writing (0) or reading (1) a file
+    std::unique_ptr<amr_wind::ABLBoundaryPlane> create_bndry_plane(
+        const int io_mode, const std::string& fmt, const std::string& fname)
+    {
+        amrex::ParmParse pp("ABL");
+        pp.add("bndry_io_mode", io_mode);
+        pp.add("bndry_output_format", fmt);
+        pp.add("bndry_file", fname);
+        auto bndry = std::make_unique<amr_wind::ABLBoundaryPlane>(sim());
+        bndry->initialize_data();
+        if (io_mode == 0) {
+            bndry->write_header();
+        } else {
+            bndry->read_header();
+        }
+        return bndry;
+    }
+
+    //! Write the boundary planes over `nsteps` time steps
+    void write_planes(
+        amrex::Vector<std::unique_ptr<amr_wind::ABLBoundaryPlane>>& writers,
+        const int nsteps)
+    {
+        auto& repo = sim().repo();
+        for (int step = 0; step <= nsteps; ++step) {
+            const amrex::Real t = time().new_time();
+            init_field(repo.get_field("velocity"), t, m_vel_offset);
+            init_field(repo.get_field("temperature"), t, m_temp_offset);
+            for (auto& bndry : writers) {
+                bndry->write_file();
+            }
+            time().new_timestep();
+            time().advance_time();
+        }
+    }
+
+    //! Boundary data of a field at the time of the last read
+    static std::unique_ptr<amrex::MultiFab> inflow_data(
+        const amr_wind::ABLBoundaryPlane& bndry,
+        amr_wind::Field& fld,
+        const amrex::Real time)
+    {
+        const auto& mf = fld(0);
+        auto data = std::make_unique<amrex::MultiFab>(
+            mf.boxArray(), mf.DistributionMap(), fld.num_comp(), 1);
+        data->setVal(0.0);
+        bndry.populate_data(0, time, fld, *data);
+        return data;
+    }
+
+    /** Read the native and indexed files at each time and check the data
+     *
+     *  The data read from the indexed files must match the boundary values
+     *  on the checked faces and the data read from the native files.
+     */
+    void check_inflow(
+        amr_wind::ABLBoundaryPlane& native,
+        amr_wind::ABLBoundaryPlane& indexed,
+        const amrex::Vector<amrex::Real>& times,
+        const amrex::Vector<InflowCheck>& checks)
+    {
+        const auto& geom = mesh().Geom(0);
+        for (const amrex::Real t : times) {
+            time().set_restart_time(0, t);
+            native.read_file(false);
+            indexed.read_file(false);
+
+            for (const auto& chk : checks) {
+                auto& fld = sim().repo().get_field(chk.name);
+                const auto ndata = inflow_data(native, fld, t);
+                const auto idata = inflow_data(indexed, fld, t);
+                EXPECT_NEAR(
+                    bndry_error(*idata, geom, chk.faces, t, chk.offset), 0.0,
+                    m_tol)
+                    << chk.name << " at t = " << t;
+
+                amrex::MultiFab::Subtract(
+                    *idata, *ndata, 0, 0, fld.num_comp(), 1);
+                for (int n = 0; n < fld.num_comp(); ++n) {
+                    EXPECT_NEAR(idata->norm0(n, 1), 0.0, m_tol)
+                        << chk.name << " at t = " << t;
+                }
+            }
+        }
+    }
+
+    const amrex::Real m_vel_offset{0.0};
+    const amrex::Real m_temp_offset{300.0};
+    const amrex::Real m_tol{1.0e-10};
+    const std::string m_native_file{"abl_bndry_native"};
+    const std::string m_indexed_file{"abl_bndry_indexed"};
+};
+
+TEST_F(ABLBoundaryPlaneTest, indexed_matches_native)
+{
+    initialize_mesh();
+    declare_fields();
+    {
+        amrex::Vector<std::unique_ptr<amr_wind::ABLBoundaryPlane>> writers;
+        writers.push_back(create_bndry_plane(0, "native", m_native_file));
+        writers.push_back(create_bndry_plane(0, "indexed", m_indexed_file));
+        write_planes(writers, 5);
+    }
+
+    auto native = create_bndry_plane(1, "native", m_native_file);
+    auto indexed = create_bndry_plane(1, "indexed", m_indexed_file);
+
+    // Access the records out of order, going back in time and reading the
+    // times of the records themselves
+    const amrex::Vector<amrex::Orientation> faces{
+        amrex::Orientation(0, amrex::Orientation::low),
+        amrex::Orientation(0, amrex::Orientation::high)};
+    check_inflow(
+        *native, *indexed, {0.45, 0.05, 0.3, 0.1, 0.25, 0.0},
+        {{"velocity", m_vel_offset, faces},
+         {"temperature", m_temp_offset, faces}});
+
+    amrex::FileSystem::RemoveAll(m_native_file);
+    amrex::FileSystem::RemoveAll(m_indexed_file);
+}
+
+TEST_F(ABLBoundaryPlaneTest, window_round_trip)
+{
+    // The precursor only outputs the faces of a corner of its domain, the
+    // upper window is widened to whole cells
+    initialize_mesh();
+    declare_fields();
+    set_window("xlo", {0.0, 0.0, 0.0}, {8.0, 4.0, 4.0});
+    set_window("xhi", {0.0, 0.0, 0.0}, {8.0, 3.5, 3.2});
+    {
+        amrex::Vector<std::unique_ptr<amr_wind::ABLBoundaryPlane>> writers;
+        writers.push_back(create_bndry_plane(0, "indexed", m_indexed_file));
+        // Only the native format can restrict the variables of a face
+        {
+            amrex::ParmParse pp("ABL.bndry_output.xhi");
+            pp.addarr("var_names", amrex::Vector<std::string>{"temperature"});
+        }
+        writers.push_back(create_bndry_plane(0, "native", m_native_file));
+        write_planes(writers, 3);
+    }
+
+    // The simulation reading the data lies within the windows and only has
+    // temperature inflow on the upper face
+    m_mesh.reset();
+    {
+        amrex::ParmParse pp("amr");
+        pp.addarr("n_cell", amrex::Vector<int>{8, 4, 4});
+    }
+    {
+        amrex::ParmParse pp("geometry");
+        pp.addarr("prob_hi", amrex::Vector<amrex::Real>{8.0, 4.0, 4.0});
+    }
+    {
+        amrex::ParmParse pp("xhi");
+        pp.add("velocity_type", std::string("pressure_outflow"));
+    }
+    initialize_mesh();
+    declare_fields();
+
+    auto native = create_bndry_plane(1, "native", m_native_file);
+    auto indexed = create_bndry_plane(1, "indexed", m_indexed_file);
+
+    const amrex::Orientation xlo(0, amrex::Orientation::low);
+    const amrex::Orientation xhi(0, amrex::Orientation::high);
+    check_inflow(
+        *native, *indexed, {0.25, 0.05, 0.2},
+        {{"velocity", m_vel_offset, {xlo}},
+         {"temperature", m_temp_offset, {xlo, xhi}}});
+
+    amrex::FileSystem::RemoveAll(m_native_file);
+    amrex::FileSystem::RemoveAll(m_indexed_file);
+}
+
+TEST_F(ABLBoundaryPlaneTest, offset_window_round_trip)
+{
+    // The precursor outputs a window of the lower face that does not start
+    // at its origin
+    initialize_mesh();
+    declare_fields();
+    set_window("xlo", {0.0, 2.0, 2.0}, {8.0, 8.0, 8.0});
+    {
+        amrex::Vector<std::unique_ptr<amr_wind::ABLBoundaryPlane>> writers;
+        writers.push_back(create_bndry_plane(0, "native", m_native_file));
+        writers.push_back(create_bndry_plane(0, "indexed", m_indexed_file));
+        write_planes(writers, 3);
+    }
+
+    // The simulation reading the data has its origin offset into the window
+    // of the lower face by whole cells
+    m_mesh.reset();
+    {
+        amrex::ParmParse pp("amr");
+        pp.addarr("n_cell", amrex::Vector<int>{8, 4, 4});
+    }
+    {
+        amrex::ParmParse pp("geometry");
+        pp.addarr("prob_lo", amrex::Vector<amrex::Real>{0.0, 3.0, 2.0});
+        pp.addarr("prob_hi", amrex::Vector<amrex::Real>{8.0, 7.0, 6.0});
+    }
+    initialize_mesh();
+    declare_fields();
+
+    auto native = create_bndry_plane(1, "native", m_native_file);
+    auto indexed = create_bndry_plane(1, "indexed", m_indexed_file);
+
+    const amrex::Vector<amrex::Orientation> faces{
+        amrex::Orientation(0, amrex::Orientation::low),
+        amrex::Orientation(0, amrex::Orientation::high)};
+    check_inflow(
+        *native, *indexed, {0.25, 0.05, 0.2},
+        {{"velocity", m_vel_offset, faces},
+         {"temperature", m_temp_offset, faces}});
+
+    amrex::FileSystem::RemoveAll(m_native_file);
+    amrex::FileSystem::RemoveAll(m_indexed_file);
+}
+
+TEST_F(ABLBoundaryPlaneTest, uncovered_inflow_rejected)
+{
+    // The output window of the lower face does not cover the inflow face of
+    // the same mesh
+    initialize_mesh();
+    declare_fields();
+    set_window("xlo", {0.0, 0.0, 0.0}, {8.0, 8.0, 4.0});
+    {
+        amrex::Vector<std::unique_ptr<amr_wind::ABLBoundaryPlane>> writers;
+        writers.push_back(create_bndry_plane(0, "native", m_native_file));
+        writers.push_back(create_bndry_plane(0, "indexed", m_indexed_file));
+        write_planes(writers, 3);
+    }
+
+    auto native = create_bndry_plane(1, "native", m_native_file);
+    auto indexed = create_bndry_plane(1, "indexed", m_indexed_file);
+
+    time().set_restart_time(0, 0.15);
+    EXPECT_THROW(native->read_file(false), amrex::RuntimeError);
+    EXPECT_THROW(indexed->read_file(false), amrex::RuntimeError);
+
+    amrex::FileSystem::RemoveAll(m_native_file);
+    amrex::FileSystem::RemoveAll(m_indexed_file);
+}
+
+} // namespace amr_wind_tests
@@ -4,6 +4,7 @@
 #include "amr-wind/physics/ForestDrag.H"
 #include "amr-wind/core/field_ops.H"
 #include "amr-wind/utilities/sampling/FieldNorms.H"
+#include "AMReX_ParReduce.H"
 
 namespace {
 void write_forest(const std::string& fname)
@@ -63,21 +64,45 @@ TEST_F(ForestTest, forest)
         forest_drag.initialize_fields(lev, geom);
     }
 
+    // The forest fields are stored in single precision, widen them for the
+    // checks and compare to the double-precision values within float accuracy
+    const auto& f_id_float = sim().repo().get_float_field("forest_id");
+    const auto& f_drag_float = sim().repo().get_float_field("forest_drag");
+    auto& f_id = sim().repo().declare_field("forest_id_check", 1, 0, 1);
+    auto& f_drag = sim().repo().declare_field("forest_drag_check", 1, 0, 1);
+    for (int lev = 0; lev < nlevels; ++lev) {
+        f_id_float.copy_to(lev, f_id(lev), 0);
+        f_drag_float.copy_to(lev, f_drag(lev), 0);
+    }
+    constexpr amrex::Real float_tol = 1.0e-6;
+
     constexpr amrex::Real n_forests = 3.0;
-    const auto& f_id = sim().repo().get_field("forest_id");
     const amrex::Real max_id = amr_wind::field_ops::global_max_magnitude(f_id);
     EXPECT_EQ(max_id, n_forests);
 
     constexpr amrex::Real expected_max_drag = 0.050285714285714288;
-    const auto& f_drag = sim().repo().get_field("forest_drag");
     const amrex::Real max_drag =
         amr_wind::field_ops::global_max_magnitude(f_drag);
-    EXPECT_NEAR(max_drag, expected_max_drag, amr_wind::constants::TIGHT_TOL);
+    EXPECT_NEAR(max_drag, expected_max_drag, float_tol * expected_max_drag);
 
     constexpr amrex::Real expected_norm_drag = 0.0030635155406915832;
     const auto norm_drag =
         amr_wind::field_norms::FieldNorms::get_norm(f_drag, 0, 1, 2, false);
-    EXPECT_NEAR(norm_drag, expected_norm_drag, amr_wind::constants::TIGHT_TOL);
+    EXPECT_NEAR(norm_drag, expected_norm_drag, float_tol * expected_norm_drag);
+
+    // Only the cells within the forests are active
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto& darrs = f_drag_float(lev).const_arrays();
+        const amrex::Long nactive = amrex::ParReduce(
+            amrex::TypeList<amrex::ReduceOpSum>{},
+            amrex::TypeList<amrex::Long>{}, f_drag_float(lev),
+            amrex::IntVect(0),
+            [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k)
+                -> amrex::GpuTuple<amrex::Long> {
+                return static_cast<amrex::Long>(darrs[nbx](i, j, k) != 0.0F);
+            });
+        EXPECT_EQ(forest_drag.active_cells().num_local_cells(lev), nactive);
+    }
 }
 
 } // namespace amr_wind_tests
@@ -2,6 +2,8 @@
 #include "aw_test_utils/iter_tools.H"
 #include "aw_test_utils/test_utils.H"
 #include "amr-wind/physics/TerrainDrag.H"
+#include "AMReX_iMultiFab.H"
+#include "AMReX_ParReduce.H"
 
 namespace {
 void write_terrain(const std::string& fname)
@@ -86,6 +88,47 @@ TEST_F(TerrainTest, terrain)
     // Inside Point
     const int value_in = utils::field_probe(terrain_blank, 0, 15, 10, 1);
     EXPECT_EQ(value_in, 1 + tol);
+
+    // Terrain height and roughness are stored in single precision
+    const auto& terrain_height = sim().repo().get_float_field("terrain_height");
+    EXPECT_EQ(utils::field_probe(terrain_height, 0, 5, 5, 1), 0.0);
+    EXPECT_EQ(utils::field_probe(terrain_height, 0, 15, 10, 1), 100.0);
+    EXPECT_TRUE(sim().repo().float_field_exists("terrainz0"));
+    EXPECT_FALSE(sim().repo().field_exists("terrainz0"));
+
+    // The active cells are the cells within the terrain and in the drag layer
+    const auto& terrain_drag_fld = sim().repo().get_int_field("terrain_drag");
+    const auto& active_cells = terrain_drag.active_cells();
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto& blank = terrain_blank(lev);
+        amrex::iMultiFab visited(
+            blank.boxArray(), blank.DistributionMap(), 1, 0);
+        visited.setVal(0);
+        for (amrex::MFIter mfi(visited); mfi.isValid(); ++mfi) {
+            const auto& varr = visited.array(mfi);
+            active_cells.ParallelFor(
+                lev, mfi, mfi.validbox(),
+                [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                    varr(i, j, k) += 1;
+                });
+        }
+
+        const auto& barrs = blank.const_arrays();
+        const auto& darrs = terrain_drag_fld(lev).const_arrays();
+        const auto& varrs = visited.const_arrays();
+        const auto counts = amrex::ParReduce(
+            amrex::TypeList<amrex::ReduceOpSum, amrex::ReduceOpSum>{},
+            amrex::TypeList<int, int>{}, visited, amrex::IntVect(0),
+            [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k)
+                -> amrex::GpuTuple<int, int> {
+                const int active = static_cast<int>(
+                    (barrs[nbx](i, j, k) == 1) || (darrs[nbx](i, j, k) == 1));
+                return {active, static_cast<int>(
+                                    varrs[nbx](i, j, k) != active)};
+            });
+        EXPECT_EQ(active_cells.num_local_cells(lev), amrex::get<0>(counts));
+        EXPECT_EQ(amrex::get<1>(counts), 0);
+    }
 }
 
 } // namespace amr_wind_tests